@@ -29,6 +29,7 @@
 #include <ecal/ecal_types.h>
 
 #include <functional>
+#include <memory>
 #include <string>
 
 namespace eCAL
@@ -45,6 +46,24 @@ namespace eCAL
     long long clock = 0;        //!< publisher send clock
   };
 
+  /**
+   * @brief eCAL subscriber receive view struct.
+   *
+   * The payload stays valid and unchanged as long as the view (the shared pointer handed out
+   * by the receive view callback) exists. For shared memory samples with enabled zero copy mode
+   * the view points directly into the memory file and keeps it read locked, otherwise it owns a copy.
+   * All views have to be released before eCAL is finalized.
+  **/
+  struct SReceiveViewData
+  {
+    const void* buf       = nullptr;  //!< payload buffer (read only)
+    size_t      size      = 0;        //!< payload buffer size
+    long long   id        = 0;        //!< publisher id (SetId())
+    long long   time      = 0;        //!< publisher send time in µs
+    long long   clock     = 0;        //!< publisher send clock
+    bool        zero_copy = false;    //!< payload is pinned in the shared memory file (not copied)
+  };
+
   /**
    * @brief eCAL publisher event callback struct.
   **/
@@ -106,6 +125,8 @@ namespace eCAL
     unsigned int   version     = 0;  //!< service protocol version
     unsigned short tcp_port_v0 = 0;  //!< service tcp port protocol version 0
     unsigned short tcp_port_v1 = 0;  //!< service tcp port protocol version 1
+    std::string    shm_name;         //!< service shared memory file (same host only, empty if not available)
+    unsigned int   frame_version = 0; //!< service raw request / response frame version (0 = protobuf messages only)
   };
 
   /**
@@ -151,6 +172,14 @@ namespace eCAL
   **/
   using ReceiveCallbackT = std::function<void (const char *, const struct SReceiveCallbackData *)>;
 
+  /**
+   * @brief Receive view callback function type.
+   *
+   * @param topic_name_  The topic name of the received message.
+   * @param view_        Read only sample view, the payload is valid as long as the view is referenced.
+  **/
+  using ReceiveViewCallbackT = std::function<void (const char *, const std::shared_ptr<const struct SReceiveViewData>&)>;
+
   /**
    * @brief Timer callback function type.
   **/
@@ -139,12 +139,39 @@ namespace eCAL
      *
      * @param method_name_  Method name.
      * @param request_      Request string. 
-     * @param timeout_      Maximum time before operation returns (in milliseconds, -1 means infinite) - NOT SUPPORTED YET.
+     * @param timeout_      Maximum time for every single call (in milliseconds, -1 means infinite), timed out calls are reported by the client_event_timeout event.
      *
      * @return  True if successful.
     **/
     ECAL_API bool CallAsync(const std::string& method_name_, const std::string& request_, int timeout_ = -1);
 
+    /**
+     * @brief Call a method of this service asynchronously, every called service sets its own future.
+     *
+     * A future gets ready when the response arrived, the call timed out or
+     * the call has been cancelled (call_state_failed with error message
+     * "Timeout" or "Cancelled"). No thread is blocked while the calls are outstanding.
+     *
+     * @param       method_name_  Method name.
+     * @param       request_      Request string.
+     * @param       timeout_      Maximum time for every single call (in milliseconds, -1 means infinite).
+     * @param [out] call_id_      Id of this call for CancelCall (null pointer == not needed).
+     *
+     * @return  One future per called service (empty if no service has been called).
+    **/
+    ECAL_API ServiceResponseFutureVecT CallFuture(const std::string& method_name_, const std::string& request_, int timeout_ = -1, ServiceCallIdT* call_id_ = nullptr);
+
+    /**
+     * @brief Cancel an asynchronous call (see CallFuture), its pending futures are set to call_state_failed.
+     *
+     * The request may have been executed by the service anyway, only its response is discarded.
+     *
+     * @param call_id_  Id of the call.
+     *
+     * @return  True if the call was still pending.
+    **/
+    ECAL_API bool CancelCall(ServiceCallIdT call_id_);
+
     /**
      * @brief Add server response callback. 
      *
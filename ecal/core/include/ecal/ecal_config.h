@@ -61,6 +61,8 @@ namespace eCAL
 
     ECAL_API bool              IsUdpMulticastJoinAllIfEnabled       ();
 
+    ECAL_API int               GetUdpMulticastMaxMessageSizeBytes   ();
+
     ECAL_API int               GetMaxUdpBandwidthBytesPerSecond     ();
 
     ECAL_API bool              IsUdpMulticastRecEnabled             ();
@@ -118,6 +120,7 @@ namespace eCAL
     ECAL_API int               GetMemfileAckTimeoutMs               ();
     ECAL_API bool              IsMemfileZerocopyEnabled             ();
     ECAL_API size_t            GetMemfileBufferCount                ();
+    ECAL_API size_t            GetMemfileRingSlotCount              ();
 
     ECAL_API bool              IsTopicTypeSharingEnabled            ();
     ECAL_API bool              IsTopicDescriptionSharingEnabled     ();
@@ -138,6 +141,15 @@ namespace eCAL
       ECAL_API size_t            GetShmMonitoringQueueSize          ();
       ECAL_API std::string       GetShmMonitoringDomain             ();
       ECAL_API bool              GetDropOutOfOrderMessages          ();
+      ECAL_API size_t            GetShmObserverThreadCount          ();
+      ECAL_API bool              IsUdpRawSampleFormatEnabled        ();
+      ECAL_API bool              IsDeltaRegistrationEnabled         ();
+      ECAL_API bool              IsDescriptorInterningEnabled       ();
+      ECAL_API size_t            GetSubscriberDispatcherThreadCount ();
+      ECAL_API size_t            GetServiceServerWorkerThreadCount  ();
+      ECAL_API bool              IsServiceShmTransportEnabled       ();
+      ECAL_API size_t            GetServiceShmChannelCount          ();
+      ECAL_API size_t            GetServiceShmChannelSize           ();
     }
   }
 }
@@ -293,6 +293,19 @@ namespace eCAL
     **/
     ECAL_API bool ShmSetBufferCount(long buffering_);
 
+    /**
+     * @brief Use a lock-free multi slot shared memory ring instead of a mutex protected single buffer.
+     *
+     * The publisher writes every sample into the next free slot without waiting for any subscriber.
+     * Subscribers that cannot keep up lose the oldest samples. Subscribers of older eCAL versions
+     * will not receive samples over shared memory in this mode.
+     *
+     * @param slots_  Number of ring slots (0 = off, default).
+     *
+     * @return  True if it succeeds, false if it fails.
+    **/
+    ECAL_API bool ShmSetRingSlotCount(long slots_);
+
     /**
      * @brief Enable zero copy shared memory transport mode.
      *
@@ -366,6 +379,30 @@ namespace eCAL
       return ShmSetAcknowledgeTimeout(static_cast<long long>(acknowledge_timeout_ms));
     }
 
+    /**
+     * @brief Collect small messages and send them as one transport frame.
+     *
+     * Every Send call appends the message to the current frame. The frame is sent when the next message
+     * does not fit anymore or when the time window of its first message elapsed. Subscribers unbatch
+     * the frame transparently, every message keeps its own id, clock and send time. Messages too large
+     * for a frame are sent as usual. Subscribers of older eCAL versions receive the whole frame as one message.
+     *
+     * @param max_size_      Maximum frame size in bytes (0 = no batching, default).
+     * @param max_delay_us_  Maximum time a message waits in the frame in us (0 = frame is sent when full or on FlushBatch only).
+     *                       The window is checked on every Send, if no further message is sent the frame is
+     *                       flushed by a timer with a resolution of max_delay_us_ / 2, but at least 1 ms.
+     *
+     * @return  True if it succeeds, false if it fails.
+    **/
+    ECAL_API bool SetBatching(size_t max_size_, long long max_delay_us_);
+
+    /**
+     * @brief Send the messages collected in the current batch frame immediately.
+     *
+     * @return  True if a frame was sent, false if there was nothing to send.
+    **/
+    ECAL_API bool FlushBatch() const;
+
     /**
      * @brief Set the specific topic id.
      *
@@ -440,6 +477,41 @@ namespace eCAL
     **/
     ECAL_API size_t Send(CPayloadWriter& payload_, long long time_, long long acknowledge_timeout_ms_) const;
 
+    /**
+     * @brief Loan a writable buffer for the next message.
+     *
+     * If the shared memory layer is the only active layer the buffer is located directly in the next free
+     * memory file (or ring slot), so the content can be filled in place (e.g. by a sensor driver) without
+     * any additional copy. Otherwise a publisher internal buffer is returned and the content is sent
+     * like a usual message on commit.
+     *
+     * The buffer has to be committed (CommitBuffer) or discarded (DiscardBuffer) before the next message
+     * can be sent. Note that in single buffer mode the memory file stays locked for readers until then,
+     * use ShmSetBufferCount or ShmSetRingSlotCount to decouple the subscribers.
+     *
+     * @param max_len_  Maximum length of the message [Bytes].
+     *
+     * @return  Pointer to the writable buffer (nullptr if it fails or a buffer is loaned already).
+    **/
+    ECAL_API void* LoanBuffer(size_t max_len_);
+
+    /**
+     * @brief Send the content of the loaned buffer to all subscribers.
+     *
+     * @param len_    Actual length of the message (has to be smaller or equal the loaned length).
+     * @param time_   Send time (-1 = use eCAL system time in us, default = -1).
+     *
+     * @return  Number of bytes sent.
+    **/
+    ECAL_API size_t CommitBuffer(size_t len_, long long time_ = DEFAULT_TIME_ARGUMENT);
+
+    /**
+     * @brief Release the loaned buffer without sending it.
+     *
+     * @return  True if it succeeds, false if there is no loaned buffer.
+    **/
+    ECAL_API bool DiscardBuffer();
+
     /**
      * @brief Send a message to all subscribers.
      *
@@ -50,6 +50,24 @@ namespace eCAL
       reliable_reliability_qos,       //!< Reliable reliability (default for Publishers).
     };
 
+    /**
+     * @brief eCAL QOS delivery mode (subscriber only).
+    **/
+    enum eQOSPolicy_Delivery
+    {
+      synchronous_delivery_qos,       //!< Receive callbacks are called by the transport layer thread, default value.
+      asynchronous_delivery_qos,      //!< Samples are queued (history_kind_depth) and the receive callbacks are called by a dispatcher thread.
+    };
+
+    /**
+     * @brief eCAL QOS receive queue overflow policy (asynchronous delivery only).
+    **/
+    enum eQOSPolicy_Overflow
+    {
+      drop_oldest_overflow_qos,       //!< Drop the oldest queued sample, default value.
+      drop_newest_overflow_qos,       //!< Drop the newly received sample.
+    };
+
     /**
      * @brief eCAL data writer QOS settings.
      * @deprecated Will be removed in future eCAL versions.
@@ -69,6 +87,10 @@ namespace eCAL
 
     /**
      * @brief eCAL data reader QOS settings.
+     *
+     * The delivery and overflow members were appended to the struct, so its size
+     * changed. Applications passing SReaderQOS to eCAL need to be rebuilt.
+     *
      * @deprecated Will be removed in future eCAL versions.
     **/
     struct ECAL_API SReaderQOS
@@ -78,10 +100,14 @@ namespace eCAL
         history_kind       = keep_last_history_qos;
         history_kind_depth = 8;
         reliability        = best_effort_reliability_qos;
+        delivery           = synchronous_delivery_qos;
+        overflow           = drop_oldest_overflow_qos;
       }
       eQOSPolicy_HistoryKind  history_kind;              //!< qos history kind mode
-      int                     history_kind_depth;        //!< qos history kind mode depth
+      int                     history_kind_depth;        //!< qos history kind mode depth (receive queue size for asynchronous delivery)
       eQOSPolicy_Reliability  reliability;               //!< qos reliability mode
+      eQOSPolicy_Delivery     delivery;                  //!< qos delivery mode
+      eQOSPolicy_Overflow     overflow;                  //!< qos receive queue overflow policy
     };
   }
 }
@@ -120,6 +120,20 @@ namespace eCAL
     **/
     ECAL_API bool RemMethodCallback(const std::string& method_);
 
+    /**
+     * @brief Serialize the execution of a method.
+     *
+     * Method calls of different clients are executed concurrently (by the service worker threads,
+     * see experimental/service_server_worker_threads). Calls of a serialized method are executed
+     * one after another, while all other methods are still executed concurrently to them.
+     *
+     * @param method_      Service method name.
+     * @param serialized_  Execute the method calls one after another (default = false).
+     *
+     * @return  True if successful.
+    **/
+    ECAL_API bool SetMethodSerialization(const std::string& method_, bool serialized_);
+
     /**
      * @brief Add server event callback function.
      *
@@ -27,6 +27,7 @@
 #include <ecal/cimpl/ecal_service_info_cimpl.h>
 
 #include <functional>
+#include <future>
 #include <string>
 #include <vector>
 
@@ -53,6 +54,10 @@ namespace eCAL
   };
   typedef std::vector<SServiceResponse> ServiceResponseVecT; //!< vector of multiple service responses
 
+  typedef std::future<SServiceResponse>       ServiceResponseFutureT;     //!< future service response of a single called service
+  typedef std::vector<ServiceResponseFutureT> ServiceResponseFutureVecT;  //!< future service responses of all called services
+  typedef unsigned long long                  ServiceCallIdT;             //!< id of an asynchronous service call (used for cancellation)
+
   /**
    * @brief Service method callback function type (low level server interface).
    *
@@ -34,11 +34,23 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace eCAL
 {
   class CDataReader;
 
+  /**
+   * @brief Sample returned by CSubscriber::ReceiveBatch.
+  **/
+  struct SReceivedSample
+  {
+    std::string buf;                    //!< payload
+    long long   id    = 0;              //!< source id
+    long long   clock = 0;              //!< source write clock
+    long long   time  = 0;              //!< source time stamp
+  };
+
   /**
    * @brief eCAL subscriber class.
    *
@@ -256,6 +268,20 @@ namespace eCAL
     **/
     ECAL_API bool ReceiveBuffer(std::string& buf_, long long* time_ = nullptr, int rcv_timeout_ = 0) const;
 
+    /**
+     * @brief Receive all messages since the last receive call (oldest first).
+     *
+     * Without a receive callback the subscriber keeps the last QOS::SReaderQOS::history_kind_depth samples.
+     * The payload buffers are swapped out of the subscriber, so reusing samples_ from call to call avoids allocations.
+     * ReceiveBuffer and ReceiveBatch share these samples (ReceiveBuffer returns the newest one and discards the others).
+     *
+     * @param [out] samples_  Received samples (resized to the number of samples).
+     * @param rcv_timeout_    Maximum time to wait for the first sample (in milliseconds, 0 means no wait, -1 means infinite).
+     *
+     * @return  Number of received samples.
+    **/
+    ECAL_API size_t ReceiveBatch(std::vector<SReceivedSample>& samples_, int rcv_timeout_ = 0) const;
+
     /**
      * @brief Add callback function for incoming receives. 
      *
@@ -272,6 +298,29 @@ namespace eCAL
     **/
     ECAL_API bool RemReceiveCallback();
 
+    /**
+     * @brief Add callback function for incoming receives, that hands out a read only sample view.
+     *
+     * The view can be stored and passed to other threads, the payload stays valid until the
+     * last reference to the view is released. For shared memory samples of publishers with
+     * zero copy mode (see CPublisher::ShmEnableZeroCopy) and multiple memory file buffers
+     * (see CPublisher::ShmSetBufferCount) the view points into the memory file without copying
+     * and keeps it locked, the publisher continues writing to its other buffers meanwhile.
+     * With a single buffer the view owns a copy of the payload.
+     *
+     * @param callback_  The callback function to add.
+     *
+     * @return  True if succeeded, false if not.
+    **/
+    ECAL_API bool AddReceiveViewCallback(ReceiveViewCallbackT callback_);
+
+    /**
+     * @brief Remove receive view callback function.
+     *
+     * @return  True if succeeded, false if not.
+    **/
+    ECAL_API bool RemReceiveViewCallback();
+
     /**
      * @brief Add callback function for subscriber events.
      *
@@ -305,6 +354,14 @@ namespace eCAL
     **/
     ECAL_API size_t GetPublisherCount() const;
 
+    /**
+     * @brief Query the number of samples dropped because the receive queue was full
+     *        (asynchronous delivery qos only, see QOS::SReaderQOS::overflow).
+     *
+     * @return  Number of dropped samples.
+    **/
+    ECAL_API size_t GetQueueDropCount() const;
+
     /**
      * @brief Gets name of the connected topic. 
      *
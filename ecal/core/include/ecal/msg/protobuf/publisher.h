@@ -33,15 +33,18 @@
 #ifdef _MSC_VER
 #pragma warning(push, 0) // disable proto warnings
 #endif
+#include <google/protobuf/arena.h>
 #include <google/protobuf/descriptor.pb.h>
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
 
 // stl includes
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace eCAL
 {
@@ -60,7 +63,7 @@ namespace eCAL
       {
       public:
         CPayload(const google::protobuf::Message& message_) :
-          message(message_) {};
+          message(message_), size(0), size_valid(false) {};
 
         ~CPayload() override = default;
 
@@ -72,21 +75,36 @@ namespace eCAL
 
         bool WriteFull(void* buf_, size_t len_) override
         {
+#if GOOGLE_PROTOBUF_VERSION >= 3001000
+          // the message sizes are computed (and cached in the message) once by GetSize,
+          // so serialize directly into the target buffer without a second size pass
+          const size_t msg_size = GetSize();
+          if (len_ < msg_size) return false;
+          auto* const target = static_cast<uint8_t*>(buf_);
+          const uint8_t* const end = message.SerializeWithCachedSizesToArray(target);
+          return static_cast<size_t>(end - target) == msg_size;
+#else
           return message.SerializeToArray(buf_, static_cast<int>(len_));
+#endif
         }
 
         size_t GetSize() override {
-          size_t size(0);
+          if (!size_valid)
+          {
 #if GOOGLE_PROTOBUF_VERSION >= 3001000
-          size = static_cast<size_t>(message.ByteSizeLong());
+            size = static_cast<size_t>(message.ByteSizeLong());
 #else
-          size = static_cast<size_t>(message.ByteSize());
+            size = static_cast<size_t>(message.ByteSize());
 #endif
+            size_valid = true;
+          }
           return(size);
           };
 
       private:
         const google::protobuf::Message& message;
+        size_t                           size;
+        bool                             size_valid;
       };
 
     public:
@@ -171,6 +189,36 @@ namespace eCAL
         return(0);
       }
 
+      /**
+       * @brief  Create a message on the arena of this publisher.
+       *
+       * Arena messages are allocated from larger memory blocks and are not freed one by one,
+       * which makes building large messages (many repeated fields) considerably cheaper.
+       * They can be sent like any other message and stay valid until ResetArena is called.
+       *
+       * @return  The message object (owned by the arena).
+      **/
+      T* CreateArenaMessage()
+      {
+        if (m_arena == nullptr) m_arena = std::make_unique<SArena>();
+#if GOOGLE_PROTOBUF_VERSION >= 5026000
+        return google::protobuf::Arena::Create<T>(&m_arena->arena);
+#else
+        return google::protobuf::Arena::CreateMessage<T>(&m_arena->arena);
+#endif
+      }
+
+      /**
+       * @brief  Free all messages created by CreateArenaMessage at once.
+       *
+       * The arena keeps its initial memory block (owned by this publisher), so recreating
+       * messages that fit into this block afterwards does not allocate.
+      **/
+      void ResetArena()
+      {
+        if (m_arena != nullptr) m_arena->arena.Reset();
+      }
+
 
       /**
        * @brief  Get type name of the protobuf message.
@@ -213,6 +261,24 @@ namespace eCAL
         return topic_info;
       }
 
+      // arena with a user provided initial block, the arena never frees this block
+      // (the block is declared first, so it outlives the arena)
+      struct SArena
+      {
+        SArena() : block(64 * 1024), arena(Options(block)) {}
+
+        static google::protobuf::ArenaOptions Options(std::vector<char>& block_)
+        {
+          google::protobuf::ArenaOptions options;
+          options.initial_block      = block_.data();
+          options.initial_block_size = block_.size();
+          return options;
+        }
+
+        std::vector<char>       block;
+        google::protobuf::Arena arena;
+      };
+      std::unique_ptr<SArena> m_arena;
     };
     /** @example person_snd.cpp
     * This is an example how to use eCAL::CPublisher to send google::protobuf data with eCAL. To receive the data, see @ref person_rec.cpp .
@@ -144,6 +144,7 @@ namespace eCAL
       bool Deserialize(T& msg_, const void* buffer_, size_t size_) const override
       {
         // we try to parse the message from the received buffer
+        // (the message is cleared first, its allocated memory is kept for reuse, see SetMessageReuse)
         if (msg_.ParseFromArray(buffer_, static_cast<int>(size_)))
         {
           return(true);
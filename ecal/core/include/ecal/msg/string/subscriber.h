@@ -129,7 +129,7 @@ namespace eCAL
       **/
       bool Deserialize(T& msg_, const void* buffer_, size_t size_) const override
       {
-        msg_ = std::string(static_cast<const char*>(buffer_), size_);
+        msg_.assign(static_cast<const char*>(buffer_), size_);
         return true;
       }
 
@@ -31,6 +31,7 @@
 #include <cassert>
 #include <cstring>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -95,6 +96,7 @@ namespace eCAL
     CMsgSubscriber(CMsgSubscriber&& rhs)
       : CSubscriber(std::move(rhs))
       , m_cb_callback(std::move(rhs.m_cb_callback))
+      , m_reuse_msg(std::move(rhs.m_reuse_msg))
     {
       bool has_callback = (m_cb_callback != nullptr);
 
@@ -115,6 +117,7 @@ namespace eCAL
       CSubscriber::operator=(std::move(rhs));
 
       m_cb_callback = std::move(rhs.m_cb_callback);
+      m_reuse_msg   = std::move(rhs.m_reuse_msg);
       bool has_callback(m_cb_callback != nullptr);
 
       if (has_callback)
@@ -232,6 +235,23 @@ namespace eCAL
       return(ret);
     }
 
+    /**
+     * @brief  Reuse one message object for all samples passed to the receive callback.
+     *
+     * By default a new message object is constructed for every received sample. With reuse enabled
+     * the samples are deserialized into the same object, so its allocated memory (strings, repeated fields)
+     * is reused. Deserialize has to replace the complete message content then (protobuf does) and
+     * the callback must not keep references to the message after it returned.
+     *
+     * @param state_  Enable / disable message reuse.
+    **/
+    void SetMessageReuse(bool state_)
+    {
+      std::lock_guard<std::mutex> callback_lock(m_cb_callback_mutex);
+      if (!state_)                      m_reuse_msg.reset();
+      else if (m_reuse_msg == nullptr)  m_reuse_msg = std::make_shared<T>();
+    }
+
 protected:
     ECAL_DEPRECATE_SINCE_5_13("Please use SDataTypeInformation GetDataTypeInformation() instead. This function will be removed in future eCAL versions.")
     virtual std::string GetTypeName() const
@@ -254,13 +274,25 @@ protected:
     void ReceiveCallback(const char* topic_name_, const struct eCAL::SReceiveCallbackData* data_)
     {
       MsgReceiveCallbackT fn_callback = nullptr;
+      std::shared_ptr<T>  reuse_msg;
       {
         std::lock_guard<std::mutex> callback_lock(m_cb_callback_mutex);
         fn_callback = m_cb_callback;
+        reuse_msg   = m_reuse_msg;
       }
 
       if(fn_callback == nullptr) return;
 
+      // deserialize into the reused message object (receive callbacks of one subscriber are never called in parallel)
+      if (reuse_msg != nullptr)
+      {
+        if (Deserialize(*reuse_msg, data_->buf, data_->size))
+        {
+          (fn_callback)(topic_name_, *reuse_msg, data_->time, data_->clock, data_->id);
+        }
+        return;
+      }
+
       T msg;
       if(Deserialize(msg, data_->buf, data_->size))
       {
@@ -270,5 +302,6 @@ protected:
 
     std::mutex          m_cb_callback_mutex;
     MsgReceiveCallbackT m_cb_callback;
+    std::shared_ptr<T>  m_reuse_msg;
   };
 }
@@ -122,6 +122,8 @@ namespace eCAL
     ECAL_API int               GetUdpMulticastRcvBufSizeBytes       () { return eCALPAR(NET, UDP_MULTICAST_RCVBUF); }
     ECAL_API bool              IsUdpMulticastJoinAllIfEnabled       () { return eCALPAR(NET, UDP_MULTICAST_JOIN_ALL_IF_ENABLED); }
 
+    ECAL_API int               GetUdpMulticastMaxMessageSizeBytes   () { return eCALPAR(NET, UDP_REASSEMBLY_MAX_MESSAGE_SIZE); }
+
 
     ECAL_API int               GetMaxUdpBandwidthBytesPerSecond     () { return eCALPAR(NET, BANDWIDTH_MAX_UDP); }
 
@@ -181,6 +183,7 @@ namespace eCAL
     ECAL_API int               GetMemfileAckTimeoutMs               () { return eCALPAR(PUB, MEMFILE_ACK_TO); }
     ECAL_API bool              IsMemfileZerocopyEnabled             () { return (eCALPAR(PUB, MEMFILE_ZERO_COPY) != 0); }
     ECAL_API size_t            GetMemfileBufferCount                () { return static_cast<size_t>(eCALPAR(PUB, MEMFILE_BUF_COUNT)); }
+    ECAL_API size_t            GetMemfileRingSlotCount              () { return static_cast<size_t>(eCALPAR(PUB, MEMFILE_RING_SLOTS)); }
 
     ECAL_API bool              IsTopicTypeSharingEnabled            () { return (eCALPAR(PUB, SHARE_TTYPE) != 0); }
     ECAL_API bool              IsTopicDescriptionSharingEnabled     () { return (eCALPAR(PUB, SHARE_TDESC) != 0); }
@@ -202,6 +205,15 @@ namespace eCAL
       ECAL_API size_t            GetShmMonitoringQueueSize          () { return static_cast<size_t>(eCALPAR(EXP, SHM_MONITORING_QUEUE_SIZE)); }
       ECAL_API std::string       GetShmMonitoringDomain             () { return eCALPAR(EXP, SHM_MONITORING_DOMAIN);}
       ECAL_API bool              GetDropOutOfOrderMessages          () { return eCALPAR(EXP, DROP_OUT_OF_ORDER_MESSAGES); }
+      ECAL_API size_t            GetShmObserverThreadCount          () { return static_cast<size_t>(eCALPAR(EXP, SHM_OBSERVER_THREADS)); }
+      ECAL_API bool              IsUdpRawSampleFormatEnabled        () { return eCALPAR(EXP, UDP_RAW_SAMPLES); }
+      ECAL_API bool              IsDeltaRegistrationEnabled         () { return eCALPAR(EXP, REGISTRATION_DELTA); }
+      ECAL_API bool              IsDescriptorInterningEnabled       () { return eCALPAR(EXP, REGISTRATION_DESC_INTERNING); }
+      ECAL_API size_t            GetSubscriberDispatcherThreadCount () { return static_cast<size_t>(eCALPAR(EXP, SUB_DISPATCHER_THREADS)); }
+      ECAL_API size_t            GetServiceServerWorkerThreadCount  () { return static_cast<size_t>(eCALPAR(EXP, SERVICE_SERVER_WORKER_THREADS)); }
+      ECAL_API bool              IsServiceShmTransportEnabled       () { return eCALPAR(EXP, SERVICE_SHM_TRANSPORT); }
+      ECAL_API size_t            GetServiceShmChannelCount          () { return static_cast<size_t>(eCALPAR(EXP, SERVICE_SHM_CHANNELS)); }
+      ECAL_API size_t            GetServiceShmChannelSize           () { return static_cast<size_t>(eCALPAR(EXP, SERVICE_SHM_CHANNEL_SIZE)); }
     }
   }
 }
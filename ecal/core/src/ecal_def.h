@@ -80,6 +80,10 @@
 
 #define NET_UDP_RECBUFFER_TIMEOUT                  1000  /* ms */
 #define NET_UDP_RECBUFFER_CLEANUP                  10    /* ms */
+#define NET_UDP_RECEIVE_BATCH_SIZE                 16    /* datagrams fetched per receive call (linux recvmmsg) */
+#define NET_UDP_REASSEMBLY_MAX_MESSAGES            64    /* fragmented messages reassembled in parallel */
+#define NET_UDP_REASSEMBLY_MAX_MESSAGE_SIZE        (256*1024*1024)  /* larger fragmented messages are dropped (network/multicast_max_message_size) */
+#define NET_UDP_REASSEMBLY_MAX_POOL_SIZE           (64*1024*1024)   /* free reassembly buffers kept for reuse */
 
 /* overall udp multicast bandwidth limitation in bytes/s, -1 == no limitation*/
 #define NET_BANDWIDTH_MAX_UDP                      (-1)
@@ -142,6 +146,17 @@
 */
 #define PUB_MEMFILE_ZERO_COPY                      0
 
+/* defines number of slots of a lock-free memory file ring (0 = off, single buffer with mutex access)
+   the publisher writes into the next slot without waiting for any subscriber, slow subscribers
+   are losing the oldest samples instead of blocking the publisher
+   ring files are only visible to subscribers of the same or a newer eCAL version
+*/
+#define PUB_MEMFILE_RING_SLOTS                     0
+
+/* minimum period of the thread flushing partly filled batch frames in us,
+   the write path flushes a frame as soon as its time window elapsed anyway */
+#define PUB_BATCH_FLUSH_PERIOD_MIN_US              1000
+
 /**********************************************************************************************/
 /*                                     service settings                                       */
 /**********************************************************************************************/
@@ -177,6 +192,15 @@
 /* cylce time udp receive threads in ms */
 #define CMN_UDP_RECEIVE_THREAD_CYCLE_TIME_MS           1000
 
+/* wait slice of the shared memory service transport threads (stop / server loss detection) in ms */
+#define CMN_SERVICE_SHM_WAIT_TIMEOUT_MS                100
+
+/* delay before a service client retries to claim a shared memory channel in ms */
+#define CMN_SERVICE_SHM_RETRY_MS                       1000
+
+/* time the shared memory service transport threads poll for a wakeup before they block in us */
+#define CMN_SERVICE_SHM_SPIN_US                        50
+
 /**********************************************************************************************/
 /*                                     events                                                 */
 /**********************************************************************************************/
@@ -196,6 +220,26 @@
 #define EXP_SHM_MONITORING_DOMAIN                  "ecal_monitoring"
 /* memory file access timeout */
 #define EXP_MEMFILE_ACCESS_TIMEOUT                 100
+/* number of worker threads serving all subscribed memory files of a process (0 = one thread per memory file) */
+#define EXP_SHM_OBSERVER_THREADS                   0
+/* number of updated memory files a pooled observer process can queue between two dispatches */
+#define EXP_SHM_OBSERVER_QUEUE_SIZE                1024
+/* send udp payload samples with a fixed layout binary header instead of a protobuf sample */
+#define EXP_UDP_RAW_SAMPLES                        false
+/* send full registrations only on change (or on request) and heartbeats otherwise */
+#define EXP_REGISTRATION_DELTA                     false
+/* send topic registrations with a descriptor hash only, receivers fetch unknown descriptors on demand */
+#define EXP_REGISTRATION_DESC_INTERNING            false
+/* number of threads delivering samples to subscribers with asynchronous delivery qos */
+#define EXP_SUB_DISPATCHER_THREADS                 1
+/* number of threads executing service server method callbacks (0 = callbacks are executed by the service io threads) */
+#define EXP_SERVICE_SERVER_WORKER_THREADS          0
+/* call services on the same host via shared memory instead of loopback tcp */
+#define EXP_SERVICE_SHM_TRANSPORT                  false
+/* number of clients a service can serve via shared memory at the same time */
+#define EXP_SERVICE_SHM_CHANNELS                   8
+/* maximum request size (and response chunk size) of a shared memory service channel [Bytes] */
+#define EXP_SERVICE_SHM_CHANNEL_SIZE               (64*1024)
 
 /* enable dropping of payload messages that arrive out of order */
 #define EXP_DROP_OUT_OF_ORDER_MESSAGES             false
@@ -48,6 +48,8 @@
 
 #define  NET_UDP_MULTICAST_JOIN_ALL_IF_ENABLED_S   "multicast_join_all_if"
 
+#define  NET_UDP_REASSEMBLY_MAX_MESSAGE_SIZE_S     "multicast_max_message_size"
+
 #define  NET_BANDWIDTH_MAX_UDP_S                   "bandwidth_max_udp"
 
 #define  NET_UDP_MC_REC_ENABLED_S                  "udp_mc_rec_enabled"
@@ -110,6 +112,7 @@
 #define  PUB_MEMFILE_ACK_TO_S                      "memfile_ack_timeout"
 #define  PUB_MEMFILE_ZERO_COPY_S                   "memfile_zero_copy"
 #define  PUB_MEMFILE_BUF_COUNT_S                   "memfile_buffer_count"
+#define  PUB_MEMFILE_RING_SLOTS_S                  "memfile_ring_slots"
 
 #define  PUB_SHARE_TTYPE_S                         "share_ttype"
 #define  PUB_SHARE_TDESC_S                         "share_tdesc"
@@ -132,3 +135,12 @@
 #define  EXP_SHM_MONITORING_QUEUE_SIZE_S           "shm_monitoring_queue_size"
 #define  EXP_SHM_MONITORING_DOMAIN_S               "shm_monitoring_domain"
 #define  EXP_DROP_OUT_OF_ORDER_MESSAGES_S          "drop_out_of_order_messages"
+#define  EXP_SHM_OBSERVER_THREADS_S                "shm_observer_threads"
+#define  EXP_UDP_RAW_SAMPLES_S                     "udp_raw_samples"
+#define  EXP_REGISTRATION_DELTA_S                  "registration_delta"
+#define  EXP_REGISTRATION_DESC_INTERNING_S         "registration_desc_interning"
+#define  EXP_SUB_DISPATCHER_THREADS_S              "subscriber_dispatcher_threads"
+#define  EXP_SERVICE_SERVER_WORKER_THREADS_S       "service_server_worker_threads"
+#define  EXP_SERVICE_SHM_TRANSPORT_S               "service_shm_transport"
+#define  EXP_SERVICE_SHM_CHANNELS_S                "service_shm_channels"
+#define  EXP_SERVICE_SHM_CHANNEL_SIZE_S            "service_shm_channel_size"
@@ -38,7 +38,8 @@ namespace eCAL
 {
   CDescGate::CDescGate() :
     m_topic_info_map  (std::chrono::milliseconds(Config::GetMonitoringTimeoutMs())),
-    m_service_info_map(std::chrono::milliseconds(Config::GetMonitoringTimeoutMs()))
+    m_service_info_map(std::chrono::milliseconds(Config::GetMonitoringTimeoutMs())),
+    m_descriptor_store(std::chrono::milliseconds(Config::GetMonitoringTimeoutMs()))
   {
   }
   CDescGate::~CDescGate() = default;
@@ -63,7 +64,7 @@ namespace eCAL
     {
       // create a new topic entry
       STopicInfoQuality& topic_info = (*m_topic_info_map.map)[topic_name_];
-      topic_info.info               = topic_info_;
+      topic_info.info               = Intern(topic_info_);
       topic_info.quality            = description_quality_;
       return true;
     }
@@ -83,7 +84,7 @@ namespace eCAL
     if (description_quality_ > topic_info.quality)
     {
       // overwrite attributes
-      topic_info.info    = topic_info_;
+      topic_info.info    = Intern(topic_info_);
       topic_info.quality = description_quality_;
 
       // update attributes and return
@@ -92,7 +93,7 @@ namespace eCAL
     }
 
     // this is the same topic (topic name, topic type name, topic type description)
-    if (topic_info.info == topic_info_)
+    if (topic_info.info.IsEqual(topic_info_))
     {
       // update timestamp (by just accessing the entry) and return
       (*m_topic_info_map.map)[topic_name_] = topic_info;
@@ -168,8 +169,8 @@ namespace eCAL
     // topic type description differs
     // we log the error and update the entry one time
     if ( !topic_info_.descriptor.empty()
-      && !topic_info.info.descriptor.empty()
-      && (topic_info.info.descriptor != topic_info_.descriptor)
+      && topic_info.info.descriptor
+      && (*topic_info.info.descriptor != topic_info_.descriptor)
       )
     {
       std::string msg = "eCAL Pub/Sub description mismatch for topic ";
@@ -201,7 +202,7 @@ namespace eCAL
 
     for (const auto& topic_info : (*m_topic_info_map.map))
     {
-      map.emplace(topic_info.first, topic_info.second.info);
+      map.emplace(topic_info.first, topic_info.second.info.ToDataTypeInformation());
     }
     topic_info_map_.swap(map);
   }
@@ -229,7 +230,7 @@ namespace eCAL
     const auto topic_info_it = m_topic_info_map.map->find(topic_name_);
 
     if (topic_info_it == m_topic_info_map.map->end()) return(false);
-    topic_info_ = (*topic_info_it).second.info;
+    topic_info_ = (*topic_info_it).second.info.ToDataTypeInformation();
     return(true);
   }
   
@@ -249,8 +250,8 @@ namespace eCAL
     {
       // create a new service entry
       SServiceMethodInfoQuality& service_info = (*m_service_info_map.map)[service_method_tuple];
-      service_info.info.request_type   = request_type_information_;
-      service_info.info.response_type  = response_type_information_;
+      service_info.request_type        = Intern(request_type_information_);
+      service_info.response_type       = Intern(response_type_information_);
       service_info.quality             = description_quality_;
       return true;
     }
@@ -261,8 +262,8 @@ namespace eCAL
     SServiceMethodInfoQuality service_info = (*service_info_map_it).second;
     if (description_quality_ > service_info.quality)
     {
-      service_info.info.request_type   =  request_type_information_;
-      service_info.info.response_type  = response_type_information_;
+      service_info.request_type        = Intern(request_type_information_);
+      service_info.response_type       = Intern(response_type_information_);
       service_info.quality             = description_quality_;
       ret_value = true;
     }
@@ -282,7 +283,10 @@ namespace eCAL
 
     for (const auto& service_info : (*m_service_info_map.map))
     {
-      map.emplace(service_info.first, service_info.second.info);
+      SServiceMethodInformation service_method_info;
+      service_method_info.request_type  = service_info.second.request_type.ToDataTypeInformation();
+      service_method_info.response_type = service_info.second.response_type.ToDataTypeInformation();
+      map.emplace(service_info.first, service_method_info);
     }
     service_info_map_.swap(map);
   }
@@ -310,8 +314,8 @@ namespace eCAL
     auto service_info_map_it = m_service_info_map.map->find(service_method_tuple);
 
     if (service_info_map_it == m_service_info_map.map->end()) return false;
-    req_type_name_  = (*service_info_map_it).second.info.request_type.name;
-    resp_type_name_ = (*service_info_map_it).second.info.response_type.name;
+    req_type_name_  = (*service_info_map_it).second.request_type.name;
+    resp_type_name_ = (*service_info_map_it).second.response_type.name;
     return true;
   }
 
@@ -324,8 +328,48 @@ namespace eCAL
     auto service_info_map_it = m_service_info_map.map->find(service_method_tuple);
 
     if (service_info_map_it == m_service_info_map.map->end()) return false;
-    req_type_desc_  = (*service_info_map_it).second.info.request_type.descriptor;
-    resp_type_desc_ = (*service_info_map_it).second.info.response_type.descriptor;
+    const auto& service_info = (*service_info_map_it).second;
+    req_type_desc_  = service_info.request_type.descriptor  ? *service_info.request_type.descriptor  : std::string();
+    resp_type_desc_ = service_info.response_type.descriptor ? *service_info.response_type.descriptor : std::string();
     return true;
   }
+
+  uint64_t CDescGate::ApplyDescriptor(const std::string& descriptor_)
+  {
+    const CDescriptorStore::DescriptorT descriptor = m_descriptor_store.Intern(descriptor_);
+    return (descriptor != nullptr) ? CDescriptorStore::GetHash(*descriptor) : 0;
+  }
+
+  bool CDescGate::GetDescriptor(uint64_t descriptor_hash_, std::string& descriptor_)
+  {
+    const CDescriptorStore::DescriptorT descriptor = m_descriptor_store.Find(descriptor_hash_);
+    if (descriptor == nullptr) return false;
+    descriptor_ = *descriptor;
+    return true;
+  }
+
+  CDescGate::SInternedDataTypeInformation CDescGate::Intern(const SDataTypeInformation& datatype_info_)
+  {
+    SInternedDataTypeInformation interned_info;
+    interned_info.name       = datatype_info_.name;
+    interned_info.encoding   = datatype_info_.encoding;
+    interned_info.descriptor = m_descriptor_store.Intern(datatype_info_.descriptor);
+    return interned_info;
+  }
+
+  bool CDescGate::SInternedDataTypeInformation::IsEqual(const SDataTypeInformation& other_) const
+  {
+    if ((name != other_.name) || (encoding != other_.encoding)) return false;
+    if (descriptor == nullptr) return other_.descriptor.empty();
+    return *descriptor == other_.descriptor;
+  }
+
+  SDataTypeInformation CDescGate::SInternedDataTypeInformation::ToDataTypeInformation() const
+  {
+    SDataTypeInformation datatype_info;
+    datatype_info.name     = name;
+    datatype_info.encoding = encoding;
+    if (descriptor != nullptr) datatype_info.descriptor = *descriptor;
+    return datatype_info;
+  }
 }
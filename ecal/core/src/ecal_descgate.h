@@ -29,6 +29,7 @@
 
 #include "ecal_global_accessors.h"
 #include "ecal_def.h"
+#include "ecal_descriptor_store.h"
 #include "util/ecal_expmap.h"
 
 #include <map>
@@ -85,17 +86,36 @@ namespace eCAL
     bool GetServiceTypeNames(const std::string& service_name_, const std::string& method_name_, std::string& req_type_name_, std::string& resp_type_name_);
     bool GetServiceDescription(const std::string& service_name_, const std::string& method_name_, std::string& req_type_desc_, std::string& resp_type_desc_);
 
+    // descriptor interning, add a descriptor to the store (e.g. fetched from another process)
+    uint64_t ApplyDescriptor(const std::string& descriptor_);
+    // descriptor interning, find a descriptor by its content hash
+    bool GetDescriptor(uint64_t descriptor_hash_, std::string& descriptor_);
+
   protected:
+    // datatype information with its descriptor shared with all other topics / services of the same type
+    struct SInternedDataTypeInformation
+    {
+      std::string                   name;
+      std::string                   encoding;
+      CDescriptorStore::DescriptorT descriptor;
+
+      bool IsEqual(const SDataTypeInformation& other_) const;
+      SDataTypeInformation ToDataTypeInformation() const;
+    };
+
+    SInternedDataTypeInformation Intern(const SDataTypeInformation& datatype_info_);
+
     struct STopicInfoQuality
     {
-      SDataTypeInformation info;                                                       //!< Topic info struct with type encoding, name and descriptor.
+      SInternedDataTypeInformation info;                                               //!< Topic info struct with type encoding, name and (shared) descriptor.
       QualityFlags         quality               = QualityFlags::NO_QUALITY;           //!< QualityFlags to determine whether we may overwrite the current data with better one. E.g. we prefer the description sent by a publisher over one sent by a subscriber. 
       bool                 type_missmatch_logged = false;                              //!< Whether we have already logged a type-missmatch
     };
 
     struct SServiceMethodInfoQuality
     {
-      SServiceMethodInformation info;                                               //!< Service info struct with type names and descriptors for request and response.
+      SInternedDataTypeInformation request_type;                                    //!< Request type name and (shared) descriptor.
+      SInternedDataTypeInformation response_type;                                   //!< Response type name and (shared) descriptor.
       QualityFlags             quality = QualityFlags::NO_QUALITY;                 //!< The Quality of the Info
     };
 
@@ -124,6 +144,9 @@ namespace eCAL
       std::unique_ptr<ServiceMethodInfoMap> map;                                   //!< Map containing information about each known service
     };
     SServiceMethodInfoMap m_service_info_map;
+
+    // key: descriptor hash | value: descriptor (deduplicated over all topics and services)
+    CDescriptorStore m_descriptor_store;
   };
 
   constexpr inline CDescGate::QualityFlags  operator~  (CDescGate::QualityFlags  a)                            { return static_cast<CDescGate::QualityFlags>( ~static_cast<std::underlying_type<CDescGate::QualityFlags>::type>(a) ); }
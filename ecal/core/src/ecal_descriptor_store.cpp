@@ -0,0 +1,106 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL content addressed datatype descriptor store
+**/
+
+#include "ecal_descriptor_store.h"
+
+namespace eCAL
+{
+  CDescriptorStore::CDescriptorStore(const std::chrono::milliseconds& timeout_) :
+    m_timeout(timeout_)
+  {
+  }
+
+  uint64_t CDescriptorStore::GetHash(const std::string& descriptor_)
+  {
+    if (descriptor_.empty()) return 0;
+
+    // 64 bit FNV-1a, the hash is exchanged between processes
+    // so it has to be identical on all platforms (std::hash is not)
+    uint64_t hash(14695981039346656037ULL);
+    for (const char c : descriptor_)
+    {
+      hash ^= static_cast<uint8_t>(c);
+      hash *= 1099511628211ULL;
+    }
+
+    // 0 is reserved for "no descriptor"
+    return (hash != 0) ? hash : 1;
+  }
+
+  CDescriptorStore::DescriptorT CDescriptorStore::Intern(const std::string& descriptor_)
+  {
+    if (descriptor_.empty()) return nullptr;
+
+    const uint64_t hash = GetHash(descriptor_);
+
+    const std::lock_guard<std::mutex> lock(m_sync);
+    RemoveUnused();
+
+    SDescriptorEntry& entry = m_descriptor_map[hash];
+    entry.last_access = std::chrono::steady_clock::now();
+    if (!entry.descriptor)
+    {
+      entry.descriptor = std::make_shared<const std::string>(descriptor_);
+      return entry.descriptor;
+    }
+
+    // hash collision, keep the stored descriptor and do not share the new one
+    if (*entry.descriptor != descriptor_)
+    {
+      return std::make_shared<const std::string>(descriptor_);
+    }
+
+    return entry.descriptor;
+  }
+
+  CDescriptorStore::DescriptorT CDescriptorStore::Find(uint64_t hash_)
+  {
+    const std::lock_guard<std::mutex> lock(m_sync);
+    auto iter = m_descriptor_map.find(hash_);
+    if (iter == m_descriptor_map.end()) return nullptr;
+
+    iter->second.last_access = std::chrono::steady_clock::now();
+    return iter->second.descriptor;
+  }
+
+  size_t CDescriptorStore::Size() const
+  {
+    const std::lock_guard<std::mutex> lock(m_sync);
+    return m_descriptor_map.size();
+  }
+
+  void CDescriptorStore::RemoveUnused()
+  {
+    // called with locked m_sync
+    const auto now = std::chrono::steady_clock::now();
+    if (now - m_last_cleanup < m_timeout) return;
+    m_last_cleanup = now;
+
+    // remove descriptors that are referenced by the store only and were not accessed for a while
+    for (auto iter = m_descriptor_map.begin(); iter != m_descriptor_map.end();)
+    {
+      if ((iter->second.descriptor.use_count() == 1) && (now - iter->second.last_access > m_timeout)) iter = m_descriptor_map.erase(iter);
+      else                                                                                             ++iter;
+    }
+  }
+}
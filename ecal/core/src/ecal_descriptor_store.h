@@ -0,0 +1,88 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL content addressed datatype descriptor store
+**/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace eCAL
+{
+  /**
+   * @brief Deduplicated storage of datatype descriptors, addressed by their content hash.
+   *
+   * Every descriptor is stored once per process and shared by all topics / services using it.
+   * Descriptors that are not referenced anymore are removed after a timeout.
+  **/
+  class CDescriptorStore
+  {
+  public:
+    using DescriptorT = std::shared_ptr<const std::string>;
+
+    explicit CDescriptorStore(const std::chrono::milliseconds& timeout_);
+
+    /**
+     * @brief Stable 64 bit content hash of a descriptor (0 for an empty descriptor).
+    **/
+    static uint64_t GetHash(const std::string& descriptor_);
+
+    /**
+     * @brief Add a descriptor to the store (or find the existing one with the same content).
+     *
+     * @param descriptor_  The descriptor.
+     *
+     * @return  The shared descriptor (nullptr for an empty descriptor).
+    **/
+    DescriptorT Intern(const std::string& descriptor_);
+
+    /**
+     * @brief Find a descriptor by its content hash.
+     *
+     * @param hash_  The descriptor hash.
+     *
+     * @return  The shared descriptor (nullptr if unknown).
+    **/
+    DescriptorT Find(uint64_t hash_);
+
+    size_t Size() const;
+
+  protected:
+    void RemoveUnused();
+
+    struct SDescriptorEntry
+    {
+      DescriptorT                           descriptor;
+      std::chrono::steady_clock::time_point last_access;
+    };
+    using DescriptorMapT = std::unordered_map<uint64_t, SDescriptorEntry>;
+
+    const std::chrono::milliseconds       m_timeout;
+    mutable std::mutex                    m_sync;
+    DescriptorMapT                        m_descriptor_map;
+    std::chrono::steady_clock::time_point m_last_cleanup;
+  };
+}
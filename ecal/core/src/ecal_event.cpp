@@ -60,6 +60,20 @@ namespace eCAL
     return OpenEvent(event_, event_name_);
   }
 
+  bool gOpenExistingNamedEvent(eCAL::EventHandleT* event_, const std::string& event_name_)
+  {
+    if(event_ == nullptr) return(false);
+    eCAL::EventHandleT event;
+    event.name   = event_name_;
+    event.handle = ::OpenEvent(EVENT_MODIFY_STATE | SYNCHRONIZE, false, event_name_.c_str());
+    if(event.handle != nullptr)
+    {
+      *event_ = event;
+      return(true);
+    }
+    return(false);
+  }
+
   bool gOpenUnnamedEvent(eCAL::EventHandleT* event_)
   {
     return OpenEvent(event_, "");
@@ -113,170 +127,42 @@ namespace eCAL
 
 #ifdef ECAL_OS_LINUX
 
-#include <fcntl.h>
-#include <sys/stat.h>
-#include <sys/time.h>
-#include <sys/types.h>
-#include <sys/mman.h>
-#include <fcntl.h>
-#include <semaphore.h>
-#include <pthread.h>
-#include <unistd.h>
 #include <time.h>
 #include <mutex>
 #include <condition_variable>
 
+#ifdef ECAL_USE_FUTEX_EVENT
+#include "io/evt/linux/ecal_named_event_futex.h"
+#else
+#include "io/evt/linux/ecal_named_event_pthread.h"
+#endif
+
 namespace
 {
-  struct alignas(8) named_event
-  {
-    pthread_mutex_t mtx;
-    pthread_cond_t  cvar;
-    uint8_t         set;
-  };
-  typedef struct named_event named_event_t;
-
-  named_event_t* named_event_create(const char* event_name_)
-  {
-    // create shared memory file
-    int previous_umask = umask(000);  // set umask to nothing, so we can create files with all possible permission bits
-    int fd = ::shm_open(event_name_, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
-    umask(previous_umask);            // reset umask to previous permissions
-    if (fd < 0) return nullptr;
-
-    // set size to size of named mutex struct 
-    if(ftruncate(fd, sizeof(named_event_t)) == -1)
-    {
-      ::close(fd);
-      return nullptr;
-    }
-
-    // create mutex
-    pthread_mutexattr_t shmtx;
-    pthread_mutexattr_init(&shmtx);
-    pthread_mutexattr_setpshared(&shmtx, PTHREAD_PROCESS_SHARED);
-
-    // create condition variable
-    pthread_condattr_t  shattr;
-    pthread_condattr_init(&shattr);
-    pthread_condattr_setpshared(&shattr, PTHREAD_PROCESS_SHARED);
-#ifndef ECAL_OS_MACOS
-    pthread_condattr_setclock(&shattr, CLOCK_MONOTONIC);
-#endif // ECAL_OS_MACOS
-    named_event_t* evt = static_cast<named_event_t*>(mmap(nullptr, sizeof(named_event_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
-    ::close(fd);
-
-    // map them into shared memory
-    pthread_mutex_init(&evt->mtx, &shmtx);
-    pthread_cond_init(&evt->cvar, &shattr);
-
-    // start with unset state
-    evt->set = 0;
-
-    return evt;
-  }
-
-  int named_event_destroy(const char* event_name_)
-  {
-    // destroy (unlink) shared memory file
-    return(::shm_unlink(event_name_));
-  }
-
-  named_event_t* named_event_open(const char* event_name_)
-  {
-    // try to open existing shared memory file
-    int fd = ::shm_open(event_name_, O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
-    if (fd < 0) return nullptr;
-
-    // map file content to mutex
-    named_event_t* evt = static_cast<named_event_t*>(mmap(nullptr, sizeof(named_event_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
-    ::close(fd);
-
-    return evt;
-  }
-
-  void named_event_close(named_event_t* evt_)
-  {
-    // unmap condition mutex from shared memory file
-    munmap(static_cast<void*>(evt_), sizeof(named_event_t));
-  }
-
-  void named_event_set(named_event_t* evt_)
-  {
-    // lock condition mutex
-    pthread_mutex_lock(&evt_->mtx);
-    // set state
-    evt_->set = 1;
-    // signal change
-    pthread_cond_signal(&evt_->cvar);
-    // unlock condition mutex
-    pthread_mutex_unlock(&evt_->mtx);
-  }
-
-  bool named_event_wait(named_event_t* evt_, struct timespec* ts_)
-  {
-    // lock condition mutex
-    pthread_mutex_lock(&evt_->mtx);
-    // state is set ?, fine !
-    if (evt_->set)
-    {
-      // reset state
-      evt_->set = 0;
-      // unlock condition mutex
-      pthread_mutex_unlock(&evt_->mtx);
-      // return success
-      return true;
-    }
-    // state is not set
-    else
-    {
-      // while condition wait did not return failure (or timeout) and
-      // state is still locked by another one
-      int ret(0);
-      while ((ret == 0) && (evt_->set == 0))
-      {
-        // wait with timeout for unlock signal
-        if (ts_)
-        {
-#ifndef ECAL_OS_MACOS
-            ret = pthread_cond_timedwait(&evt_->cvar, &evt_->mtx, ts_);
+#ifdef ECAL_USE_FUTEX_EVENT
+  // different memory file name, futex and pthread events have incompatible layouts
+  const char* const named_event_suffix = "_fevt";
+
+  typedef futex_event_t event_t;
+  event_t* event_create(const char* event_name_)              { return eCAL::futex_event_create(event_name_); }
+  int      event_destroy(const char* event_name_)             { return eCAL::futex_event_destroy(event_name_); }
+  event_t* event_open(const char* event_name_)                { return eCAL::futex_event_open(event_name_); }
+  void     event_close(event_t* evt_)                         { eCAL::futex_event_close(evt_); }
+  void     event_set(event_t* evt_)                           { eCAL::futex_event_set(evt_); }
+  bool     event_wait(event_t* evt_, struct timespec* ts_)    { return eCAL::futex_event_wait(evt_, ts_); }
+  bool     event_trywait(event_t* evt_)                       { return eCAL::futex_event_trywait(evt_); }
 #else
-            ret = pthread_cond_timedwait_relative_np(&evt_->cvar, &evt_->mtx, ts_);
+  const char* const named_event_suffix = "_evt";
+
+  typedef named_event_t event_t;
+  event_t* event_create(const char* event_name_)              { return eCAL::named_event_create(event_name_); }
+  int      event_destroy(const char* event_name_)             { return eCAL::named_event_destroy(event_name_); }
+  event_t* event_open(const char* event_name_)                { return eCAL::named_event_open(event_name_); }
+  void     event_close(event_t* evt_)                         { eCAL::named_event_close(evt_); }
+  void     event_set(event_t* evt_)                           { eCAL::named_event_set(evt_); }
+  bool     event_wait(event_t* evt_, struct timespec* ts_)    { return eCAL::named_event_wait(evt_, ts_); }
+  bool     event_trywait(event_t* evt_)                       { return eCAL::named_event_trywait(evt_); }
 #endif
-        }
-        // blocking wait for unlock signal
-        else
-        {
-          ret = pthread_cond_wait(&evt_->cvar, &evt_->mtx);
-        }
-      }
-      // if wait (with timeout) returned successfully
-      // reset event state
-      if (ret == 0) evt_->set = 0;
-      // unlock condition mutex
-      pthread_mutex_unlock(&evt_->mtx);
-      // sucess == wait returned 0
-      return (ret == 0);
-    }
-  }
-
-  bool named_event_trywait(named_event_t* evt_)
-  {
-    bool set(false);
-    // lock condition mutex
-    pthread_mutex_lock(&evt_->mtx);
-    // check state
-    if (evt_->set)
-    {
-      // reset event state
-      evt_->set = 0;
-      set = true;
-    }
-    // unlock condition mutex
-    pthread_mutex_unlock(&evt_->mtx);
-    // return success
-    return set;
-  }
 }
 
 namespace eCAL
@@ -322,39 +208,44 @@ namespace eCAL
   class CNamedEvent
   {
   public:
-    explicit CNamedEvent(const std::string& name_, bool ownership_) :
-      m_name(name_ + "_evt"),
+    explicit CNamedEvent(const std::string& name_, bool ownership_, bool create_ = true) :
+      m_name(name_ + named_event_suffix),
       m_event(nullptr),
       m_owner(ownership_)
     {
       m_name = (m_name[0] != '/') ? "/" + m_name : m_name; // make memory file path compatible for all posix systems
-      m_event = named_event_open(m_name.c_str());
-      if(m_event == nullptr)
+      m_event = event_open(m_name.c_str());
+      if((m_event == nullptr) && create_)
       {
-        m_event = named_event_create(m_name.c_str());
+        m_event = event_create(m_name.c_str());
       }
     }
 
+    bool is_valid() const
+    {
+      return(m_event != nullptr);
+    }
+
     ~CNamedEvent()
     {
       if(m_event == nullptr) return;
-      named_event_close(m_event);
+      event_close(m_event);
       if(m_owner)
       {
-        named_event_destroy(m_name.c_str());
+        event_destroy(m_name.c_str());
       }
     }
 
     void set()
     {
       if(m_event == nullptr) return;
-      named_event_set(m_event);
+      event_set(m_event);
     }
 
     bool wait()
     {
       if(m_event == nullptr) return false;
-      return(named_event_wait(m_event, nullptr));
+      return(event_wait(m_event, nullptr));
     }
 
     bool wait(long timeout_)
@@ -365,12 +256,12 @@ namespace eCAL
       // timeout_ < 0 -> wait infinite
       if (timeout_ < 0)
       {
-        return(named_event_wait(m_event, nullptr));
+        return(event_wait(m_event, nullptr));
       }
       // timeout_ == 0 -> check state only
       else if (timeout_ == 0)
       {
-        return(named_event_trywait(m_event));
+        return(event_trywait(m_event));
       }
       // timeout_ > 0 -> wait timeout_ ms
       else
@@ -385,7 +276,7 @@ namespace eCAL
           abstime.tv_nsec -= 1000000000;
           abstime.tv_sec++;
         }
-        return(named_event_wait(m_event, &abstime));
+        return(event_wait(m_event, &abstime));
       }
     }
 
@@ -394,7 +285,7 @@ namespace eCAL
     CNamedEvent& operator=(const CNamedEvent&);  // prevent assignment
 
     std::string     m_name;
-    named_event_t*  m_event;
+    event_t*        m_event;
     bool            m_owner;
   };
 
@@ -414,6 +305,24 @@ namespace eCAL
     return false;
   }
 
+  bool gOpenExistingNamedEvent(EventHandleT* event_, const std::string& event_name_)
+  {
+    if(event_ == nullptr) return(false);
+
+    auto* named_event = new CNamedEvent(event_name_, false, false);
+    if(!named_event->is_valid())
+    {
+      delete named_event;
+      return false;
+    }
+
+    EventHandleT event;
+    event.name   = event_name_;
+    event.handle = named_event;
+    *event_ = event;
+    return true;
+  }
+
   bool gOpenUnnamedEvent(EventHandleT* event_)
   {
     if(event_ == nullptr) return(false);
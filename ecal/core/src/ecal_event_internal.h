@@ -43,6 +43,16 @@ namespace eCAL
   **/
   bool gOpenNamedEvent(eCAL::EventHandleT* event_, const std::string& event_name_, bool ownership_);
 
+  /**
+   * @brief Open an already existing named event without ownership.
+   *
+   * @param [out] event_       Returned event struct.
+   * @param       event_name_  Event name.
+   *
+   * @return  True if succeeded, false if the event does not exist.
+  **/
+  bool gOpenExistingNamedEvent(eCAL::EventHandleT* event_, const std::string& event_name_);
+
   /**
    * @brief Open an unnamed event.
    *
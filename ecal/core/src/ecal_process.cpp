@@ -757,6 +757,22 @@ namespace eCAL
         return false;
       }
     }
+
+    namespace internal
+    {
+      bool IsProcessAlive(int process_id_)
+      {
+        if (process_id_ <= 0) return false;
+
+        HANDLE process = OpenProcess(SYNCHRONIZE, FALSE, static_cast<DWORD>(process_id_));
+        // existing processes we are not allowed to open are alive
+        if (process == nullptr) return (GetLastError() == ERROR_ACCESS_DENIED);
+
+        const bool alive = (WaitForSingleObject(process, 0) == WAIT_TIMEOUT);
+        CloseHandle(process);
+        return alive;
+      }
+    }
   }
 }
 
@@ -1727,6 +1743,17 @@ namespace eCAL
 
       return ret_val;
     }
+
+    namespace internal
+    {
+      bool IsProcessAlive(int process_id_)
+      {
+        if (process_id_ <= 0) return false;
+
+        // signal 0 only checks the existence, EPERM is returned for processes of other users
+        return (kill(process_id_, 0) == 0) || (errno == EPERM);
+      }
+    }
   }
 }
 
@@ -38,6 +38,15 @@ namespace eCAL
        * @return  Host id or zero if failed.
       **/
       ECAL_API int GetHostID();
+
+      /**
+       * @brief  Check if a process of this host is still running.
+       *
+       * @param process_id_  Process id.
+       *
+       * @return  False if the process does not exist anymore.
+      **/
+      bool IsProcessAlive(int process_id_);
     }
   }
 }
@@ -0,0 +1,158 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL named event (futex in shared memory, linux only)
+**/
+
+#include "ecal_named_event_futex.h"
+
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+
+// a zero initialized (ftruncated) memory file is a valid, unset event
+struct alignas(8) futex_event
+{
+  std::atomic<uint32_t> state;    // 1 == set, 0 == unset
+  std::atomic<uint32_t> waiters;  // number of threads (of all processes) blocked in futex_event_wait
+};
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex word needs to be a plain 32 bit integer");
+
+namespace
+{
+  // the event is shared between processes, so we can not use the FUTEX_PRIVATE_FLAG variants
+  long futex_wait(std::atomic<uint32_t>* addr_, uint32_t expected_, const struct timespec* abstime_)
+  {
+    // FUTEX_WAIT_BITSET interprets the timeout as absolute CLOCK_MONOTONIC time
+    return syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr_), FUTEX_WAIT_BITSET, expected_, abstime_, nullptr, FUTEX_BITSET_MATCH_ANY);
+  }
+
+  long futex_wake(std::atomic<uint32_t>* addr_, int count_)
+  {
+    return syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr_), FUTEX_WAKE, count_, nullptr, nullptr, 0);
+  }
+}
+
+namespace eCAL
+{
+  futex_event_t* futex_event_create(const char* event_name_)
+  {
+    // create shared memory file
+    int previous_umask = umask(000);  // set umask to nothing, so we can create files with all possible permission bits
+    int fd = ::shm_open(event_name_, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+    umask(previous_umask);            // reset umask to previous permissions
+    if (fd < 0) return nullptr;
+
+    // set size to size of futex event struct (content is zeroed -> unset state)
+    if (ftruncate(fd, sizeof(futex_event_t)) == -1)
+    {
+      ::close(fd);
+      return nullptr;
+    }
+
+    void* addr = mmap(nullptr, sizeof(futex_event_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) return nullptr;
+
+    return static_cast<futex_event_t*>(addr);
+  }
+
+  int futex_event_destroy(const char* event_name_)
+  {
+    // destroy (unlink) shared memory file
+    return(::shm_unlink(event_name_));
+  }
+
+  futex_event_t* futex_event_open(const char* event_name_)
+  {
+    // try to open existing shared memory file
+    int fd = ::shm_open(event_name_, O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+    if (fd < 0) return nullptr;
+
+    void* addr = mmap(nullptr, sizeof(futex_event_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) return nullptr;
+
+    return static_cast<futex_event_t*>(addr);
+  }
+
+  void futex_event_close(futex_event_t* evt_)
+  {
+    // unmap event from shared memory file
+    munmap(static_cast<void*>(evt_), sizeof(futex_event_t));
+  }
+
+  void futex_event_set(futex_event_t* evt_)
+  {
+    // set state first, a waiter registers itself before it checks the state,
+    // so either we see the waiter or the waiter sees the state (both seq_cst)
+    evt_->state.store(1, std::memory_order_seq_cst);
+
+    // fast path, nobody is sleeping -> no syscall
+    if (evt_->waiters.load(std::memory_order_seq_cst) == 0) return;
+
+    // wake up one waiter (auto reset semantic)
+    futex_wake(&evt_->state, 1);
+  }
+
+  bool futex_event_wait(futex_event_t* evt_, struct timespec* ts_)
+  {
+    // fast path, event is set already -> no syscall
+    if (evt_->state.exchange(0, std::memory_order_acquire) == 1) return true;
+
+    evt_->waiters.fetch_add(1, std::memory_order_seq_cst);
+    bool set(false);
+    for (;;)
+    {
+      // state is set ?, fine !
+      if (evt_->state.exchange(0, std::memory_order_seq_cst) == 1)
+      {
+        set = true;
+        break;
+      }
+
+      // sleep as long as state is 0, returns immediately if it was set meanwhile (EAGAIN)
+      if ((futex_wait(&evt_->state, 0, ts_) == -1) && (errno == ETIMEDOUT))
+      {
+        // last chance, event may have been set right before the timeout
+        set = (evt_->state.exchange(0, std::memory_order_seq_cst) == 1);
+        break;
+      }
+      // woken up, EAGAIN or EINTR -> check state again
+    }
+    evt_->waiters.fetch_sub(1, std::memory_order_seq_cst);
+
+    return set;
+  }
+
+  bool futex_event_trywait(futex_event_t* evt_)
+  {
+    // check and reset state
+    return(evt_->state.exchange(0, std::memory_order_acquire) == 1);
+  }
+}
@@ -0,0 +1,42 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL named event (futex in shared memory, linux only)
+**/
+
+#pragma once
+
+#include <ctime>
+
+typedef struct futex_event futex_event_t;
+
+namespace eCAL
+{
+  futex_event_t* futex_event_create(const char* event_name_);
+  int            futex_event_destroy(const char* event_name_);
+  futex_event_t* futex_event_open(const char* event_name_);
+  void           futex_event_close(futex_event_t* evt_);
+
+  // set the event, only enters the kernel if somebody is waiting
+  void           futex_event_set(futex_event_t* evt_);
+  // wait until the event is set or the (absolute, CLOCK_MONOTONIC) time ts_ is reached, nullptr waits infinite
+  bool           futex_event_wait(futex_event_t* evt_, struct timespec* ts_);
+  bool           futex_event_trywait(futex_event_t* evt_);
+}
@@ -0,0 +1,40 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL named event (pthread mutex / condition variable in shared memory)
+**/
+
+#pragma once
+
+#include <ctime>
+
+typedef struct named_event named_event_t;
+
+namespace eCAL
+{
+  named_event_t* named_event_create(const char* event_name_);
+  int            named_event_destroy(const char* event_name_);
+  named_event_t* named_event_open(const char* event_name_);
+  void           named_event_close(named_event_t* evt_);
+
+  void           named_event_set(named_event_t* evt_);
+  bool           named_event_wait(named_event_t* evt_, struct timespec* ts_);
+  bool           named_event_trywait(named_event_t* evt_);
+}
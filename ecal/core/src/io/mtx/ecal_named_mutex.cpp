@@ -129,5 +129,20 @@ namespace eCAL
   {
     m_impl->Unlock();
   }
+
+  bool CNamedMutex::LockShared(int64_t timeout_)
+  {
+    return m_impl->LockShared(timeout_);
+  }
+
+  void CNamedMutex::UnlockShared()
+  {
+    m_impl->UnlockShared();
+  }
+
+  bool CNamedMutex::HasSharedLock() const
+  {
+    return m_impl->HasSharedLock();
+  }
 }
 
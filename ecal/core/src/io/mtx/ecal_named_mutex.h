@@ -56,6 +56,11 @@ namespace eCAL
     bool Lock(int64_t timeout_);
     void Unlock();
 
+    bool LockShared(int64_t timeout_);
+    void UnlockShared();
+
+    bool HasSharedLock() const;
+
   private:
     std::unique_ptr<CNamedMutexImplBase> m_impl;
   };
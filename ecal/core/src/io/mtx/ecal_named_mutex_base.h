@@ -42,6 +42,13 @@ namespace eCAL
 
     virtual bool Lock(int64_t timeout_) = 0;
     virtual void Unlock() = 0;
+
+    // implementations without reader/writer support fall back to exclusive locking
+    virtual bool LockShared(int64_t timeout_) { return Lock(timeout_); }
+    virtual void UnlockShared() { Unlock(); }
+
+    // true if shared locks are real reader locks, that are not owned by the locking thread
+    virtual bool HasSharedLock() const { return false; }
   };
 
   class CNamedMutexStubImpl : public CNamedMutexImplBase
@@ -41,6 +41,10 @@ struct alignas(8) named_mutex
   pthread_mutex_t  mtx;
   pthread_cond_t   cvar;
   uint8_t          locked;
+  // ----- shared locking, placed into the former padding (struct size unchanged) -----
+  uint8_t          reserved;
+  uint16_t         writers_waiting;   // number of exclusive lockers waiting, blocks new readers
+  uint32_t         readers;           // number of shared lockers, locked is set while readers > 0
 };
 typedef struct named_mutex named_mutex_t;
 
@@ -84,57 +88,67 @@ namespace
     pthread_cond_init(&mtx->cvar, &shattr);
 
     // start with unlocked mutex
-    mtx->locked = 0;
+    mtx->locked          = 0;
+    mtx->writers_waiting = 0;
+    mtx->readers         = 0;
 
     // return new mutex
     return mtx;
   }
 
-  bool named_mutex_lock(named_mutex_t* mtx_, struct timespec* ts_)
+  int named_mutex_wait(named_mutex_t* mtx_, struct timespec* ts_)
   {
-    // lock condition mutex
-    pthread_mutex_lock(&mtx_->mtx);
-    // state is not locked ?, fine !
-    if (mtx_->locked == 0)
+    // wait with timeout for unlock signal
+    if (ts_)
     {
-      // set state to locked
-      mtx_->locked = 1;
-      // unlock condition mutex
-      pthread_mutex_unlock(&mtx_->mtx);
-      // return success
-      return true;
+#ifndef ECAL_OS_MACOS
+      return pthread_cond_timedwait(&mtx_->cvar, &mtx_->mtx, ts_);
+#else
+      return pthread_cond_timedwait_relative_np(&mtx_->cvar, &mtx_->mtx, ts_);
+#endif
     }
-      // state is locked by anyone else
+    // blocking wait for unlock signal
     else
     {
-      // while condition wait did not return failure (or timeout) and
-      // state is still locked by another one
-      int ret(0);
+      return pthread_cond_wait(&mtx_->cvar, &mtx_->mtx);
+    }
+  }
+
+  bool named_mutex_shareable(const named_mutex_t* mtx_)
+  {
+    // not locked at all
+    if (mtx_->locked == 0) return true;
+    // shared locked by other readers, join them as long as no exclusive locker is waiting
+    return (mtx_->readers > 0) && (mtx_->writers_waiting == 0);
+  }
+
+  bool named_mutex_lock(named_mutex_t* mtx_, struct timespec* ts_)
+  {
+    // lock condition mutex
+    pthread_mutex_lock(&mtx_->mtx);
+
+    // while condition wait did not return failure (or timeout) and
+    // state is still locked by another one (exclusive or shared)
+    int ret(0);
+    if (mtx_->locked == 1)
+    {
+      mtx_->writers_waiting++;
       while ((ret == 0) && (mtx_->locked == 1))
       {
-        // wait with timeout for unlock signal
-        if (ts_)
-        {
-#ifndef ECAL_OS_MACOS
-          ret = pthread_cond_timedwait(&mtx_->cvar, &mtx_->mtx, ts_);
-#else
-          ret = pthread_cond_timedwait_relative_np(&mtx_->cvar, &mtx_->mtx, ts_);
-#endif
-        }
-          // blocking wait for unlock signal
-        else
-        {
-          ret = pthread_cond_wait(&mtx_->cvar, &mtx_->mtx);
-        }
+        ret = named_mutex_wait(mtx_, ts_);
       }
-      // if wait (with timeout) returned successfully
-      // set state to locked
-      if (ret == 0) mtx_->locked = 1;
-      // unlock condition mutex
-      pthread_mutex_unlock(&mtx_->mtx);
-      // sucess == wait returned 0
-      return (ret == 0);
+      mtx_->writers_waiting--;
+
+      // readers may have been waiting for us giving up
+      if (ret != 0) pthread_cond_broadcast(&mtx_->cvar);
     }
+    // if wait (with timeout) returned successfully
+    // set state to locked
+    if (ret == 0) mtx_->locked = 1;
+    // unlock condition mutex
+    pthread_mutex_unlock(&mtx_->mtx);
+    // sucess == wait returned 0
+    return (ret == 0);
   }
 
   bool named_mutex_trylock(named_mutex_t* mtx_)
@@ -155,18 +169,78 @@ namespace
     return locked;
   }
 
+  bool named_mutex_lock_shared(named_mutex_t* mtx_, struct timespec* ts_)
+  {
+    // lock condition mutex
+    pthread_mutex_lock(&mtx_->mtx);
+
+    // wait until we can join (or there are no) other readers
+    int ret(0);
+    while ((ret == 0) && !named_mutex_shareable(mtx_))
+    {
+      ret = named_mutex_wait(mtx_, ts_);
+    }
+    // set state to locked (older versions only see the locked flag) and count us in
+    if (ret == 0)
+    {
+      mtx_->locked = 1;
+      mtx_->readers++;
+    }
+    // unlock condition mutex
+    pthread_mutex_unlock(&mtx_->mtx);
+    // sucess == wait returned 0
+    return (ret == 0);
+  }
+
+  bool named_mutex_trylock_shared(named_mutex_t* mtx_)
+  {
+    bool locked(false);
+    // lock condition mutex
+    pthread_mutex_lock(&mtx_->mtx);
+    // check state
+    if (named_mutex_shareable(mtx_))
+    {
+      mtx_->locked = 1;
+      mtx_->readers++;
+      locked = true;
+    }
+    // unlock condition mutex
+    pthread_mutex_unlock(&mtx_->mtx);
+    // return success
+    return locked;
+  }
+
   void named_mutex_unlock(named_mutex_t* mtx_)
   {
     // lock condition mutex
     pthread_mutex_lock(&mtx_->mtx);
-    // state is locked ?
-    if (mtx_->locked == 1)
+    // state is exclusive locked ?
+    if ((mtx_->locked == 1) && (mtx_->readers == 0))
     {
       // set state to unlocked
       mtx_->locked = 0;
-      // and signal to one conditional wait
+      // and signal to all conditional waits (writers and readers)
       // that state can be locked again
-      pthread_cond_signal(&mtx_->cvar);
+      pthread_cond_broadcast(&mtx_->cvar);
+    }
+    // unlock condition mutex
+    pthread_mutex_unlock(&mtx_->mtx);
+  }
+
+  void named_mutex_unlock_shared(named_mutex_t* mtx_)
+  {
+    // lock condition mutex
+    pthread_mutex_lock(&mtx_->mtx);
+    // state is shared locked ?
+    if ((mtx_->locked == 1) && (mtx_->readers > 0))
+    {
+      // last reader leaving unlocks the mutex
+      mtx_->readers--;
+      if (mtx_->readers == 0)
+      {
+        mtx_->locked = 0;
+        pthread_cond_broadcast(&mtx_->cvar);
+      }
     }
     // unlock condition mutex
     pthread_mutex_unlock(&mtx_->mtx);
@@ -198,6 +272,21 @@ namespace
     munmap(static_cast<void*>(mtx_), sizeof(named_mutex_t));
   }
 
+  struct timespec named_mutex_abstime(int64_t timeout_)
+  {
+    struct timespec abstime {};
+    clock_gettime(CLOCK_MONOTONIC, &abstime);
+
+    abstime.tv_sec = abstime.tv_sec + timeout_ / 1000;
+    abstime.tv_nsec = abstime.tv_nsec + (timeout_ % 1000) * 1000000;
+    while (abstime.tv_nsec >= 1000000000)
+    {
+      abstime.tv_nsec -= 1000000000;
+      abstime.tv_sec++;
+    }
+    return abstime;
+  }
+
   std::string named_mutex_buildname(const std::string& mutex_name_)
   {
     // build shm file name
@@ -292,16 +381,7 @@ namespace eCAL
       // timeout_ > 0 -> wait timeout_ ms
     else
     {
-      struct timespec abstime {};
-      clock_gettime(CLOCK_MONOTONIC, &abstime);
-
-      abstime.tv_sec = abstime.tv_sec + timeout_ / 1000;
-      abstime.tv_nsec = abstime.tv_nsec + (timeout_ % 1000) * 1000000;
-      while (abstime.tv_nsec >= 1000000000)
-      {
-        abstime.tv_nsec -= 1000000000;
-        abstime.tv_sec++;
-      }
+      struct timespec abstime = named_mutex_abstime(timeout_);
       return(named_mutex_lock(m_mutex_handle, &abstime));
     }
   }
@@ -315,4 +395,38 @@ namespace eCAL
     // unlock the mutex
     named_mutex_unlock(m_mutex_handle);
   }
+
+  bool CNamedMutexImpl::LockShared(int64_t timeout_)
+  {
+    // check mutex handle
+    if (m_mutex_handle == nullptr)
+      return false;
+
+    // timeout_ < 0 -> wait infinite
+    if (timeout_ < 0)
+    {
+      return(named_mutex_lock_shared(m_mutex_handle, nullptr));
+    }
+      // timeout_ == 0 -> check lock state only
+    else if (timeout_ == 0)
+    {
+      return(named_mutex_trylock_shared(m_mutex_handle));
+    }
+      // timeout_ > 0 -> wait timeout_ ms
+    else
+    {
+      struct timespec abstime = named_mutex_abstime(timeout_);
+      return(named_mutex_lock_shared(m_mutex_handle, &abstime));
+    }
+  }
+
+  void CNamedMutexImpl::UnlockShared()
+  {
+    // check mutex handle
+    if(m_mutex_handle == nullptr)
+      return;
+
+    // unlock the shared mutex
+    named_mutex_unlock_shared(m_mutex_handle);
+  }
 }
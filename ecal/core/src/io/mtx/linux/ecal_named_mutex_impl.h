@@ -51,6 +51,10 @@ namespace eCAL
 
     bool Lock(int64_t timeout_) final;
     void Unlock() final;
+
+    bool LockShared(int64_t timeout_) final;
+    void UnlockShared() final;
+    bool HasSharedLock() const final { return true; }
   private:
     named_mutex_t* m_mutex_handle;
     std::string m_named;
@@ -28,6 +28,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
@@ -189,8 +190,8 @@ namespace eCAL
 
   bool CMemoryFile::GetReadAccess(int timeout_)
   {
-    // currently we do not differ between read and write access
-    if (GetAccess(timeout_))
+    // shared access, multiple readers can access the file at the same time
+    if (GetAccess(timeout_, true))
     {
       // mark as opened for read access
       m_access_state = access_state::read_access;
@@ -209,8 +210,8 @@ namespace eCAL
     // reset states
     m_access_state = access_state::closed;
 
-    // release read mutex
-    m_memfile_mutex.Unlock();
+    // release shared read mutex
+    m_memfile_mutex.UnlockShared();
 
     return(true);
   }
@@ -250,8 +251,8 @@ namespace eCAL
 
   bool CMemoryFile::GetWriteAccess(int timeout_)
   {
-    // currently we do not differ between read and write access
-    if (GetAccess(timeout_))
+    // exclusive access
+    if (GetAccess(timeout_, false))
     {
       // mark as opened for write access
       m_access_state = access_state::write_access;
@@ -315,6 +316,11 @@ namespace eCAL
     }
   }
 
+  void CMemoryFile::InvalidatePayload()
+  {
+    m_payload_initialized = false;
+  }
+
   size_t CMemoryFile::WritePayload(CPayloadWriter& payload_, const size_t len_, const size_t offset_, bool force_full_write_ /*= false*/)
   {
     if (!m_created) return(0);
@@ -354,13 +360,71 @@ namespace eCAL
     }
   }
 
-  bool CMemoryFile::GetAccess(int timeout_)
+  void* CMemoryFile::GetUnsyncedAddress()
+  {
+    if (!m_created)                            return(nullptr);
+    if (m_memfile_info.mem_address == nullptr) return(nullptr);
+
+    // the internal header is written once on creation and not modified afterwards
+    memcpy(&m_header, m_memfile_info.mem_address, std::min(sizeof(SInternalHeader), static_cast<std::size_t>(m_header.int_hdr_size)));
+
+    // check size and update memory file map if needed
+    size_t const len = static_cast<size_t>(m_header.int_hdr_size) + static_cast<size_t>(m_header.max_data_size);
+    if (len > m_memfile_info.size)
+    {
+      memfile::db::CheckFileSize(m_name, len, m_memfile_info);
+      if (len > m_memfile_info.size) return(nullptr);
+    }
+
+    return(static_cast<char*>(m_memfile_info.mem_address) + m_header.int_hdr_size);
+  }
+
+  bool CMemoryFile::AddPin()
+  {
+    std::atomic<std::uint32_t>* pin_counter = PinCounter();
+    if (pin_counter == nullptr) return(false);
+    pin_counter->fetch_add(1, std::memory_order_relaxed);
+    return(true);
+  }
+
+  bool CMemoryFile::RemovePin()
+  {
+    std::atomic<std::uint32_t>* pin_counter = PinCounter();
+    if (pin_counter == nullptr) return(false);
+    pin_counter->fetch_sub(1, std::memory_order_relaxed);
+    return(true);
+  }
+
+  std::uint32_t CMemoryFile::PinCount() const
+  {
+    const std::atomic<std::uint32_t>* pin_counter = PinCounter();
+    if (pin_counter == nullptr) return(0);
+    return(pin_counter->load(std::memory_order_relaxed));
+  }
+
+  std::atomic<std::uint32_t>* CMemoryFile::PinCounter() const
+  {
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t), "pin counter needs to be a plain 32 bit integer");
+
+    if (!m_created)                            return(nullptr);
+    if (m_memfile_info.mem_address == nullptr) return(nullptr);
+
+    // memory files of older writers do not have a pin counter
+    const auto* header = static_cast<const SInternalHeader*>(m_memfile_info.mem_address);
+    if (header->int_hdr_size < SIZEOF_PARTIAL_STRUCT(SInternalHeader, pin_count)) return(nullptr);
+
+    // the mapping is page aligned and the counter is placed on a 4 byte boundary
+    return(reinterpret_cast<std::atomic<std::uint32_t>*>(static_cast<char*>(m_memfile_info.mem_address) + offsetof(SInternalHeader, pin_count)));
+  }
+
+  bool CMemoryFile::GetAccess(int timeout_, bool shared_)
   {
     if (!m_created)                            return(false);
     if (m_memfile_info.mem_address == nullptr) return(false);
 
     // lock mutex
-    if(!m_memfile_mutex.Lock(timeout_))
+    const bool locked = shared_ ? m_memfile_mutex.LockShared(timeout_) : m_memfile_mutex.Lock(timeout_);
+    if(!locked)
     {
 #ifndef NDEBUG
       printf("Could not lock memory file mutex: %s.\n\n", m_name.c_str());
@@ -369,7 +433,7 @@ namespace eCAL
     }
 
     // reset current data size field of memfile header if lock is inconsistent 
-    if (m_auto_sanitizing && m_memfile_mutex.WasRecovered())
+    if (!shared_ && m_auto_sanitizing && m_memfile_mutex.WasRecovered())
     {
       m_header.cur_data_size = 0;
       *reinterpret_cast<SInternalHeader*>(m_memfile_info.mem_address) = m_header;
@@ -389,7 +453,8 @@ namespace eCAL
       if (len > m_memfile_info.size)
       {
         // unlock mutex
-        m_memfile_mutex.Unlock();
+        if (shared_) m_memfile_mutex.UnlockShared();
+        else         m_memfile_mutex.Unlock();
         return(false);
       }
     }
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <string>
@@ -72,7 +73,7 @@ namespace eCAL
     bool Destroy(const bool remove_);
 
     /**
-     * @brief Get memory file read access. 
+     * @brief Get memory file read access (shared with other readers). 
      *
      * @param timeout_  The timeout in ms for access via mutex.
      *
@@ -157,6 +158,37 @@ namespace eCAL
     **/
     size_t WritePayload(CPayloadWriter& payload_, size_t len_, size_t offset_, bool force_full_write_ = false);
 
+    /**
+     * @brief Mark the payload content as unknown, the next WritePayload call
+     *        rewrites the complete payload (see CPayloadWriter::WriteFull).
+     *        Has to be called if the payload was written without WritePayload.
+    **/
+    void InvalidatePayload();
+
+    /**
+     * @brief Get payload buffer pointer without acquiring the memory file mutex.
+     *        Only to be used for lock-free content layouts (see CMemoryFileRing).
+     *
+     * @return         The payload address (or nullptr if it fails).
+    **/
+    void* GetUnsyncedAddress();
+
+    /**
+     * @brief Announce (AddPin) or withdraw (RemovePin) a read access that is held
+     *        beyond the sample callback (pinned sample view). Has to be called
+     *        while holding the read access.
+     *
+     * @return  False if the memory file was created without pin counter (older writer).
+    **/
+    bool AddPin();
+    bool RemovePin();
+
+    /**
+     * @brief Number of pinned sample views of all readers, writers only have to
+     *        expect a long lasting read access if it is not zero.
+    **/
+    std::uint32_t PinCount() const;
+
     /**
      * @brief Maximum data size of the whole memory file.
      *
@@ -179,6 +211,14 @@ namespace eCAL
     bool HasReadAccess()     const {return(m_access_state == access_state::read_access);};
     bool HasWriteAccess()    const {return(m_access_state == access_state::write_access);};
 
+    /**
+     * @brief Check if read access is shared with other readers and can be
+     *        released by another thread than the one that acquired it.
+     *
+     * @return  True if read access can be held across threads.
+    **/
+    bool HasSharedReadAccess() const {return(m_memfile_mutex.HasSharedLock());};
+
     
     // @deprecate_eCAL6
     // Use of platform specific aligment to remain compatible with previous struct layout
@@ -202,11 +242,14 @@ namespace eCAL
       // New fields should only declare well defined data types and be aligned to 8 bytes
       // std::uint8_t                 _new_field  = 0;
       // std::array<std::uint8_t, 7>  _reserved_1 = {};
+      std::uint32_t               pin_count     = 0;  // pinned sample views, modified atomically by the readers (see AddPin)
+      std::array<std::uint8_t, 4> _reserved_1   = {};
     };
 #pragma pack(pop)
 
   protected:
-    bool GetAccess(int timeout_);
+    bool GetAccess(int timeout_, bool shared_);
+    std::atomic<std::uint32_t>* PinCounter() const;
 
     enum class access_state
     {
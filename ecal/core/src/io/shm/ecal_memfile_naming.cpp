@@ -41,5 +41,15 @@ namespace eCAL
 
       return out.str();
     }
+
+    std::string BuildDoorbellEventName(const std::string& process_id)
+    {
+      return "ecal_shm_doorbell_" + process_id;
+    }
+
+    std::string BuildReadyQueueName(const std::string& process_id)
+    {
+      return "ecal_shm_ready_" + process_id;
+    }
   }
 }
\ No newline at end of file
@@ -30,5 +30,11 @@ namespace eCAL
   namespace memfile
   {
     std::string BuildRandomMemFileName(const std::string& base_name);
+
+    // process wide wake up event of pooled memory file observers
+    std::string BuildDoorbellEventName(const std::string& process_id);
+
+    // process wide queue of updated memory files of pooled memory file observers
+    std::string BuildReadyQueueName(const std::string& process_id);
   }
 }
\ No newline at end of file
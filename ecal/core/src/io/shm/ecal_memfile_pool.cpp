@@ -24,12 +24,17 @@
 
 #include "ecal_def.h"
 #include "ecal_event_internal.h"
+#include "ecal_memfile_naming.h"
 #include "ecal_memfile_pool.h"
 
+#include <ecal/ecal_config.h>
+#include <ecal/ecal_process.h>
+
 #include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -42,11 +47,30 @@ namespace eCAL
   ////////////////////////////////////////
   // CMemFileObserver
   ////////////////////////////////////////
+
+  // second access to the observed memory file, used to keep a sample read locked
+  // after the observer released its own access (a writer can not lock the file meanwhile,
+  // so there is never more than one pinned sample per file)
+  struct CMemFileObserver::SPinHandle
+  {
+    std::mutex                   mtx;
+    bool                         active = true;
+    std::unique_ptr<CMemoryFile> memfile;       // nullptr as long as it pins a sample
+  };
+
   CMemFileObserver::CMemFileObserver() :
     m_created(false),
     m_do_stop(false),
     m_is_observing(false),
-    m_time_of_last_life_signal(std::chrono::steady_clock::now())
+    m_has_unprocessed_data(false),
+    m_queued(false),
+    m_time_of_last_life_signal(std::chrono::steady_clock::now()),
+    m_timeout(0),
+    m_last_sample_clock(0),
+    m_ring_mode(false),
+    m_ring_synced(false),
+    m_ring_read_count(0),
+    m_ring_drop_count(0)
   {
   }
 
@@ -59,10 +83,15 @@ namespace eCAL
     Destroy();
   }
 
-  bool CMemFileObserver::Create(const std::string& memfile_name_, const std::string& memfile_event_)
+  bool CMemFileObserver::Create(const std::string& memfile_name_, const std::string& memfile_event_, bool ring_)
   {
     if (m_created) return false;
 
+    // lock-free ring or mutex protected single buffer
+    m_ring_mode       = ring_;
+    m_ring_synced     = false;
+    m_ring_read_count = 0;
+
     // open memory file events
     gOpenNamedEvent(&m_event_snd, memfile_event_, false);
     gOpenNamedEvent(&m_event_ack, memfile_event_ + "_ack", false);
@@ -70,6 +99,12 @@ namespace eCAL
     // create memory file access
     m_memfile.Create(memfile_name_.c_str(), false);
 
+    // create the pin handle up front, it can not be created while the file is read locked
+    // a pin is released by the thread that drops the last sample view, so this needs
+    // a real shared lock (not owned by the locking thread)
+    m_pin_handle = std::make_shared<SPinHandle>();
+    if (!m_ring_mode && m_memfile.HasSharedReadAccess()) CreatePinHandle();
+
     m_created = true;
 
 #ifndef NDEBUG
@@ -87,6 +122,13 @@ namespace eCAL
     // destroy memory file (access only)
     m_memfile.Destroy(false);
 
+    // destroy pin handle, samples that are still pinned release their handle on their own
+    {
+      const std::lock_guard<std::mutex> lock(m_pin_handle->mtx);
+      m_pin_handle->active = false;
+      m_pin_handle->memfile.reset();
+    }
+
     // close memory file events
     gCloseEvent(m_event_snd);
     gCloseEvent(m_event_ack);
@@ -101,19 +143,32 @@ namespace eCAL
     return true;
   }
 
-  bool CMemFileObserver::Start(const std::string& topic_name_, const std::string& topic_id_, const int timeout_, const MemFileDataCallbackT& callback_)
+  bool CMemFileObserver::Start(const std::string& topic_name_, const std::string& topic_id_, const int timeout_, const MemFileDataCallbackT& callback_, bool own_thread_ /*= true*/)
   {
     if (!m_created)     return false;
     if (m_is_observing) return false;
 
-    // assign callback
+    // assign topic, timeout and callback
+    m_topic_name    = topic_name_;
+    m_topic_id      = topic_id_;
+    m_timeout       = timeout_;
     m_data_callback = std::move(callback_);
 
+    // reset states
+    m_do_stop                  = false;
+    m_time_of_last_life_signal = std::chrono::steady_clock::now();
+    m_has_unprocessed_data     = false;
+    m_last_sample_clock        = 0;
+
     // mark as running
     m_is_observing = true;
 
     // start observer thread
-    m_thread = std::thread(&CMemFileObserver::Observe, this, topic_name_, topic_id_, timeout_);
+    // pooled observers are served by the workers of the thread pool
+    if (own_thread_)
+    {
+      m_thread = std::thread(&CMemFileObserver::Observe, this);
+    }
 
 #ifndef NDEBUG
     // log it
@@ -138,7 +193,16 @@ namespace eCAL
     }
 
     // wait for finalization
-    if(m_thread.joinable()) m_thread.join();
+    if(m_thread.joinable())
+    {
+      m_thread.join();
+    }
+    else
+    {
+      // wait for a running pooled processing
+      const std::lock_guard<std::mutex> lock(m_process_mtx);
+      m_is_observing = false;
+    }
 
     return true;
   }
@@ -152,28 +216,51 @@ namespace eCAL
     return true;
   }
 
-  void CMemFileObserver::Observe(const std::string& topic_name_, const std::string& topic_id_, const int timeout_)
+  bool CMemFileObserver::CheckUpdate()
   {
-    // internal clock sample update checking
-    uint64_t last_sample_clock(0);
+    if (!m_is_observing || m_do_stop) return false;
+
+    // check for timeout
+    if (IsTimedOut())
+    {
+#ifndef NDEBUG
+      Logging::Log(log_level_debug2, std::string("CMemFileObserver " + m_memfile.Name() + " timeout"));
+#endif
+      m_is_observing = false;
+      return false;
+    }
+
+    // check memory file update event from shm writer (no waiting)
+    if (gWaitForEvent(m_event_snd, 0))
+    {
+      // We got a signal from the publisher! It is alive! So we reset the time since the last live signal
+      m_time_of_last_life_signal = std::chrono::steady_clock::now();
+      m_has_unprocessed_data     = true;
+    }
+
+    return m_has_unprocessed_data;
+  }
 
-    // buffer to store memory file content
-    std::vector<char> receive_buffer;
+  bool CMemFileObserver::Process()
+  {
+    const std::lock_guard<std::mutex> lock(m_process_mtx);
+    if (!m_is_observing || m_do_stop) return false;
 
-    // Boolean that tells whether the SHM file has new data that we have NOT already accessed
-    bool has_unprocessed_data = false;
+    return ProcessData();
+  }
 
+  void CMemFileObserver::Observe()
+  {
     // runs as long as there is no timeout and no external stop request
-    while(std::chrono::steady_clock::now() - std::chrono::steady_clock::time_point(m_time_of_last_life_signal) < std::chrono::milliseconds(timeout_)
-           && !m_do_stop)
+    while(!IsTimedOut() && !m_do_stop)
     {
-      if (!has_unprocessed_data)
+      if (!m_has_unprocessed_data)
       {
         // Only wait for the new-data-event, if we haven't processed the data, yet
         // check for memory file update event from shm writer (20 ms)
-        has_unprocessed_data = gWaitForEvent(m_event_snd, 20);
+        m_has_unprocessed_data = gWaitForEvent(m_event_snd, 20);
 
-        if (has_unprocessed_data)
+        if (m_has_unprocessed_data)
         {
           // We got a signal from the publisher! It is alive! So we reset the time since the last live signal
           m_time_of_last_life_signal = std::chrono::steady_clock::now();
@@ -181,92 +268,12 @@ namespace eCAL
       }
 
       // If we have unprocessed data, we try to access (and process!) it
-      if(has_unprocessed_data)
+      if(m_has_unprocessed_data)
       {
         // last chance to stop ..
         if(m_do_stop) break;
 
-        // try to open memory file (timeout 5 ms)
-        if(m_memfile.GetReadAccess(5))
-        {
-          // We have gotten access! Now the data qualifies as processed, so next loop we will wait for the signal for new data, again.
-          has_unprocessed_data = false;
-
-          // read the file header
-          SMemFileHeader mfile_hdr;
-          ReadFileHeader(mfile_hdr);
-
-          // check for new content
-          if (mfile_hdr.clock <= last_sample_clock)
-          {
-            // release access and leave
-            m_memfile.ReleaseReadAccess();
-          }
-          else
-          {
-            const bool zero_copy_allowed = mfile_hdr.options.zero_copy != 0;
-            bool post_process_buffer(false);
-            // -------------------------------------------------------------------------
-            // zero copy mode
-            // -------------------------------------------------------------------------
-            // That means we call the user callback (ApplySample) from within the opened memory file.
-            // So we do not waste time by copying the payload in an intermediate buffer
-            // but the file keeps opened and blocked until the callback returns.
-            // Other subscriber can not access the content this time !
-            // -------------------------------------------------------------------------
-            if (zero_copy_allowed)
-            {
-              // acquire memory file payload pointer (no copying here)
-              const void* buf(nullptr);
-              if (m_memfile.GetReadAddress(buf, mfile_hdr.data_size) > 0)
-              {
-                // calculate data buffer offset
-                const char* data_buf = static_cast<const char*>(buf) + mfile_hdr.hdr_size;
-                // add sample to data reader (and call user callback function)
-                if (m_data_callback) m_data_callback(topic_name_, topic_id_, data_buf, mfile_hdr.data_size, (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash);
-              }
-            }
-            // -------------------------------------------------------------------------
-            // buffered mode
-            // -------------------------------------------------------------------------
-            // we copy the data into the receive buffer (standard mode for eCAL < 5.10)
-            // and close the file immediately
-            else
-            {
-              // need to resize the buffer especially if data_size = 0, otherwise it might contain stale data.
-              receive_buffer.resize((size_t)mfile_hdr.data_size);
-
-              // read payload
-              // if data length == 0, there is no need to further read data
-              // we just flag to process the empty buffer
-              if (mfile_hdr.data_size != 0)
-              {
-                m_memfile.Read(receive_buffer.data(), (size_t)mfile_hdr.data_size, mfile_hdr.hdr_size);
-              }
-
-              post_process_buffer = true;
-            }
-
-            // store clock
-            last_sample_clock = mfile_hdr.clock;
-
-            // release access
-            m_memfile.ReleaseReadAccess();
-
-            // process receive buffer if buffered mode read some data in
-            if (post_process_buffer)
-            {
-              // add sample to data reader (and call user callback function)
-              if (m_data_callback) m_data_callback(topic_name_, topic_id_, receive_buffer.data(), receive_buffer.size(), (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash);
-            }
-
-            // send acknowledge event
-            if (mfile_hdr.ack_timout_ms != 0)
-            {
-              gSetEvent(m_event_ack);
-            }
-          }
-        }
+        ProcessData();
       }
     }
 
@@ -286,6 +293,110 @@ namespace eCAL
     m_is_observing = false; //-V1020
   }
 
+  bool CMemFileObserver::IsTimedOut() const
+  {
+    return (std::chrono::steady_clock::now() - std::chrono::steady_clock::time_point(m_time_of_last_life_signal) >= std::chrono::milliseconds(m_timeout));
+  }
+
+  bool CMemFileObserver::ProcessData()
+  {
+    // ring mode, read all new samples without locking the memory file
+    // samples that could not be read now will be read on the next update event
+    if (m_ring_mode)
+    {
+      m_has_unprocessed_data = false;
+      ReadRing(m_topic_name, m_topic_id, m_receive_buffer);
+      return true;
+    }
+
+    // try to open memory file (timeout 5 ms)
+    if(!m_memfile.GetReadAccess(5)) return false;
+
+    // We have gotten access! Now the data qualifies as processed, so next loop we will wait for the signal for new data, again.
+    m_has_unprocessed_data = false;
+
+    // read the file header
+    SMemFileHeader mfile_hdr;
+    ReadFileHeader(mfile_hdr);
+
+    // check for new content
+    if (mfile_hdr.clock <= m_last_sample_clock)
+    {
+      // release access and leave
+      m_memfile.ReleaseReadAccess();
+      return true;
+    }
+
+    const bool zero_copy_allowed = mfile_hdr.options.zero_copy != 0;
+    bool post_process_buffer(false);
+    // -------------------------------------------------------------------------
+    // zero copy mode
+    // -------------------------------------------------------------------------
+    // That means we call the user callback (ApplySample) from within the opened memory file.
+    // So we do not waste time by copying the payload in an intermediate buffer
+    // but the file keeps opened and blocked until the callback returns.
+    // The publisher can not update the content this time !
+    // -------------------------------------------------------------------------
+    if (zero_copy_allowed)
+    {
+      // acquire memory file payload pointer (no copying here)
+      const void* buf(nullptr);
+      if (m_memfile.GetReadAddress(buf, mfile_hdr.data_size) > 0)
+      {
+        // calculate data buffer offset
+        const char* data_buf = static_cast<const char*>(buf) + mfile_hdr.hdr_size;
+        // readers that hand out sample views can keep the file locked beyond the callback,
+        // all of them share the same pin (only if the writer does not need this file for its next sample)
+        std::shared_ptr<const void> pin;
+        SamplePinT pin_sample;
+        if (mfile_hdr.options.pinnable != 0) pin_sample = [this, &pin]() { if (!pin) pin = PinSample(); return pin; };
+        // add sample to data reader (and call user callback function)
+        if (m_data_callback) m_data_callback(m_topic_name, m_topic_id, data_buf, mfile_hdr.data_size, (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash, pin_sample);
+      }
+    }
+    // -------------------------------------------------------------------------
+    // buffered mode
+    // -------------------------------------------------------------------------
+    // we copy the data into the receive buffer (standard mode for eCAL < 5.10)
+    // and close the file immediately
+    else
+    {
+      // need to resize the buffer especially if data_size = 0, otherwise it might contain stale data.
+      m_receive_buffer.resize((size_t)mfile_hdr.data_size);
+
+      // read payload
+      // if data length == 0, there is no need to further read data
+      // we just flag to process the empty buffer
+      if (mfile_hdr.data_size != 0)
+      {
+        m_memfile.Read(m_receive_buffer.data(), (size_t)mfile_hdr.data_size, mfile_hdr.hdr_size);
+      }
+
+      post_process_buffer = true;
+    }
+
+    // store clock
+    m_last_sample_clock = mfile_hdr.clock;
+
+    // release access
+    m_memfile.ReleaseReadAccess();
+
+    // process receive buffer if buffered mode read some data in
+    if (post_process_buffer)
+    {
+      // add sample to data reader (and call user callback function)
+      if (m_data_callback) m_data_callback(m_topic_name, m_topic_id, m_receive_buffer.data(), m_receive_buffer.size(), (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash, SamplePinT());
+    }
+
+    // send acknowledge event
+    if (mfile_hdr.ack_timout_ms != 0)
+    {
+      gSetEvent(m_event_ack);
+    }
+
+    return true;
+  }
+
   bool CMemFileObserver::ReadFileHeader(SMemFileHeader& mfile_hdr_)
   {
     // retrieve size of received buffer
@@ -309,12 +420,127 @@ namespace eCAL
     return false;
   }
 
+  bool CMemFileObserver::ReadRing(const std::string& topic_name_, const std::string& topic_id_, std::vector<char>& receive_buffer_)
+  {
+    // attach to the ring (the file mapping may have been updated)
+    void* ring_address = m_memfile.GetUnsyncedAddress();
+    if (ring_address == nullptr) return false;
+    m_ring.SetBaseAddress(ring_address);
+    if (!m_ring.IsValid()) return false;
+
+    const uint64_t write_count = m_ring.WriteCount();
+#ifndef NDEBUG
+    const uint64_t drop_count  = m_ring_drop_count;
+#endif
+
+    // on first access we start with the latest sample only (like the single buffer mode)
+    if (!m_ring_synced || (write_count < m_ring_read_count))
+    {
+      m_ring_read_count = (write_count > 0) ? write_count - 1 : 0;
+      m_ring_synced     = true;
+    }
+
+    // the writer overtook us, the oldest samples are lost
+    const uint64_t slot_count = static_cast<uint64_t>(m_ring.SlotCount());
+    if (write_count - m_ring_read_count > slot_count)
+    {
+      m_ring_drop_count += write_count - m_ring_read_count - slot_count;
+      m_ring_read_count  = write_count - slot_count;
+    }
+
+    bool send_ack(false);
+    for (; m_ring_read_count < write_count; ++m_ring_read_count)
+    {
+      SMemFileHeader mfile_hdr;
+      if (!m_ring.Read(m_ring_read_count, mfile_hdr, receive_buffer_))
+      {
+        // slot was overwritten while copying
+        m_ring_drop_count++;
+        continue;
+      }
+
+      // add sample to data reader (and call user callback function)
+      if (m_data_callback) m_data_callback(topic_name_, topic_id_, receive_buffer_.data(), receive_buffer_.size(), (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash, SamplePinT());
+
+      send_ack |= (mfile_hdr.ack_timout_ms != 0);
+    }
+
+    // send acknowledge event
+    if (send_ack)
+    {
+      gSetEvent(m_event_ack);
+    }
+
+#ifndef NDEBUG
+    if (m_ring_drop_count != drop_count)
+    {
+      Logging::Log(log_level_debug3, std::string("CMemFileObserver " + m_memfile.Name() + " dropped samples: " + std::to_string(m_ring_drop_count)));
+    }
+#endif
+
+    return true;
+  }
+
+  std::shared_ptr<const void> CMemFileObserver::PinSample()
+  {
+    // take the pin handle (not existing or already pinning another sample -> no pin)
+    std::unique_ptr<CMemoryFile> memfile;
+    {
+      const std::lock_guard<std::mutex> lock(m_pin_handle->mtx);
+      if (!m_pin_handle->memfile) return nullptr;
+      memfile = std::move(m_pin_handle->memfile);
+    }
+
+    // additional read access, do not wait here (a waiting writer blocks new readers)
+    // the pin is announced to the writer, so it skips the file instead of waiting for it
+    if (!memfile->GetReadAccess(0))
+    {
+      const std::lock_guard<std::mutex> lock(m_pin_handle->mtx);
+      m_pin_handle->memfile = std::move(memfile);
+      return nullptr;
+    }
+    if (!memfile->AddPin())
+    {
+      memfile->ReleaseReadAccess();
+      const std::lock_guard<std::mutex> lock(m_pin_handle->mtx);
+      m_pin_handle->memfile = std::move(memfile);
+      return nullptr;
+    }
+
+    // release the read access and hand back the pin handle if the last owner is gone
+    const std::shared_ptr<SPinHandle> pin_handle = m_pin_handle;
+    return std::shared_ptr<const void>(memfile.release(), [pin_handle](CMemoryFile* memfile_)
+      {
+        memfile_->RemovePin();
+        memfile_->ReleaseReadAccess();
+        const std::lock_guard<std::mutex> lock(pin_handle->mtx);
+        if (pin_handle->active && !pin_handle->memfile) pin_handle->memfile.reset(memfile_);
+        else                                            delete memfile_;
+      });
+  }
+
+  void CMemFileObserver::CreatePinHandle()
+  {
+    std::unique_ptr<CMemoryFile> memfile(new CMemoryFile());
+    if (!memfile->Create(m_memfile.Name().c_str(), false))
+    {
+#ifndef NDEBUG
+      Logging::Log(log_level_debug2, std::string("CMemFileObserver " + m_memfile.Name() + " could not create pin handle"));
+#endif
+      return;
+    }
+
+    const std::lock_guard<std::mutex> lock(m_pin_handle->mtx);
+    m_pin_handle->memfile = std::move(memfile);
+  }
+
   ////////////////////////////////////////
   // CMemFileThreadPool
   ////////////////////////////////////////
   CMemFileThreadPool::CMemFileThreadPool() :
   m_created(false),
-  m_do_cleanup(false)
+  m_do_cleanup(false),
+  m_do_dispatch(false)
   {
   }
 
@@ -331,6 +557,26 @@ namespace eCAL
     m_do_cleanup = true;
     m_cleanup_thread = std::thread(&CMemFileThreadPool::CleanupPoolThread, this);
 
+    // start dispatcher and worker threads for pooled observation
+    const size_t worker_count = Config::Experimental::GetShmObserverThreadCount();
+    if (worker_count > 0)
+    {
+      // publishers are setting this event after every memory file update
+      // and they queue the updated memory file before (if the queue is not existing we check all files)
+      const std::string process_id = std::to_string(Process::GetProcessID());
+      m_ready_queue.Create(memfile::BuildReadyQueueName(process_id), true, EXP_SHM_OBSERVER_QUEUE_SIZE);
+      gOpenNamedEvent(&m_doorbell, memfile::BuildDoorbellEventName(process_id), true);
+
+      m_do_dispatch = true;
+      for (size_t idx = 0; idx < worker_count; ++idx)
+      {
+        m_workers.emplace_back(std::make_unique<SWorker>());
+        SWorker& worker = *m_workers.back();
+        worker.thread = std::thread(&CMemFileThreadPool::WorkerThread, this, std::ref(worker));
+      }
+      m_dispatcher_thread = std::thread(&CMemFileThreadPool::DispatcherThread, this);
+    }
+
     m_created = true;
   }
 
@@ -346,6 +592,29 @@ namespace eCAL
     }
     if (m_cleanup_thread.joinable()) m_cleanup_thread.join();
 
+    // stop dispatcher and worker threads
+    if (m_do_dispatch)
+    {
+      m_do_dispatch = false;
+      gSetEvent(m_doorbell);
+      if (m_dispatcher_thread.joinable()) m_dispatcher_thread.join();
+
+      for (auto& worker : m_workers)
+      {
+        {
+          const std::lock_guard<std::mutex> lock(worker->mtx);
+          worker->queue.clear();
+        }
+        worker->cv.notify_one();
+        if (worker->thread.joinable()) worker->thread.join();
+      }
+      m_workers.clear();
+
+      gCloseEvent(m_doorbell);
+      gInvalidateEvent(&m_doorbell);
+      m_ready_queue.Destroy();
+    }
+
     // lock pool
     const std::lock_guard<std::mutex> lock(m_observer_pool_sync);
 
@@ -354,15 +623,20 @@ namespace eCAL
 
     // clear pool (and destroy all)
     m_observer_pool.clear();
+    m_observer_worker.clear();
+    m_observer_ids.clear();
 
     m_created = false;
   }
 
-  bool CMemFileThreadPool::ObserveFile(const std::string& memfile_name_, const std::string& memfile_event_, const std::string& topic_name_, const std::string& topic_id_, int timeout_observation_ms, const MemFileDataCallbackT& callback_)
+  bool CMemFileThreadPool::ObserveFile(const std::string& memfile_name_, const std::string& memfile_event_, const std::string& topic_name_, const std::string& topic_id_, int timeout_observation_ms, const MemFileDataCallbackT& callback_, bool ring_ /*= false*/)
   {
     if(!m_created)            return(false);
     if(memfile_name_.empty()) return(false);
 
+    // pooled observers do not need their own thread
+    const bool own_thread = m_workers.empty();
+
     // lock pool
     const std::lock_guard<std::mutex> lock(m_observer_pool_sync);
 
@@ -381,7 +655,7 @@ namespace eCAL
       else
       {
         observer->Stop();
-        observer->Start(topic_name_, topic_id_, timeout_observation_ms, callback_);
+        observer->Start(topic_name_, topic_id_, timeout_observation_ms, callback_, own_thread);
       }
 
       return(true);
@@ -390,9 +664,15 @@ namespace eCAL
     else
     {
       auto observer = std::make_shared<CMemFileObserver>();
-      observer->Create(memfile_name_, memfile_event_);
-      observer->Start(topic_name_, topic_id_, timeout_observation_ms, callback_);
+      observer->Create(memfile_name_, memfile_event_, ring_);
+      observer->Start(topic_name_, topic_id_, timeout_observation_ms, callback_, own_thread);
       m_observer_pool[memfile_name_] = observer;
+      // all memory files of one topic are served by the same worker to keep the sample order
+      if (!own_thread)
+      {
+        m_observer_worker[memfile_name_] = std::hash<std::string>()(topic_name_) % m_workers.size();
+        m_observer_ids[CMemFileReadyQueue::BuildFileId(memfile_name_)] = memfile_name_;
+      }
 #ifndef NDEBUG
       // log it
       Logging::Log(log_level_debug2, std::string("CMemFileThreadPool::ObserveFile " + memfile_name_ + " added"));
@@ -401,6 +681,109 @@ namespace eCAL
     }
   }
 
+  void CMemFileThreadPool::DispatcherThread()
+  {
+    // publishers of older eCAL versions do not set the doorbell, so we check all files at least every 20 ms
+    const std::chrono::milliseconds check_all_period(20);
+    auto last_check_all = std::chrono::steady_clock::now();
+
+    std::vector<std::uint64_t> file_ids;
+    while (m_do_dispatch)
+    {
+      // wait for any memory file update of this process
+      gWaitForEvent(m_doorbell, static_cast<long>(check_all_period.count()));
+      if (!m_do_dispatch) break;
+
+      // take the ids of the updated memory files, if some got lost we check all files
+      bool check_all = !m_ready_queue.PopAll(file_ids);
+      const auto now = std::chrono::steady_clock::now();
+      if (now - last_check_all >= check_all_period) check_all = true;
+      if (check_all) last_check_all = now;
+
+      // lock pool
+      const std::lock_guard<std::mutex> lock(m_observer_pool_sync);
+
+      // hand over updated memory files to their workers
+      if (check_all)
+      {
+        for (const auto& observer : m_observer_pool)
+        {
+          Dispatch(observer.first, observer.second);
+        }
+      }
+      else
+      {
+        for (const auto file_id : file_ids)
+        {
+          const auto id_it = m_observer_ids.find(file_id);
+          if (id_it == m_observer_ids.end()) continue;
+
+          const auto observer_it = m_observer_pool.find(id_it->second);
+          if (observer_it != m_observer_pool.end()) Dispatch(observer_it->first, observer_it->second);
+        }
+      }
+    }
+  }
+
+  void CMemFileThreadPool::Dispatch(const std::string& memfile_name_, const std::shared_ptr<CMemFileObserver>& observer_)
+  {
+    // m_observer_pool_sync is locked by the caller
+    // a queued observer is checked again by its worker after processing
+    if (observer_->m_queued)                 return;
+    if (!observer_->CheckUpdate())           return;
+    if (observer_->m_queued.exchange(true))  return;
+
+    Enqueue(m_observer_worker[memfile_name_], observer_);
+  }
+
+  void CMemFileThreadPool::WorkerThread(SWorker& worker_)
+  {
+    for (;;)
+    {
+      std::shared_ptr<CMemFileObserver> observer;
+      {
+        std::unique_lock<std::mutex> lock(worker_.mtx);
+        worker_.cv.wait(lock, [&]() -> bool { return !worker_.queue.empty() || !m_do_dispatch; });
+        if (!m_do_dispatch) return;
+
+        observer = worker_.queue.front();
+        worker_.queue.pop_front();
+      }
+
+      // process the update, callbacks of one observer are never executed in parallel
+      observer->Process();
+
+      // memory file could not be accessed, try it again
+      if (observer->HasUnprocessedData() && observer->IsObserving())
+      {
+        const std::lock_guard<std::mutex> lock(worker_.mtx);
+        worker_.queue.push_back(observer);
+      }
+      else
+      {
+        observer->m_queued = false;
+
+        // the dispatcher skipped updates signaled while the observer was queued,
+        // so check for them here instead of waiting for the next check of all files
+        if (observer->CheckUpdate() && !observer->m_queued.exchange(true))
+        {
+          const std::lock_guard<std::mutex> lock(worker_.mtx);
+          worker_.queue.push_back(observer);
+        }
+      }
+    }
+  }
+
+  void CMemFileThreadPool::Enqueue(size_t worker_idx_, const std::shared_ptr<CMemFileObserver>& observer_)
+  {
+    SWorker& worker = *m_workers[worker_idx_];
+    {
+      const std::lock_guard<std::mutex> lock(worker.mtx);
+      worker.queue.push_back(observer_);
+    }
+    worker.cv.notify_one();
+  }
+
   void CMemFileThreadPool::CleanupPoolThread()
   {
     for (;;)
@@ -434,6 +817,8 @@ namespace eCAL
         // log it
         Logging::Log(log_level_debug2, std::string("CMemFileThreadPool::ObserveFile " + observer->first + " removed"));
 #endif
+        m_observer_worker.erase(observer->first);
+        m_observer_ids.erase(CMemFileReadyQueue::BuildFileId(observer->first));
         observer = m_observer_pool.erase(observer);
       }
       else
@@ -25,24 +25,31 @@
 
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <ecal/ecal_event.h>
 #include <ecal/ecal_log.h>
 
 #include "ecal_memfile.h"
 #include "ecal_memfile_header.h"
+#include "ecal_memfile_ready_queue.h"
+#include "ecal_memfile_ring.h"
+#include "readwrite/ecal_reader_data.h"
 
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace eCAL
 {
-  using MemFileDataCallbackT = std::function<size_t (const std::string &, const std::string &, const char *, size_t, long long, long long, long long, size_t)>;
+  using MemFileDataCallbackT = std::function<size_t (const std::string &, const std::string &, const char *, size_t, long long, long long, long long, size_t, const SamplePinT &)>;
 
   ////////////////////////////////////////
   // CMemFileObserver
@@ -58,31 +65,63 @@ namespace eCAL
     CMemFileObserver(CMemFileObserver&& rhs) = delete;
     CMemFileObserver& operator=(CMemFileObserver&& rhs) = delete;
 
-    bool Create(const std::string& memfile_name_, const std::string& memfile_event_);
+    bool Create(const std::string& memfile_name_, const std::string& memfile_event_, bool ring_ = false);
     bool Destroy();
 
-    bool Start(const std::string& topic_name_, const std::string& topic_id_, const int timeout_, const MemFileDataCallbackT& callback_);
+    bool Start(const std::string& topic_name_, const std::string& topic_id_, const int timeout_, const MemFileDataCallbackT& callback_, bool own_thread_ = true);
     bool Stop();
     bool IsObserving() {return(m_is_observing);};
 
     bool ResetTimeout();
 
+    // pooled observation (no own thread)
+    bool CheckUpdate();
+    bool Process();
+    bool HasUnprocessedData() {return(m_has_unprocessed_data);};
+
   protected:
-    void Observe(const std::string& topic_name_, const std::string& topic_id_, const int timeout_);
+    friend class CMemFileThreadPool;
+
+    void Observe();
+    bool IsTimedOut() const;
+    bool ProcessData();
     bool ReadFileHeader(SMemFileHeader& memfile_hdr);
+    bool ReadRing(const std::string& topic_name_, const std::string& topic_id_, std::vector<char>& receive_buffer_);
+
+    // pinned zero copy samples
+    struct SPinHandle;
+    std::shared_ptr<const void> PinSample();
+    void CreatePinHandle();
 
     std::atomic<bool>       m_created;
     std::atomic<bool>       m_do_stop;
     std::atomic<bool>       m_is_observing;
+    std::atomic<bool>       m_has_unprocessed_data;
+    std::atomic<bool>       m_queued;
 
     std::atomic<std::chrono::steady_clock::time_point> m_time_of_last_life_signal;
 
+    std::string             m_topic_name;
+    std::string             m_topic_id;
+    int                     m_timeout;
     MemFileDataCallbackT    m_data_callback;
 
+    std::mutex              m_process_mtx;
+    uint64_t                m_last_sample_clock;
+    std::vector<char>       m_receive_buffer;
+
     std::thread             m_thread;
     EventHandleT            m_event_snd;
     EventHandleT            m_event_ack;
     CMemoryFile             m_memfile;
+
+    bool                    m_ring_mode;
+    CMemoryFileRing         m_ring;
+    bool                    m_ring_synced;
+    uint64_t                m_ring_read_count;
+    uint64_t                m_ring_drop_count;
+
+    std::shared_ptr<SPinHandle> m_pin_handle;
   };
 
   ////////////////////////////////////////
@@ -97,19 +136,40 @@ namespace eCAL
     void Create();
     void Destroy();
 
-    bool ObserveFile(const std::string& memfile_name_, const std::string& memfile_event_, const std::string& topic_name_, const std::string& topic_id_, int timeout_observation_ms, const MemFileDataCallbackT& callback_);
+    bool ObserveFile(const std::string& memfile_name_, const std::string& memfile_event_, const std::string& topic_name_, const std::string& topic_id_, int timeout_observation_ms, const MemFileDataCallbackT& callback_, bool ring_ = false);
 
   protected:
     void CleanupPoolThread();
     void CleanupPool();
 
+    // pooled observation
+    struct SWorker
+    {
+      std::mutex                                    mtx;
+      std::condition_variable                       cv;
+      std::deque<std::shared_ptr<CMemFileObserver>> queue;
+      std::thread                                   thread;
+    };
+    void DispatcherThread();
+    void Dispatch(const std::string& memfile_name_, const std::shared_ptr<CMemFileObserver>& observer_);
+    void WorkerThread(SWorker& worker_);
+    void Enqueue(size_t worker_idx_, const std::shared_ptr<CMemFileObserver>& observer_);
+
     std::atomic<bool>                                         m_created;
     std::mutex                                                m_observer_pool_sync;
     std::map<std::string, std::shared_ptr<CMemFileObserver>>  m_observer_pool;
+    std::map<std::string, size_t>                             m_observer_worker;
+    std::unordered_map<std::uint64_t, std::string>            m_observer_ids;
 
     std::atomic<bool>                                         m_do_cleanup;
     std::condition_variable                                   m_do_cleanup_cv;
     std::mutex                                                m_do_cleanup_mtx;
     std::thread                                               m_cleanup_thread;
+
+    std::atomic<bool>                                         m_do_dispatch;
+    EventHandleT                                              m_doorbell;
+    CMemFileReadyQueue                                        m_ready_queue;
+    std::thread                                               m_dispatcher_thread;
+    std::vector<std::unique_ptr<SWorker>>                     m_workers;
   };
 }
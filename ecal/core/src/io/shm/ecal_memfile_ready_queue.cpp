@@ -0,0 +1,207 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  queue of updated memory files for pooled observation
+**/
+
+#include "ecal_def.h"
+#include "ecal_memfile.h"
+#include "ecal_memfile_ready_queue.h"
+
+namespace eCAL
+{
+  CMemFileReadyQueue::CMemFileReadyQueue() :
+    m_created(false),
+    m_owner(false),
+    m_memfile(std::make_unique<CMemoryFile>()),
+    m_header(nullptr)
+  {
+  }
+
+  CMemFileReadyQueue::~CMemFileReadyQueue()
+  {
+    Destroy();
+  }
+
+  bool CMemFileReadyQueue::Create(const std::string& name_, bool owner_, std::size_t max_queue_size_)
+  {
+    if (m_created) return false;
+    if (max_queue_size_ == 0) return false;
+
+    const std::size_t memfile_size = MemorySize(max_queue_size_);
+    if (!m_memfile->Create(name_.c_str(), true, memfile_size, true)) return false;
+
+    // the memory file mutex is used on creation only, pushing and popping is lock-free
+    if (!m_memfile->GetWriteAccess(EXP_MEMFILE_ACCESS_TIMEOUT))
+    {
+      m_memfile->Destroy(false);
+      return false;
+    }
+
+    bool valid(false);
+    bool remove(owner_);
+    void* memfile_address(nullptr);
+    if (owner_)
+    {
+      // the queue may be left over by a crashed process with the same id
+      if (m_memfile->GetWriteAddress(memfile_address, memfile_size) != 0u)
+      {
+        SQueueHeader* header = static_cast<SQueueHeader*>(memfile_address);
+        header->hdr_size  = sizeof(SQueueHeader);
+        header->version   = queue_version;
+        header->capacity  = static_cast<std::uint32_t>(max_queue_size_);
+        header->_reserved = 0;
+        header->overflow.store(0, std::memory_order_relaxed);
+        header->push_pos.store(0, std::memory_order_relaxed);
+        header->pop_pos.store(0, std::memory_order_relaxed);
+
+        SCell* cells = reinterpret_cast<SCell*>(header + 1);
+        for (std::size_t idx = 0; idx < max_queue_size_; ++idx)
+        {
+          cells[idx].sequence.store(2 * idx, std::memory_order_relaxed);
+          cells[idx].file_id.store(0, std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        valid = true;
+      }
+    }
+    else
+    {
+      // an empty file was not created by a subscriber process, so nobody is reading it
+      remove = (m_memfile->CurDataSize() == 0);
+      if ((m_memfile->CurDataSize() >= sizeof(SQueueHeader)) && (m_memfile->GetWriteAddress(memfile_address, m_memfile->CurDataSize()) != 0u))
+      {
+        const SQueueHeader* header = static_cast<const SQueueHeader*>(memfile_address);
+        valid = (header->hdr_size == sizeof(SQueueHeader)) && (header->version == queue_version)
+             && (header->capacity > 0) && (m_memfile->CurDataSize() >= MemorySize(header->capacity));
+      }
+    }
+    m_memfile->ReleaseWriteAccess();
+
+    if (valid)
+    {
+      m_header = static_cast<SQueueHeader*>(m_memfile->GetUnsyncedAddress());
+      valid = (m_header != nullptr);
+    }
+
+    if (!valid)
+    {
+      m_header = nullptr;
+      m_memfile->Destroy(remove);
+      return false;
+    }
+
+    m_owner   = owner_;
+    m_created = true;
+    return true;
+  }
+
+  void CMemFileReadyQueue::Destroy()
+  {
+    if (!m_created) return;
+    m_created = false;
+    m_header  = nullptr;
+
+    // the subscriber process owns the queue file
+    m_memfile->Destroy(m_owner);
+  }
+
+  bool CMemFileReadyQueue::Push(std::uint64_t file_id_)
+  {
+    if (!m_created) return false;
+
+    std::uint64_t pos = m_header->push_pos.load(std::memory_order_relaxed);
+    for (;;)
+    {
+      SCell& cell = Cell(pos);
+      const std::uint64_t seq  = cell.sequence.load(std::memory_order_acquire);
+      const std::int64_t  diff = static_cast<std::int64_t>(seq - 2 * pos);
+      if (diff == 0)
+      {
+        // reserve the cell, then fill and publish it
+        if (m_header->push_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          cell.file_id.store(file_id_, std::memory_order_relaxed);
+          cell.sequence.store(2 * pos + 1, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (diff < 0)
+      {
+        // queue is full, the reader has to check all files
+        m_header->overflow.store(1, std::memory_order_release);
+        return false;
+      }
+      else
+      {
+        // another publisher took this position
+        pos = m_header->push_pos.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  bool CMemFileReadyQueue::PopAll(std::vector<std::uint64_t>& file_ids_)
+  {
+    file_ids_.clear();
+    if (!m_created) return false;
+
+    // take the overflow flag first, ids dropped after this point are reported with the next call
+    const bool complete = (m_header->overflow.exchange(0, std::memory_order_acq_rel) == 0);
+
+    // a cell that is reserved but not filled yet ends the loop, the publisher
+    // sets the doorbell after filling it, so it is taken with the next call
+    std::uint64_t pos = m_header->pop_pos.load(std::memory_order_relaxed);
+    for (;;)
+    {
+      SCell& cell = Cell(pos);
+      if (cell.sequence.load(std::memory_order_acquire) != 2 * pos + 1) break;
+
+      file_ids_.push_back(cell.file_id.load(std::memory_order_relaxed));
+      cell.sequence.store(2 * (pos + m_header->capacity), std::memory_order_release);
+      ++pos;
+    }
+    m_header->pop_pos.store(pos, std::memory_order_relaxed);
+
+    return complete;
+  }
+
+  std::uint64_t CMemFileReadyQueue::BuildFileId(const std::string& memfile_name_)
+  {
+    // FNV-1a, std::hash may differ between the publisher and the subscriber build
+    std::uint64_t id(14695981039346656037ULL);
+    for (const char c : memfile_name_)
+    {
+      id ^= static_cast<std::uint8_t>(c);
+      id *= 1099511628211ULL;
+    }
+    return id;
+  }
+
+  std::size_t CMemFileReadyQueue::MemorySize(std::size_t max_queue_size_)
+  {
+    return sizeof(SQueueHeader) + max_queue_size_ * sizeof(SCell);
+  }
+
+  CMemFileReadyQueue::SCell& CMemFileReadyQueue::Cell(std::uint64_t pos_) const
+  {
+    SCell* cells = reinterpret_cast<SCell*>(m_header + 1);
+    return cells[pos_ % m_header->capacity];
+  }
+}
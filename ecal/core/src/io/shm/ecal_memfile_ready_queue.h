@@ -0,0 +1,123 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  queue of updated memory files for pooled observation
+**/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace eCAL
+{
+  class CMemoryFile;
+
+  /**
+   * @brief Process wide queue of updated memory files, placed in a memory file.
+   *
+   * A subscriber process with pooled observers creates one queue, the publishers
+   * push the id of every memory file they updated before they set the doorbell.
+   * So the dispatcher only needs to check these files instead of all observed ones.
+   *
+   * The queue is lock-free (multiple publisher processes, one dispatcher thread),
+   * so a publisher never waits for the subscriber process. Every cell carries a
+   * sequence number telling if it is free (2 * pos) or filled (2 * pos + 1) for
+   * a queue position. If the queue is full the id is dropped and the overflow
+   * flag makes the dispatcher check all files. A publisher that dies between
+   * reserving and filling a cell blocks the queue, the dispatcher then keeps
+   * checking all files until the subscriber process recreates the queue.
+   *
+   * Layout: SQueueHeader | SCell 0 | SCell 1 | ... | SCell n-1
+  **/
+  class CMemFileReadyQueue
+  {
+  public:
+    static constexpr std::uint16_t queue_version = 2;
+
+    CMemFileReadyQueue();
+    ~CMemFileReadyQueue();
+
+    /**
+     * @brief Create the queue (subscriber side) or open the existing one (publisher side).
+     *
+     * @param name_            The queue memory file name.
+     * @param owner_           True to create and reset the queue.
+     * @param max_queue_size_  Number of memory file ids the queue can hold.
+     *
+     * @return  true if it succeeds, false if it fails.
+    **/
+    bool Create(const std::string& name_, bool owner_, std::size_t max_queue_size_);
+    void Destroy();
+
+    bool IsCreated() const { return m_created; };
+
+    /**
+     * @brief Push the id of an updated memory file (publisher side).
+     *
+     * @return  false if the queue is full (the id is dropped, the reader has to check all files then).
+    **/
+    bool Push(std::uint64_t file_id_);
+
+    /**
+     * @brief Take all memory file ids out of the queue (subscriber side, one thread only).
+     *
+     * @param file_ids_  The queued ids (oldest first).
+     *
+     * @return  false if ids got lost (queue overflow), all files have to be checked then.
+    **/
+    bool PopAll(std::vector<std::uint64_t>& file_ids_);
+
+    /**
+     * @brief Id of a memory file (stable over processes and platforms).
+    **/
+    static std::uint64_t BuildFileId(const std::string& memfile_name_);
+
+  private:
+    struct SQueueHeader
+    {
+      std::uint16_t              hdr_size;
+      std::uint16_t              version;
+      std::uint32_t              capacity;
+      std::atomic<std::uint32_t> overflow;
+      std::uint32_t              _reserved;
+      std::atomic<std::uint64_t> push_pos;
+      std::atomic<std::uint64_t> pop_pos;
+    };
+
+    struct SCell
+    {
+      std::atomic<std::uint64_t> sequence;
+      std::atomic<std::uint64_t> file_id;
+    };
+
+    static std::size_t MemorySize(std::size_t max_queue_size_);
+    SCell& Cell(std::uint64_t pos_) const;
+
+    bool                                    m_created;
+    bool                                    m_owner;
+    std::unique_ptr<CMemoryFile>            m_memfile;
+    SQueueHeader*                           m_header;
+  };
+}
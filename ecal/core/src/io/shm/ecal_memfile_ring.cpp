@@ -0,0 +1,214 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  lock-free multi slot ring for shared memory files
+**/
+
+#include "ecal_memfile_ring.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace
+{
+  // align slots to cache lines to avoid false sharing between neighbouring slots
+  constexpr std::size_t slot_alignment = 64;
+
+  std::size_t AlignUp(std::size_t size_)
+  {
+    return (size_ + slot_alignment - 1) / slot_alignment * slot_alignment;
+  }
+}
+
+namespace eCAL
+{
+  CMemoryFileRing::CMemoryFileRing() :
+    m_base_address(nullptr),
+    m_header(nullptr)
+  {
+  }
+
+  void CMemoryFileRing::SetBaseAddress(void* base_address_)
+  {
+    m_base_address = static_cast<char*>(base_address_);
+    m_header       = reinterpret_cast<SRingHeader*>(m_base_address);
+  }
+
+  void CMemoryFileRing::Reset(std::size_t slot_count_, std::size_t slot_size_)
+  {
+    assert((m_base_address != nullptr) && (slot_count_ != 0));
+
+    m_header->hdr_size    = sizeof(SRingHeader);
+    m_header->version     = ring_version;
+    m_header->slot_count  = static_cast<std::uint32_t>(slot_count_);
+    m_header->slot_size   = static_cast<std::uint64_t>(slot_size_);
+    m_header->slot_stride = static_cast<std::uint64_t>(SlotStride(slot_size_));
+
+    for (std::size_t slot = 0; slot < slot_count_; ++slot)
+    {
+      reinterpret_cast<SSlotHeader*>(Slot(slot))->sequence.store(0, std::memory_order_relaxed);
+    }
+
+    // publish the initialized layout
+    m_header->write_count.store(0, std::memory_order_release);
+  }
+
+  bool CMemoryFileRing::IsValid() const
+  {
+    if (m_header == nullptr)                       return false;
+    if (m_header->hdr_size != sizeof(SRingHeader)) return false;
+    if (m_header->version  != ring_version)        return false;
+    if (m_header->slot_count == 0)                 return false;
+    return m_header->slot_stride == SlotStride(static_cast<std::size_t>(m_header->slot_size));
+  }
+
+  std::size_t CMemoryFileRing::SlotCount() const
+  {
+    assert(m_header != nullptr);
+    return static_cast<std::size_t>(m_header->slot_count);
+  }
+
+  std::size_t CMemoryFileRing::SlotSize() const
+  {
+    assert(m_header != nullptr);
+    return static_cast<std::size_t>(m_header->slot_size);
+  }
+
+  std::uint64_t CMemoryFileRing::WriteCount() const
+  {
+    assert(m_header != nullptr);
+    return m_header->write_count.load(std::memory_order_acquire);
+  }
+
+  bool CMemoryFileRing::Write(CPayloadWriter& payload_, const SMemFileHeader& memfile_hdr_)
+  {
+    void* buf = Loan(static_cast<std::size_t>(memfile_hdr_.data_size));
+    if (buf == nullptr) return false;
+
+    // write payload
+    bool written(true);
+    if (memfile_hdr_.data_size > 0)
+    {
+      written = payload_.WriteFull(buf, static_cast<std::size_t>(memfile_hdr_.data_size));
+    }
+
+    // write sample header and publish it
+    written &= Commit(memfile_hdr_);
+
+    return written;
+  }
+
+  void* CMemoryFileRing::Loan(std::size_t len_)
+  {
+    assert(m_header != nullptr);
+    if (len_ > m_header->slot_size) return nullptr;
+
+    // only one writer per ring, so relaxed is sufficient for our own counter
+    const std::uint64_t write_count = m_header->write_count.load(std::memory_order_relaxed);
+    char* slot = Slot(write_count % m_header->slot_count);
+    SSlotHeader* slot_hdr = reinterpret_cast<SSlotHeader*>(slot);
+
+    // mark slot as "in progress" (odd sequence number)
+    slot_hdr->sequence.store(2 * write_count + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return slot + sizeof(SSlotHeader) + sizeof(SMemFileHeader);
+  }
+
+  bool CMemoryFileRing::Commit(const SMemFileHeader& memfile_hdr_)
+  {
+    assert(m_header != nullptr);
+    if (memfile_hdr_.data_size > m_header->slot_size)
+    {
+      Discard();
+      return false;
+    }
+
+    const std::uint64_t write_count = m_header->write_count.load(std::memory_order_relaxed);
+    char* slot = Slot(write_count % m_header->slot_count);
+    SSlotHeader* slot_hdr = reinterpret_cast<SSlotHeader*>(slot);
+
+    // write sample header
+    std::memcpy(slot + sizeof(SSlotHeader), &memfile_hdr_, sizeof(SMemFileHeader));
+
+    // mark slot as complete (even sequence number) and publish it
+    slot_hdr->sequence.store(2 * write_count + 2, std::memory_order_release);
+    m_header->write_count.store(write_count + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  void CMemoryFileRing::Discard()
+  {
+    assert(m_header != nullptr);
+
+    // the old slot content may be partly overwritten already,
+    // so the slot is marked as empty (it never matches a read index)
+    const std::uint64_t write_count = m_header->write_count.load(std::memory_order_relaxed);
+    SSlotHeader* slot_hdr = reinterpret_cast<SSlotHeader*>(Slot(write_count % m_header->slot_count));
+    slot_hdr->sequence.store(0, std::memory_order_release);
+  }
+
+  bool CMemoryFileRing::Read(std::uint64_t index_, SMemFileHeader& memfile_hdr_, std::vector<char>& buffer_) const
+  {
+    assert(m_header != nullptr);
+
+    const char* slot = Slot(index_ % m_header->slot_count);
+    const SSlotHeader* slot_hdr = reinterpret_cast<const SSlotHeader*>(slot);
+
+    // slot has to contain exactly the requested sample
+    const std::uint64_t expected_sequence = 2 * index_ + 2;
+    if (slot_hdr->sequence.load(std::memory_order_acquire) != expected_sequence) return false;
+
+    std::memcpy(&memfile_hdr_, slot + sizeof(SSlotHeader), sizeof(SMemFileHeader));
+    const std::size_t data_size = static_cast<std::size_t>(std::min(memfile_hdr_.data_size, m_header->slot_size));
+    buffer_.resize(data_size);
+    if (data_size > 0)
+    {
+      std::memcpy(buffer_.data(), slot + sizeof(SSlotHeader) + sizeof(SMemFileHeader), data_size);
+    }
+
+    // the writer may have lapped us while copying, then the content is garbage
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot_hdr->sequence.load(std::memory_order_relaxed) == expected_sequence;
+  }
+
+  std::size_t CMemoryFileRing::PresumablyOccupiedMemorySize(std::size_t slot_count_, std::size_t slot_size_)
+  {
+    return HeaderStride() + slot_count_ * SlotStride(slot_size_);
+  }
+
+  std::size_t CMemoryFileRing::SlotStride(std::size_t slot_size_)
+  {
+    return AlignUp(sizeof(SSlotHeader) + sizeof(SMemFileHeader) + slot_size_);
+  }
+
+  std::size_t CMemoryFileRing::HeaderStride()
+  {
+    return AlignUp(sizeof(SRingHeader));
+  }
+
+  char* CMemoryFileRing::Slot(std::uint64_t index_) const
+  {
+    assert(m_base_address != nullptr);
+    return m_base_address + HeaderStride() + index_ * m_header->slot_stride;
+  }
+}
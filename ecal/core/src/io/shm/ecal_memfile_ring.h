@@ -0,0 +1,157 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  lock-free multi slot ring for shared memory files
+**/
+
+#pragma once
+
+#include <ecal/ecal_payload_writer.h>
+
+#include "ecal_memfile_header.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace eCAL
+{
+  /**
+   * @brief Single writer / multi reader sample ring placed in a memory file.
+   *
+   * The writer never waits for readers. Every slot carries a sequence number
+   * (odd while the slot is written, even when it is complete) so a reader can
+   * detect that a slot was overwritten while it was copying it.
+   *
+   * Layout: SRingHeader | slot 0 | slot 1 | ... | slot n-1
+   * Slot  : SSlotHeader | SMemFileHeader | payload (slot_size bytes)
+  **/
+  class CMemoryFileRing
+  {
+  public:
+    static constexpr std::uint16_t ring_version = 1;
+
+    CMemoryFileRing();
+
+    /**
+     * @brief Attach the ring to a (mapped) memory file address.
+     *
+     * @param base_address_  Start address of the ring layout.
+    **/
+    void SetBaseAddress(void* base_address_);
+
+    /**
+     * @brief Initialize an empty ring (writer side only).
+     *
+     * @param slot_count_  Number of slots.
+     * @param slot_size_   Maximum payload size per slot [Bytes].
+    **/
+    void Reset(std::size_t slot_count_, std::size_t slot_size_);
+
+    /**
+     * @brief Check if the attached memory contains a compatible ring layout.
+    **/
+    bool IsValid() const;
+
+    std::size_t SlotCount() const;
+    std::size_t SlotSize() const;
+
+    /**
+     * @brief Number of samples written since the ring was initialized.
+    **/
+    std::uint64_t WriteCount() const;
+
+    /**
+     * @brief Write a sample into the next slot, overwriting the oldest one.
+     *
+     * @param payload_     The payload writer.
+     * @param memfile_hdr_ The sample header (data_size is the payload length).
+     *
+     * @return  true if it succeeds, false if the payload does not fit into a slot.
+    **/
+    bool Write(CPayloadWriter& payload_, const SMemFileHeader& memfile_hdr_);
+
+    /**
+     * @brief Mark the next slot as "in progress" and return its payload address.
+     *
+     * The slot is published by Commit or released again by Discard.
+     *
+     * @param len_  Maximum payload length that will be written [Bytes].
+     *
+     * @return  The slot payload address (or nullptr if len_ does not fit into a slot).
+    **/
+    void* Loan(std::size_t len_);
+
+    /**
+     * @brief Publish the slot loaned before.
+     *
+     * @param memfile_hdr_ The sample header (data_size is the payload length).
+     *
+     * @return  true if it succeeds, false if the payload does not fit into a slot.
+    **/
+    bool Commit(const SMemFileHeader& memfile_hdr_);
+
+    /**
+     * @brief Release the slot loaned before without publishing it.
+    **/
+    void Discard();
+
+    /**
+     * @brief Copy the sample with the given write index.
+     *
+     * @param index_        Write index of the sample (0 .. WriteCount()-1).
+     * @param memfile_hdr_  The sample header.
+     * @param buffer_       The payload buffer (resized to the payload length).
+     *
+     * @return  true if it succeeds, false if the sample was overwritten already.
+    **/
+    bool Read(std::uint64_t index_, SMemFileHeader& memfile_hdr_, std::vector<char>& buffer_) const;
+
+    /**
+     * @brief Memory size needed for a ring with the given dimension.
+    **/
+    static std::size_t PresumablyOccupiedMemorySize(std::size_t slot_count_, std::size_t slot_size_);
+
+  private:
+    struct SRingHeader
+    {
+      std::uint16_t              hdr_size    = sizeof(SRingHeader);
+      std::uint16_t              version     = ring_version;
+      std::uint32_t              slot_count  = 0;
+      std::uint64_t              slot_size   = 0;
+      std::uint64_t              slot_stride = 0;
+      std::atomic<std::uint64_t> write_count;
+    };
+
+    struct SSlotHeader
+    {
+      std::atomic<std::uint64_t> sequence;
+    };
+
+    static std::size_t SlotStride(std::size_t slot_size_);
+    static std::size_t HeaderStride();
+
+    char* Slot(std::uint64_t index_) const;
+
+    char*        m_base_address;
+    SRingHeader* m_header;
+  };
+}
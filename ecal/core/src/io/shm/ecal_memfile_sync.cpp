@@ -26,6 +26,7 @@
 #include <ecal/ecal_event.h>
 #include <ecal/ecal_log.h>
 
+#include "ecal_def.h"
 #include "ecal_event_internal.h"
 #include "ecal_memfile_header.h"
 #include "ecal_memfile_naming.h"
@@ -38,11 +39,39 @@
 #include <utility>
 #include <vector>
 
+namespace
+{
+  eCAL::SMemFileHeader BuildMemFileHeader(const eCAL::SWriterAttr& data_)
+  {
+    // create user file header
+    struct eCAL::SMemFileHeader memfile_hdr;
+    // set data size
+    memfile_hdr.data_size         = static_cast<uint64_t>(data_.len);
+    // set header id
+    memfile_hdr.id                = static_cast<uint64_t>(data_.id);
+    // set header clock
+    memfile_hdr.clock             = static_cast<uint64_t>(data_.clock);
+    // set header time
+    memfile_hdr.time              = static_cast<int64_t>(data_.time);
+    // set header hash
+    memfile_hdr.hash              = static_cast<uint64_t>(data_.hash);
+    // set zero copy
+    memfile_hdr.options.zero_copy = static_cast<unsigned char>(data_.zero_copy);
+    // set pinnable
+    memfile_hdr.options.pinnable  = static_cast<unsigned char>(data_.pinnable);
+    // set acknowledge timeout
+    memfile_hdr.ack_timout_ms     = static_cast<int64_t>(data_.acknowledge_timeout_ms);
+    return memfile_hdr;
+  }
+}
+
 namespace eCAL
 {
   CSyncMemoryFile::CSyncMemoryFile(const std::string& base_name_, size_t size_, SSyncMemoryFileAttr attr_) :
+    m_memfile_id(0),
     m_attr(attr_),
-    m_created(false)
+    m_created(false),
+    m_loaned(false)
   {
     Create(base_name_, size_);
   }
@@ -74,6 +103,8 @@ namespace eCAL
       SEventHandlePair event_pair;
       gOpenNamedEvent(&event_pair.event_snd, event_snd_name, true);
       gOpenNamedEvent(&event_pair.event_ack, event_ack_name, true);
+      gOpenExistingNamedEvent(&event_pair.event_doorbell, memfile::BuildDoorbellEventName(process_id_));
+      event_pair.ready_queue = OpenReadyQueue(event_pair.event_doorbell, process_id_);
       m_event_handle_map.insert(std::pair<std::string, SEventHandlePair>(process_id_, event_pair));
       return true;
     }
@@ -90,6 +121,16 @@ namespace eCAL
       // Set the ack event to valid again, so we will wait for the subscriber
       iter->second.event_ack_is_invalid = false;
 
+      // the subscriber process may have started pooled observation later
+      if (!gEventIsValid(iter->second.event_doorbell))
+      {
+        gOpenExistingNamedEvent(&iter->second.event_doorbell, memfile::BuildDoorbellEventName(process_id_));
+      }
+      if (!iter->second.ready_queue)
+      {
+        iter->second.ready_queue = OpenReadyQueue(iter->second.event_doorbell, process_id_);
+      }
+
       return true;
     }
   }
@@ -109,6 +150,7 @@ namespace eCAL
       const SEventHandlePair event_pair = iter->second;
       gCloseEvent(event_pair.event_snd);
       gCloseEvent(event_pair.event_ack);
+      gCloseEvent(event_pair.event_doorbell);
       m_event_handle_map.erase(iter);
       return true;
     }
@@ -120,15 +162,15 @@ namespace eCAL
   {
     if (!m_created) return false;
 
-    // we recreate a memory file if the file size is too small
-    const bool file_to_small = m_memfile.MaxDataSize() < (sizeof(SMemFileHeader) + size_);
+    // we recreate a memory file if the file (or rather the ring slot) size is too small
+    const bool file_to_small = IsRing() ? (m_ring.SlotSize() < size_) : (m_memfile.MaxDataSize() < (sizeof(SMemFileHeader) + size_));
     if (file_to_small)
     {
 #ifndef NDEBUG
       Logging::Log(log_level_debug4, m_base_name + "::CSyncMemoryFile::CheckSize - RECREATE");
 #endif
       // estimate size of memory file
-      const size_t memfile_size = sizeof(SMemFileHeader) + size_ + static_cast<size_t>((static_cast<float>(m_attr.reserve) / 100.0f) * static_cast<float>(size_));
+      const size_t memfile_size = (IsRing() ? 0 : sizeof(SMemFileHeader)) + size_ + static_cast<size_t>((static_cast<float>(m_attr.reserve) / 100.0f) * static_cast<float>(size_));
 
       // recreate the file
       if (!Recreate(memfile_size)) return false;
@@ -158,46 +200,23 @@ namespace eCAL
 #endif
 
     // create user file header
-    struct SMemFileHeader memfile_hdr;
-    // set data size
-    memfile_hdr.data_size         = static_cast<uint64_t>(data_.len);
-    // set header id
-    memfile_hdr.id                = static_cast<uint64_t>(data_.id);
-    // set header clock
-    memfile_hdr.clock             = static_cast<uint64_t>(data_.clock);
-    // set header time
-    memfile_hdr.time              = static_cast<int64_t>(data_.time);
-    // set header hash
-    memfile_hdr.hash              = static_cast<uint64_t>(data_.hash);
-    // set zero copy
-    memfile_hdr.options.zero_copy = static_cast<unsigned char>(data_.zero_copy);
-    // set acknowledge timeout
-    memfile_hdr.ack_timout_ms     = static_cast<int64_t>(data_.acknowledge_timeout_ms);
-
-    // acquire write access
-    bool write_access = m_memfile.GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms));
+    struct SMemFileHeader memfile_hdr = BuildMemFileHeader(data_);
 
-    // maybe it's locked by a zombie or a crashed process
-    // so we try to recreate a new one
-    if (!write_access)
+    // ring mode: the writer never waits for any reader
+    if (IsRing())
     {
-#ifndef NDEBUG
-      Logging::Log(log_level_debug2, m_base_name + "::CSyncMemoryFile::Write::GetWriteAccess - FAILED");
-#endif
+      const bool written = m_ring.Write(payload_, memfile_hdr);
 
-      // try to recreate the memory file
-      if (!Recreate(m_memfile.MaxDataSize())) return false;
+      // and fire the publish event for local subscriber
+      if (written) SyncContent();
+      else         Logging::Log(log_level_error, m_base_name + "::CSyncMemoryFile::Write - FAILED (ring slot write failed)");
 
-      // then try to get access again
-      write_access = m_memfile.GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms));
-      // still no chance ? hell .... we give up
-      if (!write_access)
-      {
-        Logging::Log(log_level_error, m_base_name + "::CSyncMemoryFile::Write::GetWriteAccess - FAILED FINALLY");
-        return false;
-      }
+      return written;
     }
 
+    // acquire write access
+    if (!AcquireWriteAccess()) return false;
+
     // now write content
     bool written(true);
     size_t wbytes(0);
@@ -231,6 +250,140 @@ namespace eCAL
     return written;
   }
 
+  void* CSyncMemoryFile::Loan(size_t len_)
+  {
+    if (!m_created || m_loaned) return nullptr;
+
+#ifndef NDEBUG
+    Logging::Log(log_level_debug4, m_base_name + "::CSyncMemoryFile::Loan");
+#endif
+
+    // ring mode: the slot is marked as "in progress" until it's committed
+    void* buf(nullptr);
+    if (IsRing())
+    {
+      buf = m_ring.Loan(len_);
+    }
+    else
+    {
+      // the write access is held until the buffer is committed
+      if (!AcquireWriteAccess()) return nullptr;
+
+      void* wbuf(nullptr);
+      if (m_memfile.GetWriteAddress(wbuf, sizeof(SMemFileHeader) + len_) != 0u)
+      {
+        buf = static_cast<char*>(wbuf) + sizeof(SMemFileHeader);
+        // the user writes the loaned buffer, so the next zero copy
+        // send can not apply a modification to the previous payload
+        m_memfile.InvalidatePayload();
+      }
+      else
+      {
+        m_memfile.ReleaseWriteAccess();
+      }
+    }
+
+    if (buf == nullptr)
+    {
+      Logging::Log(log_level_error, m_base_name + "::CSyncMemoryFile::Loan - FAILED");
+    }
+
+    m_loaned = (buf != nullptr);
+    return buf;
+  }
+
+  bool CSyncMemoryFile::Commit(const SWriterAttr& data_)
+  {
+    if (!m_created || !m_loaned) return false;
+    m_loaned = false;
+
+    // store acknowledge timeout parameter
+    m_attr.timeout_ack_ms = data_.acknowledge_timeout_ms;
+    if (m_attr.timeout_ack_ms < 0) m_attr.timeout_ack_ms = 0;
+
+    // create user file header
+    const struct SMemFileHeader memfile_hdr = BuildMemFileHeader(data_);
+
+    bool written(true);
+    if (IsRing())
+    {
+      written = m_ring.Commit(memfile_hdr);
+    }
+    else
+    {
+      // write the user file header in front of the loaned payload
+      written &= m_memfile.WriteBuffer(&memfile_hdr, memfile_hdr.hdr_size, 0) > 0;
+      // and update the data size to the committed length
+      void* wbuf(nullptr);
+      written &= m_memfile.GetWriteAddress(wbuf, memfile_hdr.hdr_size + data_.len) > 0;
+      // release write access
+      m_memfile.ReleaseWriteAccess();
+    }
+
+    // and fire the publish event for local subscriber
+    if (written) SyncContent();
+
+    if (written)
+    {
+#ifndef NDEBUG
+      Logging::Log(log_level_debug4, m_base_name + "::CSyncMemoryFile::Commit - SUCCESS : " + std::to_string(data_.len) + " Bytes written");
+#endif
+    }
+    else
+    {
+      Logging::Log(log_level_error, m_base_name + "::CSyncMemoryFile::Commit - FAILED (written == false)");
+    }
+
+    return written;
+  }
+
+  bool CSyncMemoryFile::Discard()
+  {
+    if (!m_created || !m_loaned) return false;
+    m_loaned = false;
+
+    if (IsRing())
+    {
+      m_ring.Discard();
+    }
+    else
+    {
+      // the payload may be partly overwritten already, so we invalidate
+      // the file content with an empty header (it's ignored by the readers)
+      struct SMemFileHeader memfile_hdr;
+      m_memfile.WriteBuffer(&memfile_hdr, memfile_hdr.hdr_size, 0);
+      m_memfile.ReleaseWriteAccess();
+    }
+
+    return true;
+  }
+
+  bool CSyncMemoryFile::IsLocked()
+  {
+    if (!m_created || IsRing()) return false;
+
+    // only pinned sample views hold the read access beyond the callback,
+    // all other readers are waited for by the write access
+    if (m_memfile.PinCount() == 0) return false;
+
+    // probe the memory file mutex without waiting
+    if (!m_memfile.GetWriteAccess(0)) return true;
+    m_memfile.ReleaseWriteAccess();
+
+    return false;
+  }
+
+  std::vector<std::string> CSyncMemoryFile::GetConnectedProcesses()
+  {
+    std::vector<std::string> process_id_list;
+    const std::lock_guard<std::mutex> lock(m_event_handle_map_sync);
+    for (const auto& event_handle : m_event_handle_map)
+    {
+      process_id_list.push_back(event_handle.first);
+    }
+    return process_id_list;
+  }
+
   std::string CSyncMemoryFile::GetName() const
   {
     return m_memfile_name;
@@ -248,6 +401,7 @@ namespace eCAL
     // build unique memory file name
     m_base_name = base_name_;
     m_memfile_name = eCAL::memfile::BuildRandomMemFileName(base_name_);
+    m_memfile_id   = CMemFileReadyQueue::BuildFileId(m_memfile_name);
 
     // create new memory file object
     // with additional space for SMemFileHeader
@@ -255,6 +409,14 @@ namespace eCAL
     // check for minimal size
     if (memfile_size < m_attr.min_size) memfile_size = m_attr.min_size;
 
+    // ring mode: every slot has the (minimal) size of a single buffer file
+    size_t slot_size(0);
+    if (IsRing())
+    {
+      slot_size    = memfile_size - sizeof(SMemFileHeader);
+      memfile_size = CMemoryFileRing::PresumablyOccupiedMemorySize(m_attr.ring_slots, slot_size);
+    }
+
     // create the memory file
     if (!m_memfile.Create(m_memfile_name.c_str(), true, memfile_size))
     {
@@ -266,11 +428,34 @@ namespace eCAL
     Logging::Log(log_level_debug2, std::string("CSyncMemoryFile::Create SUCCESS : ") + m_memfile_name);
 #endif
 
-    // initialize memory file with empty header
-    struct SMemFileHeader memfile_hdr;
-    m_memfile.GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms));
-    m_memfile.WriteBuffer(&memfile_hdr, memfile_hdr.hdr_size, 0);
-    m_memfile.ReleaseWriteAccess();
+    if (IsRing())
+    {
+      // initialize empty ring, the whole file content is owned by the ring
+      m_memfile.GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms));
+      void* ring_address(nullptr);
+      m_memfile.GetWriteAddress(ring_address, memfile_size);
+      if (ring_address != nullptr)
+      {
+        m_ring.SetBaseAddress(ring_address);
+        m_ring.Reset(m_attr.ring_slots, slot_size);
+      }
+      m_memfile.ReleaseWriteAccess();
+
+      if (ring_address == nullptr)
+      {
+        Logging::Log(log_level_error, std::string("CSyncMemoryFile::Create FAILED (ring initialization) : ") + m_memfile_name);
+        m_memfile.Destroy(true);
+        return false;
+      }
+    }
+    else
+    {
+      // initialize memory file with empty header
+      struct SMemFileHeader memfile_hdr;
+      m_memfile.GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms));
+      m_memfile.WriteBuffer(&memfile_hdr, memfile_hdr.hdr_size, 0);
+      m_memfile.ReleaseWriteAccess();
+    }
 
     // it's created
     m_created = true;
@@ -282,6 +467,10 @@ namespace eCAL
   {
     if (!m_created) return false;
 
+    // release a pending loan
+    if (m_loaned && !IsRing()) m_memfile.ReleaseWriteAccess();
+    m_loaned = false;
+
     // state destruction in progress
     m_created = false;
 
@@ -309,14 +498,7 @@ namespace eCAL
   bool CSyncMemoryFile::Recreate(size_t size_)
   {
     // collect id's of the currently connected processes
-    std::vector<std::string> process_id_list;
-    {
-      const std::lock_guard<std::mutex> lock(m_event_handle_map_sync);
-      for (const auto& event_handle : m_event_handle_map)
-      {
-        process_id_list.push_back(event_handle.first);
-      }
-    }
+    const std::vector<std::string> process_id_list = GetConnectedProcesses();
 
     // destroy existing memory file object
     Destroy();
@@ -333,6 +515,34 @@ namespace eCAL
     return true;
   }
 
+  bool CSyncMemoryFile::AcquireWriteAccess()
+  {
+    bool write_access = m_memfile.GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms));
+
+    // maybe it's locked by a zombie or a crashed process
+    // so we try to recreate a new one
+    if (!write_access)
+    {
+#ifndef NDEBUG
+      Logging::Log(log_level_debug2, m_base_name + "::CSyncMemoryFile::GetWriteAccess - FAILED");
+#endif
+
+      // try to recreate the memory file
+      if (!Recreate(m_memfile.MaxDataSize())) return false;
+
+      // then try to get access again
+      write_access = m_memfile.GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms));
+      // still no chance ? hell .... we give up
+      if (!write_access)
+      {
+        Logging::Log(log_level_error, m_base_name + "::CSyncMemoryFile::GetWriteAccess - FAILED FINALLY");
+        return false;
+      }
+    }
+
+    return true;
+  }
+
   void CSyncMemoryFile::SyncContent()
   {
     if (!m_created) return;
@@ -356,6 +566,9 @@ namespace eCAL
     {
       // send sync event
       gSetEvent(event_handle.second.event_snd);
+      // tell the pooled observers of that process which file is updated (lock-free) and wake them up
+      if (event_handle.second.ready_queue) event_handle.second.ready_queue->Push(m_memfile_id);
+      gSetEvent(event_handle.second.event_doorbell);
     }
 
     // wait for acknowledgment event from receiver side
@@ -397,6 +610,16 @@ namespace eCAL
 #endif
   }
 
+  std::shared_ptr<CMemFileReadyQueue> CSyncMemoryFile::OpenReadyQueue(const EventHandleT& event_doorbell_, const std::string& process_id_)
+  {
+    // only subscriber processes with pooled observers (doorbell) have a ready queue
+    if (!gEventIsValid(event_doorbell_)) return nullptr;
+
+    auto ready_queue = std::make_shared<CMemFileReadyQueue>();
+    if (!ready_queue->Create(memfile::BuildReadyQueueName(process_id_), false, EXP_SHM_OBSERVER_QUEUE_SIZE)) return nullptr;
+    return ready_queue;
+  }
+
   void CSyncMemoryFile::DisconnectAll()
   {
     const std::lock_guard<std::mutex> lock(m_event_handle_map_sync);
@@ -412,6 +635,7 @@ namespace eCAL
     {
       gCloseEvent(event_handle.second.event_snd);
       gCloseEvent(event_handle.second.event_ack);
+      gCloseEvent(event_handle.second.event_doorbell);
     }
 
     // invalidate all events
@@ -419,6 +643,7 @@ namespace eCAL
     {
       gInvalidateEvent(&event_handle.second.event_snd);
       gInvalidateEvent(&event_handle.second.event_ack);
+      gInvalidateEvent(&event_handle.second.event_doorbell);
     }
 
     // clear event map
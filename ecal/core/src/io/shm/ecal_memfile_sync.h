@@ -30,10 +30,14 @@
 
 #include "readwrite/ecal_writer_data.h"
 #include "ecal_memfile.h"
+#include "ecal_memfile_ready_queue.h"
+#include "ecal_memfile_ring.h"
 
+#include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace eCAL
 {
@@ -43,6 +47,7 @@ namespace eCAL
     size_t  reserve;            //!< dynamic file size reserve before recreating memory file if payload size changes [%]
     int64_t timeout_open_ms;    //!< timeout to open a memory file using mutex lock [ms]
     int64_t timeout_ack_ms;     //!< timeout for memory read acknowledge signal from data reader [ms]
+    size_t  ring_slots;         //!< number of lock-free ring slots (0 = single mutex protected buffer)
   };
 
   class CSyncMemoryFile
@@ -57,28 +62,43 @@ namespace eCAL
     bool CheckSize(size_t size_);
     bool Write(CPayloadWriter& payload_, const SWriterAttr& data_, bool force_full_write_ = false);
 
+    // loaned payload buffer, filled by the user and published on commit
+    void* Loan(size_t len_);
+    bool Commit(const SWriterAttr& data_);
+    bool Discard();
+
     std::string GetName() const;
     size_t GetSize() const;
     bool IsCreated() const { return m_created; };
+    bool IsRing() const { return m_attr.ring_slots > 0; };
+    bool IsLocked();
+    std::vector<std::string> GetConnectedProcesses();
 
   protected:
     bool Create(const std::string& base_name_, size_t size_);
     bool Destroy();
     bool Recreate(size_t size_);
+    bool AcquireWriteAccess();
 
     void SyncContent();
     void DisconnectAll();
+    std::shared_ptr<CMemFileReadyQueue> OpenReadyQueue(const EventHandleT& event_doorbell_, const std::string& process_id_);
 
     std::string         m_base_name;
     std::string         m_memfile_name;
+    std::uint64_t       m_memfile_id;
     CMemoryFile         m_memfile;
+    CMemoryFileRing     m_ring;
     SSyncMemoryFileAttr m_attr;
     bool                m_created;
+    bool                m_loaned;
 
     struct SEventHandlePair
     {
       EventHandleT event_snd;
       EventHandleT event_ack;
+      EventHandleT event_doorbell;                  //!< Process wide wake up event, only existing if the subscriber process uses pooled memory file observers.
+      std::shared_ptr<CMemFileReadyQueue> ready_queue; //!< Process wide queue of updated memory files, next to the doorbell.
       bool         event_ack_is_invalid = false;    //!< The ack event has timeouted. Thus, we don't wait for it anymore, until the subscriber notifies us via registration layer that it is still alive.
     };
     using EventHandleMapT = std::unordered_map<std::string, SEventHandlePair>;
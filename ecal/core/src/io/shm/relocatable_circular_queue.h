@@ -192,7 +192,7 @@ public:
   std::size_t MaxSize() const
   {
     assert(m_base_address != nullptr);
-    return m_header->max;
+    return m_header->max_size;
   }
 
   std::size_t OccupiedMemorySize() const
@@ -24,115 +24,60 @@
 #include "ecal_udp_sample_receiver.h"
 #include "io/udp/fragmentation/msg_type.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <ecal/ecal_config.h>
 #include <ecal/ecal_log.h>
 #include <memory>
 #include <string>
 #include <vector>
 #include <iostream>
 
+namespace
+{
+  // receive buffer slot size, rounded up so that every message header is properly aligned
+  constexpr size_t MsgSlotSize()
+  {
+    return (MSG_BUFFER_SIZE + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+  }
+}
+
 namespace eCAL
 {
   namespace UDP
   {
-    CSampleReceiver::CSampleDefragmentation::CSampleDefragmentation(CSampleReceiver* sample_receiver_)
-      : m_sample_receiver(sample_receiver_)
+    CSampleReceiver::CSampleReassembly::CSampleReassembly(CSampleReceiver* sample_receiver_)
+      : CMsgReassembly(NET_UDP_REASSEMBLY_MAX_MESSAGES, std::chrono::milliseconds(NET_UDP_RECBUFFER_TIMEOUT), static_cast<size_t>(std::max(Config::GetUdpMulticastMaxMessageSizeBytes(), 0)))
+      , m_sample_receiver(sample_receiver_)
     {
     }
 
-    CSampleReceiver::CSampleDefragmentation::~CSampleDefragmentation() = default;
-
-    int CSampleReceiver::CSampleDefragmentation::OnMessageCompleted(std::vector<char>&& msg_buffer_)
+    void CSampleReceiver::CSampleReassembly::OnMessageCompleted(const char* buf_, size_t len_)
     {
-      if (m_sample_receiver == nullptr) return(0);
-
-      // read sample_name size
-      const unsigned short sample_name_size = ((unsigned short*)(msg_buffer_.data()))[0];
-
-      // check for damaged data
-      if (sample_name_size > msg_buffer_.size())
-      {
-        std::cerr << "CSampleReceiver: Received damaged data. Wrong sample name size." << '\n';
-        return(0);
-      }
-
-      // read sample_name
-      const std::string sample_name(msg_buffer_.data() + sizeof(sample_name_size));
-
-      // calculate payload offset
-      auto payload_offset = sizeof(sample_name_size) + sample_name_size;
+      if (m_sample_receiver == nullptr) return;
 
-      // check for damaged data
-      if (payload_offset > msg_buffer_.size())
-      {
-        std::cerr << "CSampleReceiverAsio: Received damaged data. Wrong payload buffer offset." << '\n';
-        return(0);
-      }
-
-      if (m_sample_receiver->m_has_sample_callback(sample_name))
-      {
-        // read sample
-        if (!m_ecal_sample.ParseFromArray(msg_buffer_.data() + payload_offset, static_cast<int>(msg_buffer_.size() - (sizeof(sample_name_size) + sample_name_size)))) return(0);
-#ifndef NDEBUG
-        // log it
-        eCAL::Logging::Log(log_level_debug3, sample_name + "::UDP Sample Completed");
-
-        // log it
-        switch (m_ecal_sample.cmd_type())
-        {
-        case eCAL::pb::bct_none:
-          eCAL::Logging::Log(log_level_debug4, sample_name + "::UDP Sample Command Type - NONE");
-          break;
-        case eCAL::pb::bct_set_sample:
-          eCAL::Logging::Log(log_level_debug4, sample_name + "::UDP Sample Command Type - SAMPLE");
-          break;
-        case eCAL::pb::bct_reg_publisher:
-          eCAL::Logging::Log(log_level_debug4, sample_name + "::UDP Sample Command Type - REGISTER PUBLISHER");
-          break;
-        case eCAL::pb::bct_reg_subscriber:
-          eCAL::Logging::Log(log_level_debug4, sample_name + "::UDP Sample Command Type - REGISTER SUBSCRIBER");
-          break;
-        case eCAL::pb::bct_reg_process:
-          eCAL::Logging::Log(log_level_debug4, sample_name + "::UDP Sample Command Type - REGISTER PROCESS");
-          break;
-        case eCAL::pb::bct_reg_service:
-          eCAL::Logging::Log(log_level_debug4, sample_name + "::UDP Sample Command Type - REGISTER SERVER");
-          break;
-        case eCAL::pb::bct_reg_client:
-          eCAL::Logging::Log(log_level_debug4, sample_name + "::UDP Sample Command Type - REGISTER CLIENT");
-          break;
-        default:
-          eCAL::Logging::Log(log_level_debug4, sample_name + "::UDP Sample Command Type - UNKNOWN");
-          break;
-        }
-#endif
-        // get layer if this is a payload sample
-        eCAL::pb::eTLayerType layer = eCAL::pb::eTLayerType::tl_none;
-        if (m_ecal_sample.cmd_type() == eCAL::pb::eCmdType::bct_set_sample)
-        {
-          if (m_ecal_sample.topic().tlayer_size() > 0)
-          {
-            layer = m_ecal_sample.topic().tlayer(0).type();
-          }
-        }
-        // apply sample
-        m_sample_receiver->m_apply_sample_callback(m_ecal_sample, layer);
-      }
+      // apply sample (the payload is passed without copying it)
+      m_sample_receiver->ApplySampleBuffer(buf_, len_, m_sample_receiver->m_ecal_sample);
+    }
 
-      return(0);
+    void CSampleReceiver::CSampleReassembly::OnMessageTooLarge(int32_t message_id_, size_t len_)
+    {
+      eCAL::Logging::Log(log_level_debug1, "CSampleReceiver: dropped UDP message " + std::to_string(message_id_) + " (" + std::to_string(len_) + " Bytes exceed multicast_max_message_size)");
     }
 
-    CSampleReceiver::CSampleReceiver(const IO::UDP::SReceiverAttr& attr_, HasSampleCallbackT has_sample_callback_, ApplySampleCallbackT apply_sample_callback_) :
-      m_has_sample_callback(has_sample_callback_), m_apply_sample_callback(apply_sample_callback_)
+    CSampleReceiver::CSampleReceiver(const IO::UDP::SReceiverAttr& attr_, HasSampleCallbackT has_sample_callback_, ApplySampleCallbackT apply_sample_callback_, ApplyRawSampleCallbackT apply_raw_sample_callback_ /*= nullptr*/) :
+      m_has_sample_callback(has_sample_callback_), m_apply_sample_callback(apply_sample_callback_), m_apply_raw_sample_callback(apply_raw_sample_callback_),
+      m_reassembly(this)
     {
       // create udp receiver
       m_udp_receiver.Create(attr_);
 
-      // allocate receive buffer
-      m_msg_buffer.resize(MSG_BUFFER_SIZE);
+      // allocate receive buffer (one message slot per batched datagram)
+      m_msg_buffer.resize(NET_UDP_RECEIVE_BATCH_SIZE * MsgSlotSize());
+      m_msg_len.resize(NET_UDP_RECEIVE_BATCH_SIZE);
 
       // start receiver thread
       m_udp_receiver_thread = std::make_shared<eCAL::CCallbackThread>(std::bind(&CSampleReceiver::ReceiveThread, this));
@@ -160,13 +105,21 @@ namespace eCAL
       return m_udp_receiver.RemMultiCastGroup(ipaddr_);
     }
 
+    IO::UDP::SReassemblyCounters CSampleReceiver::GetReassemblyCounters() const
+    {
+      return m_reassembly.GetCounters();
+    }
+
     void CSampleReceiver::ReceiveThread()
     {
-      // wait for any incoming message
-      const size_t recv_len = m_udp_receiver.Receive(m_msg_buffer.data(), m_msg_buffer.size(), CMN_UDP_RECEIVE_THREAD_CYCLE_TIME_MS);
-      if (recv_len > 0)
+      // wait for any incoming message and fetch all pending ones at once
+      const size_t recv_num = m_udp_receiver.ReceiveMultiple(m_msg_buffer.data(), MsgSlotSize(), m_msg_len.size(), m_msg_len.data(), CMN_UDP_RECEIVE_THREAD_CYCLE_TIME_MS);
+      for (size_t idx = 0; idx < recv_num; ++idx)
       {
-        Process(m_msg_buffer.data(), recv_len);
+        if (m_msg_len[idx] > 0)
+        {
+          Process(m_msg_buffer.data() + idx * MsgSlotSize(), m_msg_len[idx]);
+        }
       }
     }
 
@@ -236,81 +189,19 @@ namespace eCAL
       {
       case IO::UDP::msg_type_header_with_content:
       {
-        // read sample_name size
-        unsigned short sample_name_size = 0;
-        memcpy(&sample_name_size, ecal_message->payload, 2);
-        // read sample_name
-        const std::string sample_name = ecal_message->payload + sizeof(sample_name_size);
-
-        if (m_has_sample_callback(sample_name))
-        {
-          // read sample
-          if (!m_ecal_sample.ParseFromArray(ecal_message->payload + static_cast<size_t>(sizeof(sample_name_size) + sample_name_size), static_cast<int>(static_cast<size_t>(ecal_message->header.len) - (sizeof(sample_name_size) + sample_name_size)))) return;
-
-#ifndef NDEBUG
-          // log it
-          eCAL::Logging::Log(log_level_debug3, sample_name + "::UDP Sample Completed");
-
-          // log it
-          switch (m_ecal_sample.cmd_type())
-          {
-          case eCAL::pb::bct_none:
-            eCAL::Logging::Log(log_level_debug4, sample_name + "::UDP Sample Command Type - NONE");
-            break;
-          case eCAL::pb::bct_set_sample:
-            eCAL::Logging::Log(log_level_debug4, sample_name + "::UDP Sample Command Type - SAMPLE");
-            break;
-          case eCAL::pb::bct_reg_publisher:
-            eCAL::Logging::Log(log_level_debug4, sample_name + "::UDP Sample Command Type - REGISTER PUBLISHER");
-            break;
-          case eCAL::pb::bct_reg_subscriber:
-            eCAL::Logging::Log(log_level_debug4, sample_name + "::UDP Sample Command Type - REGISTER SUBSCRIBER");
-            break;
-          case eCAL::pb::bct_reg_process:
-            eCAL::Logging::Log(log_level_debug4, sample_name + "::UDP Sample Command Type - REGISTER PROCESS");
-            break;
-          case eCAL::pb::bct_reg_service:
-            eCAL::Logging::Log(log_level_debug4, sample_name + "::UDP Sample Command Type - REGISTER SERVICE");
-            break;
-          case eCAL::pb::bct_reg_client:
-            eCAL::Logging::Log(log_level_debug4, sample_name + "::UDP Sample Command Type - REGISTER CLIENT");
-            break;
-          default:
-            eCAL::Logging::Log(log_level_debug4, sample_name + "::UDP Sample Command Type - UNKNOWN");
-            break;
-          }
-#endif
-          // get layer if this is a payload sample
-          eCAL::pb::eTLayerType layer = eCAL::pb::eTLayerType::tl_none;
-          if (m_ecal_sample.cmd_type() == eCAL::pb::eCmdType::bct_set_sample)
-          {
-            if (m_ecal_sample.topic().tlayer_size() > 0)
-            {
-              layer = m_ecal_sample.topic().tlayer(0).type();
-            }
-          }
-          // apply sample
-          m_apply_sample_callback(m_ecal_sample, layer);
-        }
+        // apply sample
+        ApplySampleBuffer(ecal_message->payload, static_cast<size_t>(ecal_message->header.len), m_ecal_sample);
       }
       break;
       // if we have a header only package 
-      // we create a receive defragmentation buffer and apply it to the receive defragmentation map
-      // to process the following data packages
+      // we start reassembling the message to process the following data packages
       // we do not know the name here unfortunately
       // so we have to wait for the first payload package :-(
       case IO::UDP::msg_type_header:
-      {
-        // create new receive defragmentation buffer
-        std::shared_ptr<CSampleDefragmentation> receive_defragmentation_buf(nullptr);
-        receive_defragmentation_buf = std::make_shared<CSampleDefragmentation>(CSampleDefragmentation(this));
-        m_defrag_sample_map[ecal_message->header.id] = receive_defragmentation_buf;
-        // apply message
-        receive_defragmentation_buf->ApplyMessage(*ecal_message);
-      }
-      break;
+        m_reassembly.ApplyMessage(*ecal_message);
+        break;
       // if we have a payload package 
-      // we check for an existing receive defragmentation buffer and apply the data to it
+      // we apply it to the matching message (if it is reassembled)
       case IO::UDP::msg_type_content:
       {
         // first data package ?
@@ -320,69 +211,143 @@ namespace eCAL
           unsigned short sample_name_size = 0;
           memcpy(&sample_name_size, ecal_message->payload, 2);
           // read sample_name
-          const std::string sample_name = ecal_message->payload + sizeof(sample_name_size);
+          m_sample_name.assign(ecal_message->payload + sizeof(sample_name_size));
 
-          // remove the matching defragmentation buffer if we are not interested in this sample
-          if (!m_has_sample_callback(sample_name))
+          // stop reassembling the message if we are not interested in this sample
+          if (!m_has_sample_callback(m_sample_name))
           {
-            auto riter = m_defrag_sample_map.find(ecal_message->header.id);
-            if (riter != m_defrag_sample_map.end())
-            {
 #ifndef NDEBUG
-              // log timeouted defragmentation buffers
-              eCAL::Logging::Log(log_level_debug3, "CUDPSampleReceiver::Receive - DISCARD PACKAGE FOR TOPIC: " + sample_name);
+            // log it
+            eCAL::Logging::Log(log_level_debug3, "CUDPSampleReceiver::Receive - DISCARD PACKAGE FOR TOPIC: " + m_sample_name);
 #endif
-              m_defrag_sample_map.erase(riter);
-              break;
-            }
+            m_reassembly.DiscardMessage(ecal_message->header.id);
+            break;
           }
         }
 
         // process data package
-        auto iter = m_defrag_sample_map.find(ecal_message->header.id);
-        if (iter != m_defrag_sample_map.end())
-        {
-          // apply message
-          iter->second->ApplyMessage(*ecal_message);
-        }
+        m_reassembly.ApplyMessage(*ecal_message);
       }
       break;
       default:
         break;
       }
 
-      // cleanup finished or zombie received defragmentation buffers
+      // cleanup zombie messages
       auto diff_time = std::chrono::steady_clock::now() - m_cleanup_start;
       const std::chrono::duration<double> step_time = std::chrono::milliseconds(NET_UDP_RECBUFFER_CLEANUP);
       if (diff_time > step_time)
       {
         m_cleanup_start = std::chrono::steady_clock::now();
+        m_reassembly.RemoveTimedOutMessages();
+      }
+    }
+
+    void CSampleReceiver::ApplySampleBuffer(const char* buf_, size_t len_, eCAL::pb::Sample& ecal_sample_)
+    {
+      // read sample_name size
+      unsigned short sample_name_size = 0;
+      if (len_ < sizeof(sample_name_size)) return;
+      memcpy(&sample_name_size, buf_, sizeof(sample_name_size));
+
+      // calculate sample offset and check for damaged data
+      const size_t sample_offset = sizeof(sample_name_size) + sample_name_size;
+      if ((sample_name_size == 0) || (sample_offset > len_))
+      {
+        std::cerr << "CSampleReceiver: Received damaged data. Wrong sample name size." << '\n';
+        return;
+      }
+
+      // read sample_name (reusing the string capacity)
+      m_sample_name.assign(buf_ + sizeof(sample_name_size), sample_name_size - 1);
+      if (!m_has_sample_callback(m_sample_name)) return;
+
+      const char*  sample_buf = buf_ + sample_offset;
+      const size_t sample_len = len_ - sample_offset;
+
+      // raw payload sample, no protobuf parsing needed
+      if ((sample_len >= sizeof(IO::UDP::SUDPRawSampleHead)) && (sample_buf[0] == '\0'))
+      {
+        ApplyRawSample(m_sample_name, sample_buf, sample_len);
+        return;
+      }
+
+      // read sample
+      if (!ecal_sample_.ParseFromArray(sample_buf, static_cast<int>(sample_len))) return;
 
-        for (SampleDefragmentationMapT::iterator riter = m_defrag_sample_map.begin(); riter != m_defrag_sample_map.end();)
-        {
-          const bool finished = riter->second->HasFinished();
-          const bool timeouted = riter->second->HasTimedOut(step_time);
-          if (finished || timeouted)
-          {
-#ifndef NDEBUG
-            const int32_t total_len = riter->second->GetMessageTotalLength();
-            const int32_t current_len = riter->second->GetMessageCurrentLength();
-#endif
-            riter = m_defrag_sample_map.erase(riter);
 #ifndef NDEBUG
-            // log timeouted defragmentation buffer
-            if (timeouted)
-            {
-              eCAL::Logging::Log(log_level_debug3, "CUDPSampleReceiver::Receive - TIMEOUT (TotalLength / CurrentLength):  " + std::to_string(total_len) + " / " + std::to_string(current_len));
-            }
+      // log it
+      eCAL::Logging::Log(log_level_debug3, m_sample_name + "::UDP Sample Completed");
+
+      // log it
+      switch (ecal_sample_.cmd_type())
+      {
+      case eCAL::pb::bct_none:
+        eCAL::Logging::Log(log_level_debug4, m_sample_name + "::UDP Sample Command Type - NONE");
+        break;
+      case eCAL::pb::bct_set_sample:
+        eCAL::Logging::Log(log_level_debug4, m_sample_name + "::UDP Sample Command Type - SAMPLE");
+        break;
+      case eCAL::pb::bct_reg_publisher:
+        eCAL::Logging::Log(log_level_debug4, m_sample_name + "::UDP Sample Command Type - REGISTER PUBLISHER");
+        break;
+      case eCAL::pb::bct_reg_subscriber:
+        eCAL::Logging::Log(log_level_debug4, m_sample_name + "::UDP Sample Command Type - REGISTER SUBSCRIBER");
+        break;
+      case eCAL::pb::bct_reg_process:
+        eCAL::Logging::Log(log_level_debug4, m_sample_name + "::UDP Sample Command Type - REGISTER PROCESS");
+        break;
+      case eCAL::pb::bct_reg_service:
+        eCAL::Logging::Log(log_level_debug4, m_sample_name + "::UDP Sample Command Type - REGISTER SERVICE");
+        break;
+      case eCAL::pb::bct_reg_client:
+        eCAL::Logging::Log(log_level_debug4, m_sample_name + "::UDP Sample Command Type - REGISTER CLIENT");
+        break;
+      default:
+        eCAL::Logging::Log(log_level_debug4, m_sample_name + "::UDP Sample Command Type - UNKNOWN");
+        break;
+      }
 #endif
-          }
-          else
-          {
-            ++riter;
-          }
+      // get layer if this is a payload sample
+      eCAL::pb::eTLayerType layer = eCAL::pb::eTLayerType::tl_none;
+      if (ecal_sample_.cmd_type() == eCAL::pb::eCmdType::bct_set_sample)
+      {
+        if (ecal_sample_.topic().tlayer_size() > 0)
+        {
+          layer = ecal_sample_.topic().tlayer(0).type();
         }
       }
+      // apply sample
+      m_apply_sample_callback(ecal_sample_, layer, sample_buf, sample_len);
+    }
+
+    void CSampleReceiver::ApplyRawSample(const std::string& sample_name_, const char* buf_, size_t len_)
+    {
+      // read sample head
+      IO::UDP::SUDPRawSampleHead sample_head;
+      memcpy(&sample_head, buf_, sizeof(IO::UDP::SUDPRawSampleHead));
+
+      // check for damaged data
+      if (!IO::UDP::IsValidRawSampleHead(sample_head, len_))
+      {
+        std::cerr << "CSampleReceiver: Received damaged data. Wrong raw sample header." << '\n';
+        return;
+      }
+
+#ifndef NDEBUG
+      // log it
+      eCAL::Logging::Log(log_level_debug3, sample_name_ + "::UDP Raw Sample Completed");
+#endif
+
+      if (!m_apply_raw_sample_callback) return;
+
+      // read topic id (reusing the string capacity)
+      const char* topic_id = buf_ + sample_head.hdr_size;
+      m_raw_sample_topic_id.assign(topic_id, sample_head.topic_id_size);
+
+      // apply sample
+      m_apply_raw_sample_callback(sample_name_, m_raw_sample_topic_id, topic_id + sample_head.topic_id_size, static_cast<size_t>(sample_head.payload_size),
+        static_cast<long long>(sample_head.id), static_cast<long long>(sample_head.clock), static_cast<long long>(sample_head.time), static_cast<size_t>(sample_head.hash));
     }
   }
 }
@@ -33,7 +33,6 @@
 #include <functional>
 #include <memory>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #ifdef _MSC_VER
@@ -52,44 +51,54 @@ namespace eCAL
     {
     public:
       using HasSampleCallbackT   = std::function<bool(const std::string& sample_name_)>;
-      using ApplySampleCallbackT = std::function<void(const eCAL::pb::Sample& ecal_sample_, eCAL::pb::eTLayerType layer_)>;
+      // the sample is parsed from serialized_buf_ (both are valid during the callback only)
+      using ApplySampleCallbackT = std::function<void(const eCAL::pb::Sample& ecal_sample_, eCAL::pb::eTLayerType layer_, const char* serialized_buf_, size_t serialized_len_)>;
+      using ApplyRawSampleCallbackT = std::function<void(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_)>;
 
-      CSampleReceiver(const IO::UDP::SReceiverAttr& attr_, HasSampleCallbackT has_sample_callback_, ApplySampleCallbackT apply_sample_callback_);
+      CSampleReceiver(const IO::UDP::SReceiverAttr& attr_, HasSampleCallbackT has_sample_callback_, ApplySampleCallbackT apply_sample_callback_, ApplyRawSampleCallbackT apply_raw_sample_callback_ = nullptr);
       virtual ~CSampleReceiver();
 
       bool AddMultiCastGroup(const char* ipaddr_);
       bool RemMultiCastGroup(const char* ipaddr_);
 
+      IO::UDP::SReassemblyCounters GetReassemblyCounters() const;
+
     protected:
       void ReceiveThread();
       void Process(const char* sample_buffer_, size_t sample_buffer_len_);
 
+      // apply a complete message (sample name followed by a protobuf or a raw sample)
+      void ApplySampleBuffer(const char* buf_, size_t len_, eCAL::pb::Sample& ecal_sample_);
+      void ApplyRawSample(const std::string& sample_name_, const char* buf_, size_t len_);
+
       HasSampleCallbackT                      m_has_sample_callback;
       ApplySampleCallbackT                    m_apply_sample_callback;
+      ApplyRawSampleCallbackT                 m_apply_raw_sample_callback;
+      std::string                             m_raw_sample_topic_id;
+      std::string                             m_sample_name;
 
       IO::UDP::CUDPReceiver                   m_udp_receiver;
       std::shared_ptr<eCAL::CCallbackThread>  m_udp_receiver_thread;
 
       std::vector<char>                       m_msg_buffer;
+      std::vector<size_t>                     m_msg_len;
       eCAL::pb::Sample                        m_ecal_sample;
 
       std::chrono::steady_clock::time_point   m_cleanup_start;
 
-      class CSampleDefragmentation : public IO::UDP::CMsgDefragmentation
+      class CSampleReassembly : public IO::UDP::CMsgReassembly
       {
       public:
-        explicit CSampleDefragmentation(CSampleReceiver* sample_receiver_);
-        ~CSampleDefragmentation() override;
-
-        int OnMessageCompleted(std::vector<char>&& msg_buffer_) override;
+        explicit CSampleReassembly(CSampleReceiver* sample_receiver_);
 
       protected:
+        void OnMessageCompleted(const char* buf_, size_t len_) override;
+        void OnMessageTooLarge(int32_t message_id_, size_t len_) override;
+
         CSampleReceiver* m_sample_receiver;
-        eCAL::pb::Sample m_ecal_sample;
       };
 
-      using SampleDefragmentationMapT = std::unordered_map<int32_t, std::shared_ptr<CSampleDefragmentation>>;
-      SampleDefragmentationMapT               m_defrag_sample_map;
+      CSampleReassembly                       m_reassembly;
     };
   }
 }
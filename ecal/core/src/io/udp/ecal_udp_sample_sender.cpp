@@ -33,9 +33,9 @@
 
 namespace
 {
-  size_t TransmitToUDP(const void* buf_, const size_t len_, const std::shared_ptr<IO::UDP::CUDPSender>& sample_sender_, const std::string& mcast_address_)
+  size_t TransmitDatagramListToUDP(const IO::UDP::SDatagramList& datagram_list_, const std::shared_ptr<IO::UDP::CUDPSender>& sample_sender_, const std::string& mcast_address_)
   {
-    return (sample_sender_->Send(buf_, len_, mcast_address_.c_str()));
+    return (sample_sender_->Send(datagram_list_, mcast_address_.c_str()));
   }
 }
 
@@ -60,7 +60,7 @@ namespace eCAL
       if (data_size > 0)
       {
         // and send it
-        sent_sum = SendFragmentedMessage(m_payload.data(), data_size, bandwidth_, std::bind(TransmitToUDP, std::placeholders::_1, std::placeholders::_2, m_udp_sender, m_attr.address));
+        sent_sum = SendFragmentedMessage(m_payload.data(), data_size, bandwidth_, std::bind(TransmitDatagramListToUDP, std::placeholders::_1, m_udp_sender, m_attr.address));
 
 #ifndef NDEBUG
         // log it
@@ -71,5 +71,64 @@ namespace eCAL
       // return bytes sent
       return(sent_sum);
     }
+
+    size_t CSampleSender::Send(const std::string& sample_name_, const eCAL::pb::Sample& ecal_sample_, const void* payload_, size_t payload_len_, long bandwidth_)
+    {
+      if (!m_udp_sender) return(0);
+
+      std::lock_guard<std::mutex> const send_lock(m_payload_mutex);
+      // return value
+      size_t sent_sum(0);
+
+      // only the sample head is serialized, the payload is gathered from the callers buffer
+      const size_t head_size = IO::UDP::CreateSampleHeadBuffer(sample_name_, ecal_sample_, payload_len_, m_payload);
+      if (head_size > 0)
+      {
+        IO::UDP::SendBufferListT buf_list;
+        buf_list.emplace_back(m_payload.data(), head_size);
+        if (payload_len_ > 0) buf_list.emplace_back(static_cast<const char*>(payload_), payload_len_);
+
+        // and send it
+        sent_sum = SendFragmentedMessage(buf_list, bandwidth_, std::bind(TransmitDatagramListToUDP, std::placeholders::_1, m_udp_sender, m_attr.address));
+
+#ifndef NDEBUG
+        // log it
+        eCAL::Logging::Log(log_level_debug4, "UDP Sample Buffer Sent (" + std::to_string(sent_sum) + " Bytes)");
+#endif
+      }
+
+      // return bytes sent
+      return(sent_sum);
+    }
+
+    size_t CSampleSender::Send(const std::string& sample_name_, const std::string& topic_id_, const IO::UDP::SUDPRawSampleHead& sample_head_, const void* payload_, long bandwidth_)
+    {
+      if (!m_udp_sender) return(0);
+
+      std::lock_guard<std::mutex> const send_lock(m_payload_mutex);
+      // return value
+      size_t sent_sum(0);
+
+      const size_t head_size = IO::UDP::CreateRawSampleHeadBuffer(sample_name_, topic_id_, sample_head_, m_payload);
+      if (head_size > 0)
+      {
+        const size_t payload_len = static_cast<size_t>(sample_head_.payload_size);
+
+        IO::UDP::SendBufferListT buf_list;
+        buf_list.emplace_back(m_payload.data(), head_size);
+        if (payload_len > 0) buf_list.emplace_back(static_cast<const char*>(payload_), payload_len);
+
+        // and send it
+        sent_sum = SendFragmentedMessage(buf_list, bandwidth_, std::bind(TransmitDatagramListToUDP, std::placeholders::_1, m_udp_sender, m_attr.address));
+
+#ifndef NDEBUG
+        // log it
+        eCAL::Logging::Log(log_level_debug4, "UDP Raw Sample Buffer Sent (" + std::to_string(sent_sum) + " Bytes)");
+#endif
+      }
+
+      // return bytes sent
+      return(sent_sum);
+    }
   }
 }
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include "io/udp/fragmentation/msg_type.h"
 #include "io/udp/sendreceive/udp_sender.h"
 #include <cstddef>
 #include <string>
@@ -48,6 +49,10 @@ namespace eCAL
     public:
       CSampleSender(const IO::UDP::SSenderAttr& attr_);
       size_t Send(const std::string& sample_name_, const eCAL::pb::Sample& ecal_sample_, long bandwidth_);
+      // send sample with the payload appended from an external buffer (no payload copy)
+      size_t Send(const std::string& sample_name_, const eCAL::pb::Sample& ecal_sample_, const void* payload_, size_t payload_len_, long bandwidth_);
+      // send raw payload sample (binary header, no protobuf serialization)
+      size_t Send(const std::string& sample_name_, const std::string& topic_id_, const IO::UDP::SUDPRawSampleHead& sample_head_, const void* payload_, long bandwidth_);
 
     private:
       IO::UDP::SSenderAttr                 m_attr;
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace IO
@@ -63,5 +64,38 @@ namespace IO
       struct SUDPMessageHead header;
       char                   payload[MSG_PAYLOAD_SIZE]{};
     };
+
+    // fixed layout head of a raw payload sample, the complete (defragmented) message is
+    //   sample name size | sample name | SUDPRawSampleHead | topic id | payload
+    // a serialized protobuf sample never starts with a zero byte, so both can be distinguished
+#pragma pack(push, 1)
+    struct SUDPRawSampleHead
+    {
+      char     head[4]       = { '\0', 'R', 'A', 'W' };
+      uint16_t hdr_size      = sizeof(SUDPRawSampleHead);  // newer versions may append fields
+      uint16_t version       = 1;
+      int64_t  id            = 0;
+      int64_t  clock         = 0;
+      int64_t  time          = 0;
+      uint64_t hash          = 0;
+      uint64_t payload_size  = 0;
+      uint16_t topic_id_size = 0;
+    };
+#pragma pack(pop)
+
+    // check a received raw sample head against the length of the received sample,
+    // every size is compared on its own (they come from the network and may overflow a sum)
+    inline bool IsValidRawSampleHead(const SUDPRawSampleHead& sample_head_, size_t len_)
+    {
+      if ((sample_head_.head[1] != 'R') || (sample_head_.head[2] != 'A') || (sample_head_.head[3] != 'W')) return false;
+      if (sample_head_.hdr_size < sizeof(SUDPRawSampleHead))                                               return false;
+
+      size_t remaining = len_;
+      if (sample_head_.hdr_size > remaining)      return false;
+      remaining -= sample_head_.hdr_size;
+      if (sample_head_.topic_id_size > remaining) return false;
+      remaining -= sample_head_.topic_id_size;
+      return sample_head_.payload_size <= remaining;
+    }
   }
 }
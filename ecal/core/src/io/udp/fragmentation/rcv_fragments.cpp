@@ -18,43 +18,53 @@
 */
 
 /**
- * @brief  UDP sample receiver to receive messages of type eCAL::pb::Sample
+ * @brief  UDP message reassembly into pooled buffers
 **/
 
-
 #include "rcv_fragments.h"
 #include "msg_type.h"
 
-#include <chrono>
-#include <ecal/ecal_log.h>
-
+#include <algorithm>
 #include <cstring>
-#include <string>
 #include <utility>
 
+namespace
+{
+  // smallest allocation granularity
+  constexpr size_t min_granularity = 4 * 1024;
+
+  // round up to an eighth of the next lower power of two (less than 12.5% waste)
+  size_t BufferSize(size_t len_)
+  {
+    size_t power(1);
+    while (power <= len_ / 2) power <<= 1;
+    const size_t granularity = std::max(power / 8, min_granularity);
+    return (len_ + granularity - 1) / granularity * granularity;
+  }
+}
+
 namespace IO
 {
   namespace UDP
   {
-    CMsgDefragmentation::CMsgDefragmentation()
-      : m_timeout(0.0)
-      , m_recv_mode(rcm_waiting)
-      , m_message_id(0)
-      , m_message_total_num(0)
-      , m_message_total_len(0)
-      , m_message_curr_num(0)
-      , m_message_curr_len(0)
+    CMsgReassembly::CMsgReassembly(size_t max_messages_ /*= NET_UDP_REASSEMBLY_MAX_MESSAGES*/, const std::chrono::milliseconds& timeout_ /*= std::chrono::milliseconds(NET_UDP_RECBUFFER_TIMEOUT)*/,
+                                   size_t max_message_size_ /*= NET_UDP_REASSEMBLY_MAX_MESSAGE_SIZE*/, size_t max_pool_size_ /*= NET_UDP_REASSEMBLY_MAX_POOL_SIZE*/)
+      : m_messages(max_messages_ > 0 ? max_messages_ : 1)
+      , m_timeout(timeout_)
+      , m_max_message_size(max_message_size_)
+      , m_max_pool_size(max_pool_size_)
+      , m_pool_size(0)
+      , m_in_flight(0)
+      , m_completed(0)
+      , m_timed_out(0)
+      , m_dropped(0)
     {
     }
 
-    CMsgDefragmentation::~CMsgDefragmentation() = default;
+    CMsgReassembly::~CMsgReassembly() = default;
 
-    int CMsgDefragmentation::ApplyMessage(const struct SUDPMessage& ecal_message_)
+    void CMsgReassembly::ApplyMessage(const struct SUDPMessage& ecal_message_)
     {
-      // reset timeout
-      m_timeout = std::chrono::duration<double>(0.0);
-
-      // process current packet
       switch (ecal_message_.header.type)
       {
         // new message started
@@ -63,92 +73,185 @@ namespace IO
         break;
         // message data package
       case msg_type_content:
-        if (m_recv_mode == rcm_reading)
-        {
-          OnMessageData(ecal_message_);
-        }
+        OnMessageData(ecal_message_);
+        break;
+      default:
         break;
       }
+    }
 
-      // we have a complete message in the receive buffer
-      if (m_recv_mode == rcm_completed)
+    void CMsgReassembly::DiscardMessage(int32_t message_id_)
+    {
+      SMessage* message = FindMessage(message_id_);
+      if (message != nullptr) ReleaseMessage(*message);
+    }
+
+    void CMsgReassembly::RemoveTimedOutMessages()
+    {
+      const auto now = std::chrono::steady_clock::now();
+      for (auto& message : m_messages)
       {
-        // call complete event
-        OnMessageCompleted(std::move(m_recv_buffer));
+        if (message.active && (now - message.last_update >= m_timeout))
+        {
+          ReleaseMessage(message);
+          m_timed_out++;
+        }
       }
+    }
 
-      return(0);
+    SReassemblyCounters CMsgReassembly::GetCounters() const
+    {
+      SReassemblyCounters counters;
+      counters.in_flight = m_in_flight;
+      counters.completed = m_completed;
+      counters.timed_out = m_timed_out;
+      counters.dropped   = m_dropped;
+      counters.pooled    = m_pool_size;
+      return counters;
     }
 
-    int CMsgDefragmentation::OnMessageStart(const struct SUDPMessage& ecal_message_)
+    void CMsgReassembly::OnMessageStart(const struct SUDPMessage& ecal_message_)
     {
+      if ((ecal_message_.header.num <= 0) || (ecal_message_.header.len < 0))
+      {
+        m_dropped++;
+        return;
+      }
+
+      if (static_cast<size_t>(ecal_message_.header.len) > m_max_message_size)
+      {
+        m_dropped++;
+        OnMessageTooLarge(ecal_message_.header.id, static_cast<size_t>(ecal_message_.header.len));
+        return;
+      }
+
+      // a repeated header restarts the message
+      SMessage* message = FindMessage(ecal_message_.header.id);
+      if (message != nullptr) ReleaseMessage(*message);
+
+      message = FreeMessage();
+
       // store header info
-      m_message_id = ecal_message_.header.id;
-      m_message_total_num = ecal_message_.header.num;
-      m_message_total_len = ecal_message_.header.len;
+      message->active    = true;
+      message->id        = ecal_message_.header.id;
+      message->total_num = ecal_message_.header.num;
+      message->total_len = ecal_message_.header.len;
 
       // reset current message states
-      m_message_curr_num = 0;
-      m_message_curr_len = 0;
+      message->curr_num    = 0;
+      message->curr_len    = 0;
+      message->last_update = std::chrono::steady_clock::now();
 
       // prepare receive buffer
-      m_recv_buffer.reserve(static_cast<size_t>(m_message_total_len));
+      message->buffer = AcquireBuffer(static_cast<size_t>(message->total_len));
+
+      m_in_flight++;
+    }
+
+    void CMsgReassembly::OnMessageData(const struct SUDPMessage& ecal_message_)
+    {
+      SMessage* message = FindMessage(ecal_message_.header.id);
+      if (message == nullptr) return;
+
+      // check current packet counter and length
+      if ((ecal_message_.header.num != message->curr_num)
+        || (ecal_message_.header.len <= 0)
+        || (ecal_message_.header.len > message->total_len - message->curr_len))
+      {
+        ReleaseMessage(*message);
+        m_dropped++;
+        return;
+      }
 
-      // switch to reading mode
-      m_recv_mode = rcm_reading;
+      // copy the message part to its final position in the receive buffer
+      memcpy(message->buffer.data() + message->curr_len, ecal_message_.payload, static_cast<size_t>(ecal_message_.header.len));
 
-      return(0);
+      message->curr_num++;
+      message->curr_len   += ecal_message_.header.len;
+      message->last_update = std::chrono::steady_clock::now();
+
+      // last message packet ? -> hand it over and recycle the buffer
+      if (message->curr_num == message->total_num)
+      {
+        OnMessageCompleted(message->buffer.data(), static_cast<size_t>(message->curr_len));
+        ReleaseMessage(*message);
+        m_completed++;
+      }
     }
 
-    int CMsgDefragmentation::OnMessageData(const struct SUDPMessage& ecal_message_)
+    CMsgReassembly::SMessage* CMsgReassembly::FindMessage(int32_t message_id_)
     {
-      // check message id
-      if (ecal_message_.header.id != m_message_id)
+      for (auto& message : m_messages)
       {
-#ifndef NDEBUG
-        // log it
-        eCAL::Logging::Log(log_level_debug3, "UDP Sample OnMessageData - WRONG MESSAGE PACKET ID " + std::to_string(ecal_message_.header.id));
-#endif
-        m_recv_mode = rcm_aborted;
-        return(-1);
+        if (message.active && (message.id == message_id_)) return &message;
       }
+      return nullptr;
+    }
 
-      // check current packet counter
-      if (ecal_message_.header.num != m_message_curr_num)
+    CMsgReassembly::SMessage* CMsgReassembly::FreeMessage()
+    {
+      // take a free slot or abort the message that was updated least recently
+      SMessage* oldest = &m_messages.front();
+      for (auto& message : m_messages)
       {
-#ifndef NDEBUG
-        // log it
-        eCAL::Logging::Log(log_level_debug3, "UDP Sample OnMessageData - WRONG MESSAGE PACKET NUMBER " + std::to_string(ecal_message_.header.num) + " / " + std::to_string(m_message_curr_num));
-#endif
-        m_recv_mode = rcm_aborted;
-        return(-1);
+        if (!message.active) return &message;
+        if (message.last_update < oldest->last_update) oldest = &message;
       }
 
-      // check current packet length
-      if (ecal_message_.header.len <= 0)
+      ReleaseMessage(*oldest);
+      m_dropped++;
+      return oldest;
+    }
+
+    void CMsgReassembly::ReleaseMessage(SMessage& message_)
+    {
+      if (!message_.active) return;
+
+      RecycleBuffer(std::move(message_.buffer));
+      message_.buffer.clear();
+      message_.active = false;
+      m_in_flight--;
+    }
+
+    std::vector<char> CMsgReassembly::AcquireBuffer(size_t len_)
+    {
+      // take the smallest free buffer that fits
+      auto best_fit = m_buffer_pool.end();
+      for (auto it = m_buffer_pool.begin(); it != m_buffer_pool.end(); ++it)
       {
-#ifndef NDEBUG
-        // log it
-        eCAL::Logging::Log(log_level_debug3, "UDP Sample OnMessageData - WRONG MESSAGE PACKET LENGTH " + std::to_string(ecal_message_.header.len));
-#endif
-        m_recv_mode = rcm_aborted;
-        return(-1);
+        if ((it->size() >= len_) && ((best_fit == m_buffer_pool.end()) || (it->size() < best_fit->size()))) best_fit = it;
+      }
+      if (best_fit != m_buffer_pool.end())
+      {
+        std::vector<char> buffer(std::move(*best_fit));
+        m_buffer_pool.erase(best_fit);
+        m_pool_size -= buffer.size();
+        return buffer;
       }
 
-      // copy the message part to the receive message buffer
-      m_recv_buffer.resize(m_recv_buffer.size() + static_cast<size_t>(ecal_message_.header.len));
-      memcpy(m_recv_buffer.data() + m_recv_buffer.size() - static_cast<size_t>(ecal_message_.header.len), ecal_message_.payload, static_cast<size_t>(ecal_message_.header.len));
+      // no free buffer fits, allocate a new one (the free list can usually hold every in flight message)
+      m_buffer_pool.reserve(m_messages.size());
+      return std::vector<char>(BufferSize(len_));
+    }
 
-      // increase packet counter
-      m_message_curr_num++;
+    void CMsgReassembly::RecycleBuffer(std::vector<char>&& buffer_)
+    {
+      if (buffer_.empty()) return;
 
-      // increase current length
-      m_message_curr_len += ecal_message_.header.len;
+      // buffer does not fit into the pool at all, free it
+      if (buffer_.size() > m_max_pool_size) return;
 
-      // last message packet ? -> switch to completed mode
-      if (m_message_curr_num == m_message_total_num) m_recv_mode = rcm_completed;
+      // make room by freeing the least recently recycled buffers
+      auto evict_end = m_buffer_pool.begin();
+      while (m_pool_size + buffer_.size() > m_max_pool_size)
+      {
+        m_pool_size -= evict_end->size();
+        ++evict_end;
+      }
+      m_buffer_pool.erase(m_buffer_pool.begin(), evict_end);
 
-      return(0);
+      m_pool_size += buffer_.size();
+      m_buffer_pool.push_back(std::move(buffer_));
     }
   }
 }
@@ -18,14 +18,16 @@
 */
 
 /**
- * @brief  UDP sample receiver to receive messages of type eCAL::pb::Sample
+ * @brief  UDP message reassembly into pooled buffers
 **/
 
 #pragma once
 
 #include "ecal_def.h"
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -33,44 +35,91 @@ namespace IO
 {
   namespace UDP
   {
-    class CMsgDefragmentation
+    struct SReassemblyCounters
+    {
+      uint64_t in_flight = 0;  // messages currently reassembled
+      uint64_t completed = 0;  // messages reassembled completely
+      uint64_t timed_out = 0;  // messages removed because packages went missing
+      uint64_t dropped   = 0;  // messages aborted (wrong package order, too large or no free message slot)
+      uint64_t pooled    = 0;  // bytes of free buffers kept for reuse
+    };
+
+    /**
+     * @brief Reassembles fragmented messages of all senders of a socket.
+     *
+     * Every package is copied straight to its final position in a buffer taken
+     * from a pool of free buffers (the smallest one that fits). New buffers are
+     * rounded up to an eighth of their power of two size at most, so a buffer
+     * wastes less than 12.5% and is reused by slightly larger messages. The
+     * buffers are recycled after OnMessageCompleted returns, so once the pool
+     * is warmed up no further memory is allocated.
+     *
+     * Messages larger than max_message_size_ are dropped (OnMessageTooLarge).
+     * The pool keeps at most max_pool_size_ bytes, if a recycled buffer does
+     * not fit the least recently recycled buffers are freed.
+    **/
+    class CMsgReassembly
     {
     public:
-      CMsgDefragmentation();
-      virtual ~CMsgDefragmentation();
+      explicit CMsgReassembly(size_t max_messages_ = NET_UDP_REASSEMBLY_MAX_MESSAGES, const std::chrono::milliseconds& timeout_ = std::chrono::milliseconds(NET_UDP_RECBUFFER_TIMEOUT),
+                              size_t max_message_size_ = NET_UDP_REASSEMBLY_MAX_MESSAGE_SIZE, size_t max_pool_size_ = NET_UDP_REASSEMBLY_MAX_POOL_SIZE);
+      virtual ~CMsgReassembly();
+
+      CMsgReassembly(const CMsgReassembly&) = delete;
+      CMsgReassembly& operator=(const CMsgReassembly&) = delete;
 
-      int ApplyMessage(const struct SUDPMessage& ecal_message_);
+      // apply a header or content package
+      void ApplyMessage(const struct SUDPMessage& ecal_message_);
 
-      bool HasFinished() { return((m_recv_mode == rcm_aborted) || (m_recv_mode == rcm_completed)); };
-      bool HasTimedOut(const std::chrono::duration<double>& diff_time_) { m_timeout += diff_time_; return(m_timeout >= std::chrono::milliseconds(NET_UDP_RECBUFFER_TIMEOUT)); };
+      // stop reassembling a message (e.g. nobody is interested in it)
+      void DiscardMessage(int32_t message_id_);
 
-      int32_t GetMessageTotalLength() const   { return(m_message_total_len); };
-      int32_t GetMessageCurrentLength() const { return(m_message_curr_len); };
+      // remove messages that did not receive a package within the timeout
+      void RemoveTimedOutMessages();
 
-      virtual int OnMessageCompleted(std::vector<char>&& msg_buffer_) = 0;
+      SReassemblyCounters GetCounters() const;
 
     protected:
-      int OnMessageStart(const struct SUDPMessage& ecal_message_);
-      int OnMessageData(const struct SUDPMessage& ecal_message_);
+      // called with the complete message, the buffer is only valid during the call
+      virtual void OnMessageCompleted(const char* buf_, size_t len_) = 0;
 
-      enum eReceiveMode
+      // called when a message is dropped because it exceeds the maximum message size
+      virtual void OnMessageTooLarge(int32_t /*message_id_*/, size_t /*len_*/) {}
+
+    private:
+      struct SMessage
       {
-        rcm_waiting = 1,
-        rcm_reading,
-        rcm_aborted,
-        rcm_completed
+        bool                                  active    = false;
+        int32_t                               id        = 0;
+        int32_t                               total_num = 0;
+        int32_t                               total_len = 0;
+        int32_t                               curr_num  = 0;
+        int32_t                               curr_len  = 0;
+        std::chrono::steady_clock::time_point last_update;
+        std::vector<char>                     buffer;
       };
 
-      std::chrono::duration<double> m_timeout;
-      std::vector<char>             m_recv_buffer;
-      eReceiveMode                  m_recv_mode;
+      void OnMessageStart(const struct SUDPMessage& ecal_message_);
+      void OnMessageData(const struct SUDPMessage& ecal_message_);
+
+      SMessage* FindMessage(int32_t message_id_);
+      SMessage* FreeMessage();
+      void      ReleaseMessage(SMessage& message_);
+
+      std::vector<char> AcquireBuffer(size_t len_);
+      void              RecycleBuffer(std::vector<char>&& buffer_);
 
-      int32_t                       m_message_id;
-      int32_t                       m_message_total_num;
-      int32_t                       m_message_total_len;
+      std::vector<SMessage>                       m_messages;
+      std::vector<std::vector<char>>              m_buffer_pool;  // free buffers, least recently recycled first
+      std::chrono::milliseconds                   m_timeout;
+      size_t                                      m_max_message_size;
+      size_t                                      m_max_pool_size;
+      std::atomic<size_t>                         m_pool_size;
 
-      int32_t                       m_message_curr_num;
-      int32_t                       m_message_curr_len;
+      std::atomic<uint64_t>                       m_in_flight;
+      std::atomic<uint64_t>                       m_completed;
+      std::atomic<uint64_t>                       m_timed_out;
+      std::atomic<uint64_t>                       m_dropped;
     };
   }
 }
@@ -24,6 +24,7 @@
 #include "snd_fragments.h"
 #include "msg_type.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -50,6 +51,87 @@ namespace
 
     return z;
   }
+
+  int32_t CreateMessageId()
+  {
+    // create random number for message id
+    static std::mutex xorshf96_mtx;
+    const std::lock_guard<std::mutex> lock(xorshf96_mtx);
+
+    static unsigned long x = static_cast<unsigned long>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::high_resolution_clock::now().time_since_epoch()).count()
+      );
+    static unsigned long y = 362436069;
+    static unsigned long z = 521288629;
+
+    return static_cast<int32_t>(xorshf96(x, y, z));
+  }
+
+  long long SendSleepTime(long bandwidth_)
+  {
+    // calculate bandwidth timing parameter
+    long long send_sleep_us(0);
+    if (bandwidth_ > 0)
+    {
+      send_sleep_us = MSG_BUFFER_SIZE;
+      send_sleep_us *= 1000 * 1000;
+      send_sleep_us /= bandwidth_;
+    }
+    return send_sleep_us;
+  }
+
+  // protobuf wire format helpers to frame the payload without copying it into a message
+  constexpr unsigned char content_field_tag = (6 << 3) | 2;  // Sample.content,  length delimited
+  constexpr unsigned char payload_field_tag = (4 << 3) | 2;  // Content.payload, length delimited
+
+  size_t VarintSize(uint64_t value_)
+  {
+    size_t size(1);
+    while (value_ >= 0x80)
+    {
+      value_ >>= 7;
+      size++;
+    }
+    return size;
+  }
+
+  char* WriteVarint(char* buf_, uint64_t value_)
+  {
+    while (value_ >= 0x80)
+    {
+      *buf_++ = static_cast<char>((value_ & 0x7F) | 0x80);
+      value_ >>= 7;
+    }
+    *buf_++ = static_cast<char>(value_);
+    return buf_;
+  }
+
+  // append the part [offset_, offset_ + len_) of the (virtually concatenated) buffer list
+  void AppendSlice(const IO::UDP::SendBufferListT& buf_list_, size_t offset_, size_t len_, IO::UDP::SendBufferListT& packet_)
+  {
+    for (const auto& buf : buf_list_)
+    {
+      if (len_ == 0) break;
+      if (offset_ >= buf.second)
+      {
+        offset_ -= buf.second;
+        continue;
+      }
+      const size_t slice_len = std::min(buf.second - offset_, len_);
+      packet_.emplace_back(buf.first + offset_, slice_len);
+      len_    -= slice_len;
+      offset_  = 0;
+    }
+  }
+
+  // append one datagram (message header + payload slice) to the datagram list
+  void AppendDatagram(const IO::UDP::SUDPMessageHead& msg_header_, const IO::UDP::SendBufferListT& buf_list_, size_t offset_, size_t len_, IO::UDP::SDatagramList& datagram_list_)
+  {
+    const size_t buffer_num = datagram_list_.buffers.size();
+    datagram_list_.buffers.emplace_back(reinterpret_cast<const char*>(&msg_header_), sizeof(struct IO::UDP::SUDPMessageHead));
+    AppendSlice(buf_list_, offset_, len_, datagram_list_.buffers);
+    datagram_list_.buffer_count.push_back(datagram_list_.buffers.size() - buffer_num);
+  }
 }
 
 namespace IO
@@ -66,9 +148,9 @@ namespace IO
 #endif
       const size_t         data_size = sizeof(sample_name_size) + sample_name_size + sample_size;
 
-      // create payload buffer with reserved space for first message head
-      payload_.resize(data_size + sizeof(struct SUDPMessageHead));
-      char* payload_data = payload_.data() + sizeof(struct SUDPMessageHead);
+      // create payload buffer (the message heads are gathered in front of the fragments on sending)
+      payload_.resize(data_size);
+      char* payload_data = payload_.data();
 
       // write topic name size
       ((unsigned short*)payload_data)[0] = sample_name_size;
@@ -84,125 +166,169 @@ namespace IO
       return (0);
     }
 
-    size_t SendFragmentedMessage(char* buf_, size_t buf_len_, long bandwidth_, const TransmitCallbackT& transmit_cb_)
+    size_t CreateSampleHeadBuffer(const std::string& sample_name_, const eCAL::pb::Sample& ecal_sample_, size_t payload_len_, std::vector<char>& head_)
     {
-      if (buf_ == nullptr) return(0);
+      const unsigned short sample_name_size = (unsigned short)sample_name_.size() + 1;
+#if GOOGLE_PROTOBUF_VERSION >= 3001000
+      const size_t         sample_size = ecal_sample_.ByteSizeLong();
+#else
+      size_t         sample_size = ecal_sample_.ByteSize();
+#endif
 
-      size_t sent(0);
-      size_t sent_sum(0);
+      // the payload is framed as a second "content" field only containing the payload,
+      // protobuf merges it with the first one on parsing
+      size_t payload_frame_size(0);
+      size_t content_size(0);
+      if (payload_len_ > 0)
+      {
+        content_size       = sizeof(payload_field_tag) + VarintSize(payload_len_) + payload_len_;
+        payload_frame_size = sizeof(content_field_tag) + VarintSize(content_size) + content_size - payload_len_;
+      }
+      const size_t head_size = sizeof(sample_name_size) + sample_name_size + sample_size + payload_frame_size;
 
-      int32_t total_packet_num = int32_t(buf_len_ / MSG_PAYLOAD_SIZE);
-      if (buf_len_ % MSG_PAYLOAD_SIZE) total_packet_num++;
+      head_.resize(head_size);
+      char* head_data = head_.data();
 
-      // create message header
-      struct SUDPMessageHead msg_header;
+      // write topic name size
+      ((unsigned short*)head_data)[0] = sample_name_size;
+      // write topic name
+      memcpy(head_data + sizeof(sample_name_size), sample_name_.c_str(), sample_name_size);
 
-      switch (total_packet_num)
-      {
-      case 1:
+      // write sample
+      head_data += sizeof(sample_name_size) + sample_name_size;
+      if (!ecal_sample_.SerializeWithCachedSizesToArray((google::protobuf::uint8*)head_data)) return(0);
+      head_data += sample_size;
+
+      // write payload framing
+      if (payload_len_ > 0)
       {
-        // create start packet
-        msg_header.type = msg_type_header_with_content;
-        msg_header.id = -1;  // not needed for combined header / data message
-        msg_header.num = 1;
-        msg_header.len = int32_t(buf_len_);
+        *head_data++ = static_cast<char>(content_field_tag);
+        head_data = WriteVarint(head_data, content_size);
+        *head_data++ = static_cast<char>(payload_field_tag);
+        WriteVarint(head_data, payload_len_);
+      }
 
-        // copy msg_header in send buffer
-        memcpy(buf_, &msg_header, sizeof(struct SUDPMessageHead));
+      return head_size;
+    }
 
-        // send single header + data package
-        sent = transmit_cb_(buf_, sizeof(struct SUDPMessageHead) + buf_len_);
-        if (sent == 0) return(sent);
-        sent_sum += sent;
+    size_t CreateRawSampleHeadBuffer(const std::string& sample_name_, const std::string& topic_id_, const SUDPRawSampleHead& sample_head_, std::vector<char>& head_)
+    {
+      const unsigned short sample_name_size = (unsigned short)sample_name_.size() + 1;
+      const size_t         head_size        = sizeof(sample_name_size) + sample_name_size + sizeof(SUDPRawSampleHead) + topic_id_.size();
 
-#ifndef NDEBUG
-        // log it
-        //std::cout << "SendRawBuffer Packet Sent - HEADER_WITH_CONTENT (" + std::to_string(sent) + " Bytes)" << std::endl;
-#endif
-      }
-      break;
-      default:
+      head_.resize(head_size);
+      char* head_data = head_.data();
+
+      // write topic name size
+      memcpy(head_data, &sample_name_size, sizeof(sample_name_size));
+      head_data += sizeof(sample_name_size);
+      // write topic name
+      memcpy(head_data, sample_name_.c_str(), sample_name_size);
+      head_data += sample_name_size;
+
+      // write sample head
+      SUDPRawSampleHead sample_head(sample_head_);
+      sample_head.topic_id_size = static_cast<uint16_t>(topic_id_.size());
+      memcpy(head_data, &sample_head, sizeof(SUDPRawSampleHead));
+      head_data += sizeof(SUDPRawSampleHead);
+
+      // write topic id
+      memcpy(head_data, topic_id_.data(), topic_id_.size());
+
+      return head_size;
+    }
+
+    size_t SendFragmentedMessage(const SendBufferListT& buf_list_, long bandwidth_, const TransmitDatagramListCallbackT& transmit_cb_)
+    {
+      size_t buf_len(0);
+      for (const auto& buf : buf_list_) buf_len += buf.second;
+
+      int32_t total_packet_num = int32_t(buf_len / MSG_PAYLOAD_SIZE);
+      if (buf_len % MSG_PAYLOAD_SIZE) total_packet_num++;
+
+      // one message header per datagram, they are sent in front of the gathered payload slices
+      // (start package + data packages, the vector is never resized so the header addresses stay valid)
+      const size_t datagram_num = (total_packet_num == 1) ? 1 : static_cast<size_t>(total_packet_num) + 1;
+      std::vector<struct SUDPMessageHead> msg_headers(datagram_num);
+
+      SDatagramList datagram_list;
+      datagram_list.buffers.reserve(buf_list_.size() + 2 * datagram_num);
+      datagram_list.buffer_count.reserve(datagram_num);
+
+      if (total_packet_num == 1)
       {
-        // calculate bandwidth timing parameter
-        long long send_sleep_us(0);
-        if (bandwidth_ > 0)
-        {
-          send_sleep_us = MSG_BUFFER_SIZE;
-          send_sleep_us *= 1000 * 1000;
-          send_sleep_us /= bandwidth_;
-        }
+        // create start packet
+        msg_headers[0].type = msg_type_header_with_content;
+        msg_headers[0].id   = -1;  // not needed for combined header / data message
+        msg_headers[0].num  = 1;
+        msg_headers[0].len  = int32_t(buf_len);
 
+        // single header + data package
+        AppendDatagram(msg_headers[0], buf_list_, 0, buf_len, datagram_list);
+      }
+      else
+      {
         // create start package
-        msg_header.type = msg_type_header;
+        msg_headers[0].type = msg_type_header;
+        msg_headers[0].id   = CreateMessageId();
+        msg_headers[0].num  = total_packet_num;
+        msg_headers[0].len  = int32_t(buf_len);
+        AppendDatagram(msg_headers[0], buf_list_, 0, 0, datagram_list);
+
+        // create data packages
+        size_t offset(0);
+        for (int32_t current_packet_num = 0; current_packet_num < total_packet_num; current_packet_num++)
         {
-          // create random number for message id
-          {
-            static std::mutex xorshf96_mtx;
-            const std::lock_guard<std::mutex> lock(xorshf96_mtx);
-
-            static unsigned long x = static_cast<unsigned long>(std::chrono::duration_cast<std::chrono::nanoseconds>(
-              std::chrono::high_resolution_clock::now().time_since_epoch()).count()
-              );
-            static unsigned long y = 362436069;
-            static unsigned long z = 521288629;
-
-            msg_header.id = xorshf96(x, y, z);
-          }
+          // calculate current payload
+          const size_t current_snd_len = std::min(buf_len - offset, static_cast<size_t>(MSG_PAYLOAD_SIZE));
+
+          // create data packet numbering
+          struct SUDPMessageHead& msg_header = msg_headers[static_cast<size_t>(current_packet_num) + 1];
+          msg_header.type = msg_type_content;
+          msg_header.id   = msg_headers[0].id;
+          msg_header.num  = current_packet_num;
+          msg_header.len  = int32_t(current_snd_len);
+          AppendDatagram(msg_header, buf_list_, offset, current_snd_len, datagram_list);
+
+          offset += current_snd_len;
         }
-        msg_header.num = total_packet_num;
-        msg_header.len = int32_t(buf_len_);
+      }
+
+      // calculate bandwidth timing parameter
+      const long long send_sleep_us = SendSleepTime(bandwidth_);
 
-        // send start package
-        sent = transmit_cb_(&msg_header, sizeof(struct SUDPMessageHead));
+      // no bandwidth limit, send all datagrams in one go
+      if (send_sleep_us == 0) return(transmit_cb_(datagram_list));
+
+      // bandwidth limit, send datagram by datagram and sleep after every data package
+      size_t sent_sum(0);
+      size_t buffer_idx(0);
+      SDatagramList single_datagram;
+      for (size_t datagram_idx = 0; datagram_idx < datagram_num; ++datagram_idx)
+      {
+        const size_t buffer_count = datagram_list.buffer_count[datagram_idx];
+        single_datagram.buffers.assign(datagram_list.buffers.begin() + buffer_idx, datagram_list.buffers.begin() + buffer_idx + buffer_count);
+        single_datagram.buffer_count.assign(1, buffer_count);
+        buffer_idx += buffer_count;
+
+        const size_t sent = transmit_cb_(single_datagram);
         if (sent == 0) return(sent);
         sent_sum += sent;
 
-#ifndef NDEBUG
-        // log it
-        //std::cout << "SendRawBuffer Packet Sent - HEADER (" + std::to_string(sent) + " Bytes)" << std::endl;
-#endif
-
-      // send data packages
-        msg_header.type = msg_type_content;
-        for (int32_t current_packet_num = 0; current_packet_num < total_packet_num; current_packet_num++)
+        if (msg_headers[datagram_idx].type == msg_type_content)
         {
-          // calculate current payload
-          size_t current_snd_len = buf_len_;
-          if (current_snd_len > MSG_PAYLOAD_SIZE) current_snd_len = MSG_PAYLOAD_SIZE;
-
-          if (current_snd_len > 0)
-          {
-            // reduce total send len
-            buf_len_ -= current_snd_len;
-
-            // create data packet numbering
-            msg_header.num = current_packet_num;
-            msg_header.len = int32_t(current_snd_len);
-
-            // copy msg_header in send buffer
-            memcpy(buf_ + static_cast<size_t>(current_packet_num) * MSG_PAYLOAD_SIZE, &msg_header, sizeof(struct SUDPMessageHead));
-
-            // send data package
-            sent = transmit_cb_(buf_ + static_cast<size_t>(current_packet_num) * MSG_PAYLOAD_SIZE, sizeof(struct SUDPMessageHead) + current_snd_len);
-            if (sent == 0) return(sent);
-            if (send_sleep_us != 0)
-            {
-              auto start = std::chrono::steady_clock::now();
-              std::this_thread::sleep_until(start + std::chrono::microseconds(send_sleep_us));
-            }
-
-#ifndef NDEBUG
-            // log it
-            //std::cout << "SendRawBuffer Packet Sent - CONTENT (" + std::to_string(sent) + " Bytes)" << std::endl;
-#endif
-            sent_sum += sent;
-          }
+          auto start = std::chrono::steady_clock::now();
+          std::this_thread::sleep_until(start + std::chrono::microseconds(send_sleep_us));
         }
       }
-      break;
-      }
 
       return(sent_sum);
     }
+
+    size_t SendFragmentedMessage(const char* buf_, size_t buf_len_, long bandwidth_, const TransmitDatagramListCallbackT& transmit_cb_)
+    {
+      if (buf_ == nullptr) return(0);
+      return(SendFragmentedMessage(SendBufferListT{ { buf_, buf_len_ } }, bandwidth_, transmit_cb_));
+    }
   }
 }
@@ -24,8 +24,12 @@
 #include <cstddef>
 #include <functional>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "msg_type.h"
+#include "io/udp/sendreceive/udp_sender.h"
+
 #ifdef _MSC_VER
 #pragma warning(push, 0) // disable proto warnings
 #endif
@@ -40,7 +44,20 @@ namespace IO
   {
     size_t CreateSampleBuffer(const std::string& sample_name_, const eCAL::pb::Sample& ecal_sample_, std::vector<char>& payload_);
 
-    using TransmitCallbackT = std::function<size_t(const void*, const size_t)>;
-    size_t SendFragmentedMessage(char* buf_, size_t buf_len_, long bandwidth_, const TransmitCallbackT& transmit_cb_);
+    // serialize the sample (without payload) followed by the protobuf framing of the payload,
+    // the payload itself has to be sent right behind the created head buffer
+    size_t CreateSampleHeadBuffer(const std::string& sample_name_, const eCAL::pb::Sample& ecal_sample_, size_t payload_len_, std::vector<char>& head_);
+
+    // serialize the raw sample head (sample name, binary header and topic id),
+    // the payload has to be sent right behind the created head buffer
+    size_t CreateRawSampleHeadBuffer(const std::string& sample_name_, const std::string& topic_id_, const SUDPRawSampleHead& sample_head_, std::vector<char>& head_);
+
+    // fragment the (virtually concatenated) buffer list into datagrams,
+    // without bandwidth limit all datagrams are handed over to the transmit callback at once
+    using TransmitDatagramListCallbackT = std::function<size_t(const SDatagramList&)>;
+    size_t SendFragmentedMessage(const SendBufferListT& buf_list_, long bandwidth_, const TransmitDatagramListCallbackT& transmit_cb_);
+
+    // fragment a contiguous buffer (a buffer list with one element)
+    size_t SendFragmentedMessage(const char* buf_, size_t buf_len_, long bandwidth_, const TransmitDatagramListCallbackT& transmit_cb_);
   }
 }
@@ -105,5 +105,13 @@ namespace IO
       const std::lock_guard<std::mutex> lock(m_socket_mtx);
       return(m_socket_impl->Receive(buf_, len_, timeout_, address_));
     }
+
+    size_t CUDPReceiver::ReceiveMultiple(char* buf_, size_t len_, size_t count_, size_t* recv_len_, int timeout_)
+    {
+      if (!m_socket_impl) return(0);
+
+      const std::lock_guard<std::mutex> lock(m_socket_mtx);
+      return(m_socket_impl->ReceiveMultiple(buf_, len_, count_, recv_len_, timeout_));
+    }
   }
 }
@@ -70,6 +70,15 @@ namespace IO
       virtual bool RemMultiCastGroup(const char* ipaddr_) = 0;
 
       virtual size_t Receive(char* buf_, size_t len_, int timeout_, ::sockaddr_in* address_ = nullptr) = 0;
+
+      // receive up to count_ datagrams into consecutive buffers of len_ bytes each,
+      // returns the number of received datagrams (their sizes are stored in recv_len_)
+      virtual size_t ReceiveMultiple(char* buf_, size_t len_, size_t count_, size_t* recv_len_, int timeout_)
+      {
+        if (count_ == 0) return 0;
+        recv_len_[0] = Receive(buf_, len_, timeout_);
+        return (recv_len_[0] > 0) ? 1 : 0;
+      }
     };
 
     class CUDPReceiver
@@ -84,6 +93,7 @@ namespace IO
       bool RemMultiCastGroup(const char* ipaddr_);
 
       size_t Receive(char* buf_, size_t len_, int timeout_, ::sockaddr_in* address_ = nullptr);
+      size_t ReceiveMultiple(char* buf_, size_t len_, size_t count_, size_t* recv_len_, int timeout_);
 
     protected:
       bool m_use_npcap;
@@ -26,6 +26,8 @@
 
 #ifdef __linux__
 #include "linux/socket_os.h"
+#include <cerrno>
+#include <poll.h>
 #endif
 
 #include <iostream>
@@ -209,6 +211,42 @@ namespace IO
       return (reclen);
     }
 
+#ifdef __linux__
+    size_t CUDPReceiverAsio::ReceiveMultiple(char* buf_, size_t len_, size_t count_, size_t* recv_len_, int timeout_)
+    {
+      if (!m_created || (count_ == 0)) return 0;
+
+      // wait for the first datagram
+      ::pollfd pfd{ m_socket.native_handle(), POLLIN, 0 };
+      if (::poll(&pfd, 1, timeout_) <= 0) return 0;
+
+      // fetch all pending datagrams (up to count_) with a single system call
+      m_iovecs.resize(count_);
+      m_msgs.resize(count_);
+      for (size_t idx = 0; idx < count_; ++idx)
+      {
+        m_iovecs[idx].iov_base = buf_ + idx * len_;
+        m_iovecs[idx].iov_len  = len_;
+        memset(&m_msgs[idx], 0, sizeof(::mmsghdr));
+        m_msgs[idx].msg_hdr.msg_iov    = &m_iovecs[idx];
+        m_msgs[idx].msg_hdr.msg_iovlen = 1;
+      }
+
+      int rc(0);
+      do
+      {
+        rc = ::recvmmsg(m_socket.native_handle(), m_msgs.data(), static_cast<unsigned int>(count_), MSG_DONTWAIT, nullptr);
+      } while ((rc < 0) && (errno == EINTR));
+      if (rc <= 0) return 0;
+
+      for (size_t idx = 0; idx < static_cast<size_t>(rc); ++idx)
+      {
+        recv_len_[idx] = m_msgs[idx].msg_len;
+      }
+      return static_cast<size_t>(rc);
+    }
+#endif
+
     void CUDPReceiverAsio::RunIOContext(const asio::chrono::steady_clock::duration& timeout)
     {
       // restart the io_context, as it may have been left in the "stopped" state by a previous operation
@@ -21,6 +21,7 @@
 
 #include "udp_receiver.h"
 #include <cstddef>
+#include <vector>
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -47,6 +48,9 @@ namespace IO
       bool RemMultiCastGroup(const char* ipaddr_) override;
 
       size_t Receive(char* buf_, size_t len_, int timeout_, ::sockaddr_in* address_ = nullptr) override;
+#ifdef __linux__
+      size_t ReceiveMultiple(char* buf_, size_t len_, size_t count_, size_t* recv_len_, int timeout_) override;
+#endif
 
     protected:
       void RunIOContext(const asio::chrono::steady_clock::duration& timeout);
@@ -56,6 +60,10 @@ namespace IO
       asio::io_context        m_iocontext;
       asio::ip::udp::socket   m_socket;
       asio::ip::udp::endpoint m_sender_endpoint;
+#ifdef __linux__
+      std::vector<::mmsghdr>  m_msgs;
+      std::vector<::iovec>    m_iovecs;
+#endif
     };
   }
 }
@@ -26,6 +26,16 @@
 #include <cstddef>
 #include <iostream>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <sys/socket.h>
+#endif
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -48,6 +58,8 @@ namespace IO
     public:
       CUDPSenderImpl(const SSenderAttr& attr_);
       size_t Send(const void* buf_, size_t len_, const char* ipaddr_ = nullptr);
+      size_t Send(const SendBufferListT& buf_list_, const char* ipaddr_ = nullptr);
+      size_t Send(const SDatagramList& datagram_list_, const char* ipaddr_ = nullptr);
 
     protected:
       bool                    m_broadcast;
@@ -55,6 +67,11 @@ namespace IO
       asio::ip::udp::endpoint m_endpoint;
       asio::ip::udp::socket   m_socket;
       unsigned short          m_port;
+
+#ifdef __linux__
+      std::vector<::mmsghdr>  m_msgs;
+      std::vector<::iovec>    m_iovecs;
+#endif
     };
 
     CUDPSenderImpl::CUDPSenderImpl(const SSenderAttr& attr_) :
@@ -117,6 +134,112 @@ namespace IO
       return(sent);
     }
 
+    size_t CUDPSenderImpl::Send(const SendBufferListT& buf_list_, const char* ipaddr_)
+    {
+      std::vector<asio::const_buffer> buffers;
+      buffers.reserve(buf_list_.size());
+      for (const auto& buf : buf_list_)
+      {
+        buffers.emplace_back(buf.first, buf.second);
+      }
+
+      const asio::socket_base::message_flags flags(0);
+      asio::error_code                 ec;
+      size_t                           sent(0);
+      if ((ipaddr_ != nullptr) && (ipaddr_[0] != '\0')) sent = m_socket.send_to(buffers, asio::ip::udp::endpoint(asio::ip::make_address(ipaddr_), m_port), flags, ec);
+      else                                              sent = m_socket.send_to(buffers, m_endpoint, flags, ec);
+      if (ec)
+      {
+        std::cout << "CUDPSender::Send failed with: \'" << ec.message() << "\'" << std::endl;
+        return (0);
+      }
+      return(sent);
+    }
+
+    size_t CUDPSenderImpl::Send(const SDatagramList& datagram_list_, const char* ipaddr_)
+    {
+#ifdef __linux__
+      asio::ip::udp::endpoint endpoint(m_endpoint);
+      if ((ipaddr_ != nullptr) && (ipaddr_[0] != '\0')) endpoint = asio::ip::udp::endpoint(asio::ip::make_address(ipaddr_), m_port);
+
+      // one message header per datagram, pointing to its buffers
+      const size_t datagram_num = datagram_list_.buffer_count.size();
+      m_iovecs.resize(datagram_list_.buffers.size());
+      m_msgs.resize(datagram_num);
+
+      size_t buffer_idx(0);
+      for (size_t datagram_idx = 0; datagram_idx < datagram_num; ++datagram_idx)
+      {
+        const size_t buffer_count = datagram_list_.buffer_count[datagram_idx];
+        for (size_t idx = buffer_idx; idx < buffer_idx + buffer_count; ++idx)
+        {
+          m_iovecs[idx].iov_base = const_cast<char*>(datagram_list_.buffers[idx].first);
+          m_iovecs[idx].iov_len  = datagram_list_.buffers[idx].second;
+        }
+
+        ::mmsghdr& msg = m_msgs[datagram_idx];
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_hdr.msg_name    = endpoint.data();
+        msg.msg_hdr.msg_namelen = static_cast<socklen_t>(endpoint.size());
+        msg.msg_hdr.msg_iov     = m_iovecs.data() + buffer_idx;
+        msg.msg_hdr.msg_iovlen  = buffer_count;
+
+        buffer_idx += buffer_count;
+      }
+
+      // send all datagrams with as few system calls as possible
+      size_t sent(0);
+      size_t msg_idx(0);
+      while (msg_idx < datagram_num)
+      {
+        const int rc = ::sendmmsg(m_socket.native_handle(), m_msgs.data() + msg_idx, static_cast<unsigned int>(datagram_num - msg_idx), 0);
+        if (rc < 0)
+        {
+          if (errno == EINTR) continue;
+          if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+          {
+            // socket send buffer is full, wait until it's writable again
+            ::pollfd pfd{ m_socket.native_handle(), POLLOUT, 0 };
+            ::poll(&pfd, 1, -1);
+            continue;
+          }
+          // the datagrams sent so far are gone, the rest of the message is dropped
+          const std::string error = strerror(errno);
+          if (msg_idx > 0) std::cout << "CUDPSender::Send failed after " << msg_idx << " of " << datagram_num << " datagrams with: \'" << error << "\'" << std::endl;
+          else             std::cout << "CUDPSender::Send failed with: \'" << error << "\'" << std::endl;
+          return(sent);
+        }
+
+        for (int idx = 0; idx < rc; ++idx)
+        {
+          sent += m_msgs[msg_idx + static_cast<size_t>(idx)].msg_len;
+        }
+        msg_idx += static_cast<size_t>(rc);
+      }
+      return(sent);
+#else
+      // send datagram by datagram
+      size_t sent(0);
+      size_t buffer_idx(0);
+      SendBufferListT buf_list;
+      for (size_t datagram_idx = 0; datagram_idx < datagram_list_.buffer_count.size(); ++datagram_idx)
+      {
+        const size_t buffer_count = datagram_list_.buffer_count[datagram_idx];
+        buf_list.assign(datagram_list_.buffers.begin() + buffer_idx, datagram_list_.buffers.begin() + buffer_idx + buffer_count);
+        const size_t datagram_sent = Send(buf_list, ipaddr_);
+        if (datagram_sent == 0)
+        {
+          // the datagrams sent so far are gone, the rest of the message is dropped
+          if (datagram_idx > 0) std::cout << "CUDPSender::Send failed after " << datagram_idx << " of " << datagram_list_.buffer_count.size() << " datagrams" << std::endl;
+          return(sent);
+        }
+        sent       += datagram_sent;
+        buffer_idx += buffer_count;
+      }
+      return(sent);
+#endif
+    }
+
     ////////////////////////////////////////////////////////
     // udp sender class
     ////////////////////////////////////////////////////////
@@ -130,5 +253,17 @@ namespace IO
       if (!m_socket_impl) return(0);
       return(m_socket_impl->Send(buf_, len_, ipaddr_));
     }
+
+    size_t CUDPSender::Send(const SendBufferListT& buf_list_, const char* ipaddr_)
+    {
+      if (!m_socket_impl) return(0);
+      return(m_socket_impl->Send(buf_list_, ipaddr_));
+    }
+
+    size_t CUDPSender::Send(const SDatagramList& datagram_list_, const char* ipaddr_)
+    {
+      if (!m_socket_impl) return(0);
+      return(m_socket_impl->Send(datagram_list_, ipaddr_));
+    }
   }
 }
@@ -38,6 +38,8 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace IO
 {
@@ -53,6 +55,16 @@ namespace IO
       int         sndbuf    = 1024 * 1024;
     };
 
+    // list of buffers that are sent as one contiguous datagram (scatter / gather)
+    using SendBufferListT = std::vector<std::pair<const char*, size_t>>;
+
+    // list of datagrams, datagram n consists of the next buffer_count[n] buffers of the buffer list
+    struct SDatagramList
+    {
+      SendBufferListT     buffers;
+      std::vector<size_t> buffer_count;
+    };
+
     class CUDPSenderImpl;
 
     class CUDPSender
@@ -60,6 +72,11 @@ namespace IO
     public:
       CUDPSender(const SSenderAttr& attr_);
       size_t Send(const void* buf_, size_t len_, const char* ipaddr_ = nullptr);
+      // send a list of buffers as one datagram (scatter / gather)
+      size_t Send(const SendBufferListT& buf_list_, const char* ipaddr_ = nullptr);
+      // send a list of datagrams (batched into as few system calls as possible on linux),
+      // stops at the first failing datagram and returns the number of bytes sent until then
+      size_t Send(const SDatagramList& datagram_list_, const char* ipaddr_ = nullptr);
 
     protected:
       std::shared_ptr<CUDPSenderImpl> m_socket_impl;
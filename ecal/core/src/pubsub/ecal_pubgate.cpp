@@ -27,10 +27,8 @@
 #include "ecal_sample_to_topicinfo.h"
 
 #include <atomic>
-#include <iterator>
 #include <memory>
 #include <mutex>
-#include <shared_mutex>
 #include <string>
 
 namespace eCAL
@@ -62,10 +60,13 @@ namespace eCAL
     if(!m_created) return;
 
     // destroy all remaining publisher
-    const std::unique_lock<std::shared_timed_mutex> lock(m_topic_name_datawriter_sync);
-    for (auto iter = m_topic_name_datawriter_map.begin(); iter != m_topic_name_datawriter_map.end(); ++iter)
+    const auto datawriter_snapshot = m_topic_name_datawriter_index.GetSnapshot();
+    for (const auto& topic : *datawriter_snapshot)
     {
-      iter->second->Destroy();
+      for (const auto& writer : *topic.second)
+      {
+        writer->Destroy();
+      }
     }
 
     m_created = false;
@@ -86,8 +87,7 @@ namespace eCAL
     if(!m_created) return(false);
 
     // register writer and multicast group
-    const std::unique_lock<std::shared_timed_mutex> lock(m_topic_name_datawriter_sync);
-    m_topic_name_datawriter_map.emplace(std::pair<std::string, std::shared_ptr<CDataWriter>>(topic_name_, datawriter_));
+    m_topic_name_datawriter_index.Add(topic_name_, datawriter_);
 
     return(true);
   }
@@ -95,21 +95,8 @@ namespace eCAL
   bool CPubGate::Unregister(const std::string& topic_name_, const std::shared_ptr<CDataWriter>& datawriter_)
   {
     if(!m_created) return(false);
-    bool ret_state = false;
 
-    const std::unique_lock<std::shared_timed_mutex> lock(m_topic_name_datawriter_sync);
-    auto res = m_topic_name_datawriter_map.equal_range(topic_name_);
-    for(TopicNameDataWriterMapT::iterator iter = res.first; iter != res.second; ++iter)
-    {
-      if(iter->second == datawriter_)
-      {
-        m_topic_name_datawriter_map.erase(iter);
-        ret_state = true;
-        break;
-      }
-    }
-
-    return(ret_state);
+    return(m_topic_name_datawriter_index.Remove(topic_name_, datawriter_));
   }
 
   void CPubGate::ApplyLocSubRegistration(const eCAL::pb::Sample& ecal_sample_)
@@ -136,11 +123,11 @@ namespace eCAL
     ApplyTopicToDescGate(topic_name, topic_information);
 
     // register local subscriber
-    const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_datawriter_sync);
-    auto res = m_topic_name_datawriter_map.equal_range(topic_name);
-    for(TopicNameDataWriterMapT::const_iterator iter = res.first; iter != res.second; ++iter)
+    const auto writers = m_topic_name_datawriter_index.Find(topic_name);
+    if (writers == nullptr) return;
+    for (const auto& writer : *writers)
     {
-      iter->second->ApplyLocSubscription(subscription_info, topic_information, reader_par);
+      writer->ApplyLocSubscription(subscription_info, topic_information, reader_par);
     }
   }
 
@@ -155,11 +142,11 @@ namespace eCAL
     subscription_info.process_id = std::to_string(ecal_sample.pid());
 
     // unregister local subscriber
-    const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_datawriter_sync);
-    auto res = m_topic_name_datawriter_map.equal_range(topic_name);
-    for (TopicNameDataWriterMapT::const_iterator iter = res.first; iter != res.second; ++iter)
+    const auto writers = m_topic_name_datawriter_index.Find(topic_name);
+    if (writers == nullptr) return;
+    for (const auto& writer : *writers)
     {
-      iter->second->RemoveLocSubscription(subscription_info);
+      writer->RemoveLocSubscription(subscription_info);
     }
   }
 
@@ -188,11 +175,11 @@ namespace eCAL
     ApplyTopicToDescGate(topic_name, topic_information);
 
     // register external subscriber
-    const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_datawriter_sync);
-    auto res = m_topic_name_datawriter_map.equal_range(topic_name);
-    for(TopicNameDataWriterMapT::const_iterator iter = res.first; iter != res.second; ++iter)
+    const auto writers = m_topic_name_datawriter_index.Find(topic_name);
+    if (writers == nullptr) return;
+    for (const auto& writer : *writers)
     {
-      iter->second->ApplyExtSubscription(subscription_info, topic_information, reader_par);
+      writer->ApplyExtSubscription(subscription_info, topic_information, reader_par);
     }
   }
 
@@ -208,11 +195,11 @@ namespace eCAL
     subscription_info.process_id = std::to_string(ecal_sample.pid());
 
     // unregister external subscriber
-    const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_datawriter_sync);
-    auto res = m_topic_name_datawriter_map.equal_range(topic_name);
-    for (TopicNameDataWriterMapT::const_iterator iter = res.first; iter != res.second; ++iter)
+    const auto writers = m_topic_name_datawriter_index.Find(topic_name);
+    if (writers == nullptr) return;
+    for (const auto& writer : *writers)
     {
-      iter->second->RemoveExtSubscription(subscription_info);
+      writer->RemoveExtSubscription(subscription_info);
     }
   }
 
@@ -221,10 +208,13 @@ namespace eCAL
     if (!m_created) return;
 
     // refresh publisher registrations
-    const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_datawriter_sync);
-    for (const auto& iter : m_topic_name_datawriter_map)
+    const auto datawriter_snapshot = m_topic_name_datawriter_index.GetSnapshot();
+    for (const auto& topic : *datawriter_snapshot)
     {
-      iter.second->RefreshRegistration();
+      for (const auto& writer : *topic.second)
+      {
+        writer->RefreshRegistration();
+      }
     }
   }
 
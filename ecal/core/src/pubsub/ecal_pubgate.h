@@ -27,11 +27,10 @@
 #include "ecal_def.h"
 
 #include "readwrite/ecal_writer.h"
+#include "util/ecal_topic_index.h"
 
 #include <atomic>
-#include <map>
 #include <memory>
-#include <shared_mutex>
 #include <string>
 
 namespace eCAL
@@ -69,8 +68,8 @@ namespace eCAL
     bool                      m_share_type;
     bool                      m_share_desc;
 
-    using TopicNameDataWriterMapT = std::multimap<std::string, std::shared_ptr<CDataWriter>>;
-    std::shared_timed_mutex   m_topic_name_datawriter_sync;
-    TopicNameDataWriterMapT   m_topic_name_datawriter_map;
+    // database data writer (copy on write snapshot lookup)
+    using DataWriterIndexT = Util::CTopicIndex<CDataWriter>;
+    DataWriterIndexT          m_topic_name_datawriter_index;
   };
 }
@@ -323,6 +323,13 @@ namespace eCAL
     return m_datawriter->ShmSetBufferCount(buffering_);
   }
 
+  bool CPublisher::ShmSetRingSlotCount(long slots_)
+  {
+    if (!m_created) return(false);
+    if (slots_ < 0) return(false);
+    return m_datawriter->ShmSetRingSlotCount(static_cast<size_t>(slots_));
+  }
+
   bool CPublisher::ShmEnableZeroCopy(bool state_)
   {
     if (!m_created) return(false);
@@ -335,6 +342,19 @@ namespace eCAL
     return m_datawriter->ShmSetAcknowledgeTimeout(acknowledge_timeout_ms_);
   }
 
+  bool CPublisher::SetBatching(size_t max_size_, long long max_delay_us_)
+  {
+    if (!m_created) return(false);
+    if (max_delay_us_ < 0) return(false);
+    return m_datawriter->SetBatching(max_size_, max_delay_us_);
+  }
+
+  bool CPublisher::FlushBatch() const
+  {
+    if (!m_created) return(false);
+    return m_datawriter->FlushBatch();
+  }
+
   bool CPublisher::SetID(long long id_)
   {
     m_id = id_;
@@ -395,6 +415,36 @@ namespace eCAL
      return written_bytes;
   }
 
+  void* CPublisher::LoanBuffer(size_t max_len_)
+  {
+    if (!m_created) return(nullptr);
+    return m_datawriter->Loan(max_len_);
+  }
+
+  size_t CPublisher::CommitBuffer(size_t len_, long long time_ /* = DEFAULT_TIME_ARGUMENT */)
+  {
+    if (!m_created) return(0);
+
+    // no subscription (anymore), we drop the loaned
+    // buffer and only do some statistics for the monitoring layer
+    if (!IsSubscribed())
+    {
+      if (!m_datawriter->Discard()) return(0);
+      m_datawriter->RefreshSendCounter();
+      return(len_);
+    }
+
+    // send content via data writer layer
+    const long long write_time = (time_ == DEFAULT_TIME_ARGUMENT) ? eCAL::Time::GetMicroSeconds() : time_;
+    return m_datawriter->Commit(len_, write_time, m_id);
+  }
+
+  bool CPublisher::DiscardBuffer()
+  {
+    if (!m_created) return(false);
+    return m_datawriter->Discard();
+  }
+
   bool CPublisher::AddEventCallback(eCAL_Publisher_Event type_, PubEventCallbackT callback_)
   {
     if (m_datawriter == nullptr) return(false);
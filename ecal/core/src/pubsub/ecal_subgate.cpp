@@ -21,7 +21,6 @@
  * @brief  eCAL subscriber gateway class
 **/
 
-#include <algorithm>
 #include <atomic>
 #include <chrono>
 
@@ -29,10 +28,8 @@
 #include <ecal/ecal.h>
 #include <ecal/ecal_event.h>
 #include <functional>
-#include <iterator>
 #include <memory>
 #include <mutex>
-#include <shared_mutex>
 #include <string>
 #include <thread>
 #include <vector>
@@ -90,6 +87,9 @@ namespace eCAL
     // start timeout thread
     m_subtimeout_thread = std::make_shared<CCallbackThread>(std::bind(&CSubGate::CheckTimeouts, this));
     m_subtimeout_thread->start(std::chrono::milliseconds(CMN_DATAREADER_TIMEOUT_RESOLUTION_MS));
+
+    // prepare dispatcher for data readers with asynchronous delivery
+    m_reader_dispatcher.Create(Config::Experimental::GetSubscriberDispatcherThreadCount());
       
     m_created = true;
   }
@@ -101,11 +101,17 @@ namespace eCAL
     // stop timeout thread
     m_subtimeout_thread->stop();
 
+    // stop dispatcher
+    m_reader_dispatcher.Destroy();
+
     // destroy all remaining subscriber
-    const std::unique_lock<std::shared_timed_mutex> lock(m_topic_name_datareader_sync);
-    for (auto iter = m_topic_name_datareader_map.begin(); iter != m_topic_name_datareader_map.end(); ++iter)
+    const auto datareader_snapshot = m_topic_name_datareader_index.GetSnapshot();
+    for (const auto& topic : *datareader_snapshot)
     {
-      iter->second->Destroy();
+      for (const auto& reader : *topic.second)
+      {
+        reader->Destroy();
+      }
     }
 
     m_created = false;
@@ -116,8 +122,7 @@ namespace eCAL
     if(!m_created) return(false);
 
     // register reader
-    const std::unique_lock<std::shared_timed_mutex> lock(m_topic_name_datareader_sync);
-    m_topic_name_datareader_map.emplace(std::pair<std::string, std::shared_ptr<CDataReader>>(topic_name_, datareader_));
+    m_topic_name_datareader_index.Add(topic_name_, datareader_);
 
     return(true);
   }
@@ -125,27 +130,13 @@ namespace eCAL
   bool CSubGate::Unregister(const std::string& topic_name_, const std::shared_ptr<CDataReader>& datareader_)
   {
     if(!m_created) return(false);
-    bool ret_state = false;
-
-    const std::unique_lock<std::shared_timed_mutex> lock(m_topic_name_datareader_sync);
-    auto res = m_topic_name_datareader_map.equal_range(topic_name_);
-    for(TopicNameDataReaderMapT::iterator iter = res.first; iter != res.second; ++iter)
-    {
-      if(iter->second == datareader_)
-      {
-        m_topic_name_datareader_map.erase(iter);
-        ret_state = true;
-        break;
-      }
-    }
 
-    return(ret_state);
+    return(m_topic_name_datareader_index.Remove(topic_name_, datareader_));
   }
 
   bool CSubGate::HasSample(const std::string& sample_name_)
   {
-    const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_datareader_sync);
-    return(m_topic_name_datareader_map.find(sample_name_) != m_topic_name_datareader_map.end());
+    return(m_topic_name_datareader_index.Find(sample_name_) != nullptr);
   }
 
   bool CSubGate::ApplySample(const eCAL::pb::Sample& ecal_sample_, eCAL::pb::eTLayerType layer_)
@@ -172,32 +163,22 @@ namespace eCAL
       const auto& ecal_sample_content_payload = ecal_sample_content.payload();
       g_process_rbytes_sum += ecal_sample_.content().payload().size();
 
-      std::vector<std::shared_ptr<CDataReader>> readers_to_apply;
-
-      // Lock the sync map only while extracting the relevant shared pointers to the Datareaders.
-      // Apply the samples to the readers afterwards.
-      {
-        // apply sample to data reader
-        const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_datareader_sync);
-        auto res = m_topic_name_datareader_map.equal_range(ecal_sample_.topic().tname());
-        std::transform(
-          res.first, res.second, std::back_inserter(readers_to_apply), [](const auto& match) { return match.second; }
-        );
-      }
-
-      for (const auto& reader : readers_to_apply)
-      {
-        sent = reader->AddSample(
-          ecal_sample_.topic().tid(),
-          ecal_sample_content_payload.data(),
-          ecal_sample_content_payload.size(),
-          ecal_sample_content.id(),
-          ecal_sample_content.clock(),
-          ecal_sample_content.time(),
-          static_cast<size_t>(ecal_sample_content.hash()),
-          layer_
-        );
-      }
+      // apply sample to data reader
+      const auto readers_to_apply = m_topic_name_datareader_index.Find(ecal_sample_.topic().tname());
+      if (readers_to_apply == nullptr) break;
+
+      sent = ApplySampleToReaders(
+        readers_to_apply,
+        ecal_sample_.topic().tid(),
+        ecal_sample_content_payload.data(),
+        ecal_sample_content_payload.size(),
+        ecal_sample_content.id(),
+        ecal_sample_content.clock(),
+        ecal_sample_content.time(),
+        static_cast<size_t>(ecal_sample_content.hash()),
+        layer_,
+        SamplePinT()
+      );
     }
     break;
     default:
@@ -207,7 +188,7 @@ namespace eCAL
     return (sent > 0);
   }
 
-  bool CSubGate::ApplySample(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_)
+  bool CSubGate::ApplySample(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_, const SamplePinT& pin_ /*= SamplePinT()*/)
   {
     if(!m_created) return false;
 
@@ -216,26 +197,34 @@ namespace eCAL
     g_process_rbytes_sum += len_;
 
     // apply sample to data reader
-    size_t sent(0);
-    std::vector<std::shared_ptr<CDataReader>> readers_to_apply;
+    return (ApplySampleToReaders(m_topic_name_datareader_index.Find(topic_name_), topic_id_, buf_, len_, id_, clock_, time_, hash_, layer_, pin_) > 0);
+  }
 
-    // Lock the sync map only while extracting the relevant shared pointers to the Datareaders.
-    // Apply the samples to the readers afterwards.
-    {
-      const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_datareader_sync);
-      auto res = m_topic_name_datareader_map.equal_range(topic_name_);
-      std::transform(
-        res.first, res.second, std::back_inserter(readers_to_apply), [](const auto& match) { return match.second; }
-      );
-    }
+  bool CSubGate::ApplySample(ReaderLookupCacheT& lookup_cache_, const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_, const SamplePinT& pin_ /*= SamplePinT()*/)
+  {
+    if(!m_created) return false;
+
+    // update globals
+    g_process_rclock++;
+    g_process_rbytes_sum += len_;
 
+    // apply sample to data reader (looked up again only if readers were added or removed)
+    return (ApplySampleToReaders(m_topic_name_datareader_index.Find(topic_name_, lookup_cache_), topic_id_, buf_, len_, id_, clock_, time_, hash_, layer_, pin_) > 0);
+  }
 
-    for (const auto& reader : readers_to_apply)
+  size_t CSubGate::ApplySampleToReaders(const DataReaderIndexT::EntityListPtrT& readers_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_, const SamplePinT& pin_)
+  {
+    if (readers_ == nullptr) return 0;
+
+    size_t sent(0);
+    for (const auto& reader : *readers_)
     {
-      sent = reader->AddSample(topic_id_, buf_, len_, id_, clock_, time_, hash_, layer_);
-    }
+      sent = reader->AddSample(topic_id_, buf_, len_, id_, clock_, time_, hash_, layer_, pin_);
 
-    return (sent > 0);
+      // readers with asynchronous delivery only queued the sample
+      if (reader->RequestDispatch()) m_reader_dispatcher.Schedule(reader);
+    }
+    return sent;
   }
 
   void CSubGate::ApplyLocPubRegistration(const eCAL::pb::Sample& ecal_sample_)
@@ -257,9 +246,9 @@ namespace eCAL
     const std::string process_id = std::to_string(ecal_sample_.topic().pid());
 
     // handle local publisher connection
-    const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_datareader_sync);
-    auto res = m_topic_name_datareader_map.equal_range(topic_name);
-    for (TopicNameDataReaderMapT::iterator iter = res.first; iter != res.second; ++iter)
+    const auto readers = m_topic_name_datareader_index.Find(topic_name);
+    if (readers == nullptr) return;
+    for (const auto& reader : *readers)
     {
       // apply layer specific parameter
       for (const auto& tlayer : ecal_sample.tlayer())
@@ -293,10 +282,10 @@ namespace eCAL
         // REMOVE ME IN ECAL6
         // ----------------------------------------------------------------------
 
-        iter->second->ApplyLocLayerParameter(process_id, topic_id, tlayer.type(), writer_par);
+        reader->ApplyLocLayerParameter(process_id, topic_id, tlayer.type(), writer_par);
       }
       // inform for local publisher connection
-      iter->second->ApplyLocPublication(process_id, topic_id, topic_info);
+      reader->ApplyLocPublication(process_id, topic_id, topic_info);
     }
   }
 
@@ -311,11 +300,11 @@ namespace eCAL
     const std::string process_id  = std::to_string(ecal_sample_.topic().pid());
 
     // unregister local publisher
-    const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_datareader_sync);
-    auto res = m_topic_name_datareader_map.equal_range(topic_name);
-    for (TopicNameDataReaderMapT::iterator iter = res.first; iter != res.second; ++iter)
+    const auto readers = m_topic_name_datareader_index.Find(topic_name);
+    if (readers == nullptr) return;
+    for (const auto& reader : *readers)
     {
-      iter->second->RemoveLocPublication(process_id, topic_id);
+      reader->RemoveLocPublication(process_id, topic_id);
     }
   }
 
@@ -334,19 +323,19 @@ namespace eCAL
     ApplyTopicToDescGate(topic_name, topic_info);
 
     // handle external publisher connection
-    const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_datareader_sync);
-    auto res = m_topic_name_datareader_map.equal_range(topic_name);
-    for (TopicNameDataReaderMapT::iterator iter = res.first; iter != res.second; ++iter)
+    const auto readers = m_topic_name_datareader_index.Find(topic_name);
+    if (readers == nullptr) return;
+    for (const auto& reader : *readers)
     {
       // apply layer specific parameter
       for (const auto& tlayer : ecal_sample_.topic().tlayer())
       {
         // layer parameter as protobuf message
         const std::string writer_par = tlayer.par_layer().SerializeAsString();
-        iter->second->ApplyExtLayerParameter(host_name, tlayer.type(), writer_par);
+        reader->ApplyExtLayerParameter(host_name, tlayer.type(), writer_par);
       }
       // inform for external publisher connection
-      iter->second->ApplyExtPublication(host_name, process_id, topic_id, topic_info);
+      reader->ApplyExtPublication(host_name, process_id, topic_id, topic_info);
     }
   }
 
@@ -361,11 +350,11 @@ namespace eCAL
     const std::string  process_id = std::to_string(ecal_sample.pid());
 
     // unregister local subscriber
-    const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_datareader_sync);
-    auto res = m_topic_name_datareader_map.equal_range(topic_name);
-    for (TopicNameDataReaderMapT::iterator iter = res.first; iter != res.second; ++iter)
+    const auto readers = m_topic_name_datareader_index.Find(topic_name);
+    if (readers == nullptr) return;
+    for (const auto& reader : *readers)
     {
-      iter->second->RemoveExtPublication(host_name, process_id, topic_id);
+      reader->RemoveExtPublication(host_name, process_id, topic_id);
     }
   }
 
@@ -374,20 +363,26 @@ namespace eCAL
     if (!m_created) return;
 
     // refresh reader registrations
-    const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_datareader_sync);
-    for (const auto& iter : m_topic_name_datareader_map)
+    const auto datareader_snapshot = m_topic_name_datareader_index.GetSnapshot();
+    for (const auto& topic : *datareader_snapshot)
     {
-      iter.second->RefreshRegistration();
+      for (const auto& reader : *topic.second)
+      {
+        reader->RefreshRegistration();
+      }
     }
   }
 
   void CSubGate::CheckTimeouts()
   {
     // check subscriber timeouts
-    const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_datareader_sync);
-    for (auto iter = m_topic_name_datareader_map.begin(); iter != m_topic_name_datareader_map.end(); ++iter)
+    const auto datareader_snapshot = m_topic_name_datareader_index.GetSnapshot();
+    for (const auto& topic : *datareader_snapshot)
     {
-      iter->second->CheckReceiveTimeout();
+      for (const auto& reader : *topic.second)
+      {
+        reader->CheckReceiveTimeout();
+      }
     }
 
     // signal shutdown if eCAL is not okay
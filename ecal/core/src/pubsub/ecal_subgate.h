@@ -24,20 +24,23 @@
 #pragma once
 
 #include "readwrite/ecal_reader.h"
+#include "readwrite/ecal_reader_dispatcher.h"
 #include "util/ecal_thread.h"
+#include "util/ecal_topic_index.h"
 
 #include <atomic>
 #include <cstddef>
 #include <memory>
-#include <shared_mutex>
 #include <string>
-#include <unordered_map>
 
 namespace eCAL
 {
   class CSubGate
   {
   public:
+    using DataReaderIndexT   = Util::CTopicIndex<CDataReader>;
+    using ReaderLookupCacheT = DataReaderIndexT::SLookupCache;
+
     CSubGate();
     ~CSubGate();
 
@@ -49,7 +52,9 @@ namespace eCAL
 
     bool HasSample(const std::string& sample_name_);
     bool ApplySample(const eCAL::pb::Sample& ecal_sample_, eCAL::pb::eTLayerType layer_);
-    bool ApplySample(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_);
+    bool ApplySample(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_, const SamplePinT& pin_ = SamplePinT());
+    // same as above, the data readers of the topic are looked up once and kept in the (per topic) lookup cache
+    bool ApplySample(ReaderLookupCacheT& lookup_cache_, const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_, const SamplePinT& pin_ = SamplePinT());
 
     void ApplyLocPubRegistration(const eCAL::pb::Sample& ecal_sample_);
     void ApplyLocPubUnregistration(const eCAL::pb::Sample& ecal_sample_);
@@ -62,14 +67,16 @@ namespace eCAL
   protected:
     void CheckTimeouts();
     bool ApplyTopicToDescGate(const std::string& topic_name_, const SDataTypeInformation& topic_info_);
+    size_t ApplySampleToReaders(const DataReaderIndexT::EntityListPtrT& readers_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_, const SamplePinT& pin_);
 
     static std::atomic<bool>         m_created;
 
-    // database data reader
-    using TopicNameDataReaderMapT = std::unordered_multimap<std::string, std::shared_ptr<CDataReader>>;
-    std::shared_timed_mutex          m_topic_name_datareader_sync;
-    TopicNameDataReaderMapT          m_topic_name_datareader_map;
+    // database data reader (copy on write snapshot lookup)
+    DataReaderIndexT                 m_topic_name_datareader_index;
 
     std::shared_ptr<CCallbackThread>  m_subtimeout_thread;
+
+    // calls the receive callbacks of data readers with asynchronous delivery
+    CReaderDispatcher                 m_reader_dispatcher;
   };
 }
@@ -147,8 +147,9 @@ namespace eCAL
     if(!m_created)             return(false);
     if(g_globals() == nullptr) return(false);
 
-    // remove receive callback
+    // remove receive callbacks
     RemReceiveCallback();
+    RemReceiveViewCallback();
 
     // first unregister data reader
     if(g_subgate() != nullptr) g_subgate()->Unregister(m_datareader->GetTopicName(), m_datareader);
@@ -224,6 +225,13 @@ namespace eCAL
     return(m_datareader->Receive(buf_, time_, rcv_timeout_));
   }
 
+  size_t CSubscriber::ReceiveBatch(std::vector<SReceivedSample>& samples_, int rcv_timeout_ /* = 0 */) const
+  {
+    samples_.clear();
+    if (!m_created) return(0);
+    return(m_datareader->ReceiveBatch(samples_, rcv_timeout_));
+  }
+
   bool CSubscriber::AddReceiveCallback(ReceiveCallbackT callback_)
   {
     if(m_datareader == nullptr) return(false);
@@ -237,6 +245,19 @@ namespace eCAL
     return(m_datareader->RemReceiveCallback());
   }
 
+  bool CSubscriber::AddReceiveViewCallback(ReceiveViewCallbackT callback_)
+  {
+    if(m_datareader == nullptr) return(false);
+    RemReceiveViewCallback();
+    return(m_datareader->AddReceiveViewCallback(callback_));
+  }
+
+  bool CSubscriber::RemReceiveViewCallback()
+  {
+    if(m_datareader == nullptr) return(false);
+    return(m_datareader->RemReceiveViewCallback());
+  }
+
   bool CSubscriber::AddEventCallback(eCAL_Subscriber_Event type_, SubEventCallbackT callback_)
   {
     if (m_datareader == nullptr) return(false);
@@ -256,6 +277,12 @@ namespace eCAL
     return(m_datareader->GetPublisherCount());
   }
 
+  size_t CSubscriber::GetQueueDropCount() const
+  {
+    if(m_datareader == nullptr) return(0);
+    return(m_datareader->GetQueueDropCount());
+  }
+
   std::string CSubscriber::GetTopicName() const
   {
     if(m_datareader == nullptr) return("");
@@ -0,0 +1,164 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  batch frame format (many small samples sent as one transport sample)
+**/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace eCAL
+{
+  namespace Batch
+  {
+    /**
+     * @brief Sample id marking a batch frame.
+     *
+     * The frame is sent like a usual sample on every layer, so no transport
+     * header has to be extended. The id is reserved, a sample with this id and
+     * a payload starting with the frame magic is unbatched by the reader.
+     *
+     * Layout: SFrameHeader | SSampleHeader | payload | padding | SSampleHeader | ...
+    **/
+    constexpr long long    frame_id      = (std::numeric_limits<long long>::min)();
+    constexpr std::uint8_t frame_version = 1;
+
+    struct SFrameHeader
+    {
+      char          magic[4]     = { 'e', 'c', 'b', 'f' };
+      std::uint8_t  hdr_size     = sizeof(SFrameHeader);
+      std::uint8_t  version      = frame_version;
+      std::uint16_t reserved     = 0;
+      std::uint32_t sample_count = 0;
+      std::uint32_t reserved2    = 0;
+    };
+
+    struct SSampleHeader
+    {
+      std::uint64_t size  = 0;
+      std::int64_t  id    = 0;
+      std::int64_t  clock = 0;
+      std::int64_t  time  = 0;
+    };
+
+    // sample payloads start 8 byte aligned (relative to the frame start)
+    inline std::size_t AlignUp(std::size_t size_)
+    {
+      return (size_ + 7) / 8 * 8;
+    }
+
+    // additional frame bytes needed for a sample of the given size
+    inline std::size_t SampleFrameSize(std::size_t size_)
+    {
+      return sizeof(SSampleHeader) + AlignUp(size_);
+    }
+
+    /**
+     * @brief Start a new (empty) frame.
+    **/
+    inline void InitFrame(std::vector<char>& frame_)
+    {
+      const SFrameHeader frame_hdr;
+      frame_.resize(sizeof(SFrameHeader));
+      std::memcpy(frame_.data(), &frame_hdr, sizeof(SFrameHeader));
+    }
+
+    /**
+     * @brief Append a sample header and reserve the payload space.
+     *
+     * @return  The payload address in the frame (valid until the frame is resized again).
+    **/
+    inline char* AppendSample(std::vector<char>& frame_, std::size_t size_, long long id_, long long clock_, long long time_)
+    {
+      SFrameHeader frame_hdr;
+      std::memcpy(&frame_hdr, frame_.data(), sizeof(SFrameHeader));
+      frame_hdr.sample_count++;
+      std::memcpy(frame_.data(), &frame_hdr, sizeof(SFrameHeader));
+
+      SSampleHeader sample_hdr;
+      sample_hdr.size  = size_;
+      sample_hdr.id    = id_;
+      sample_hdr.clock = clock_;
+      sample_hdr.time  = time_;
+
+      const std::size_t offset = frame_.size();
+      frame_.resize(offset + SampleFrameSize(size_));
+      std::memcpy(frame_.data() + offset, &sample_hdr, sizeof(SSampleHeader));
+      return frame_.data() + offset + sizeof(SSampleHeader);
+    }
+
+    /**
+     * @brief Number of samples in a frame (0 if the frame is empty or not initialized).
+    **/
+    inline std::uint32_t SampleCount(const std::vector<char>& frame_)
+    {
+      if (frame_.size() < sizeof(SFrameHeader)) return 0;
+      SFrameHeader frame_hdr;
+      std::memcpy(&frame_hdr, frame_.data(), sizeof(SFrameHeader));
+      return frame_hdr.sample_count;
+    }
+
+    /**
+     * @brief Check if a received sample is a batch frame.
+    **/
+    inline bool IsFrame(const char* buf_, std::size_t len_, long long id_)
+    {
+      if (id_ != frame_id)              return false;
+      if (len_ < sizeof(SFrameHeader))  return false;
+      const SFrameHeader frame_hdr;
+      return (std::memcmp(buf_, frame_hdr.magic, sizeof(frame_hdr.magic)) == 0)
+        && (static_cast<std::uint8_t>(buf_[4]) == sizeof(SFrameHeader))
+        && (static_cast<std::uint8_t>(buf_[5]) == frame_version);
+    }
+
+    /**
+     * @brief Call func_(payload, size, id, clock, time) for every sample in the frame.
+     *
+     * @return  false if the frame is truncated (samples before the damaged one are processed).
+    **/
+    template <typename FuncT>
+    bool ForEachSample(const char* buf_, std::size_t len_, FuncT func_)
+    {
+      SFrameHeader frame_hdr;
+      std::memcpy(&frame_hdr, buf_, sizeof(SFrameHeader));
+
+      std::size_t offset = sizeof(SFrameHeader);
+      for (std::uint32_t sample = 0; sample < frame_hdr.sample_count; ++sample)
+      {
+        if (len_ - offset < sizeof(SSampleHeader)) return false;
+        SSampleHeader sample_hdr;
+        std::memcpy(&sample_hdr, buf_ + offset, sizeof(SSampleHeader));
+        offset += sizeof(SSampleHeader);
+
+        if (sample_hdr.size > len_ - offset) return false;
+        const std::size_t size = static_cast<std::size_t>(sample_hdr.size);
+        func_(buf_ + offset, size, static_cast<long long>(sample_hdr.id), static_cast<long long>(sample_hdr.clock), static_cast<long long>(sample_hdr.time));
+        offset += (std::min)(AlignUp(size), len_ - offset);
+      }
+      return true;
+    }
+  }
+}
@@ -30,6 +30,7 @@
 #include "registration/ecal_registration_provider.h"
 #include "ecal_descgate.h"
 #include "ecal_reader.h"
+#include "ecal_batch_frame.h"
 #include "ecal_process.h"
 
 #include "readwrite/udp/ecal_reader_udp_mc.h"
@@ -46,6 +47,18 @@
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
+
+namespace
+{
+  // sample view together with the owner of its payload (pinned memory file or private copy)
+  struct SReceiveViewHolder
+  {
+    eCAL::SReceiveViewData       view;
+    std::shared_ptr<const void>  pin;
+    std::vector<char>            copy;
+  };
+}
 
 namespace eCAL
 {
@@ -60,10 +73,13 @@ namespace eCAL
                  m_pname(Process::GetProcessName()),
                  m_topic_size(0),
                  m_connected(false),
-                 m_read_buf_received(false),
-                 m_read_time(0),
+                 m_read_ring_head(0),
+                 m_read_ring_count(0),
                  m_receive_timeout(0),
                  m_receive_time(0),
+                 m_receive_queue_size(0),
+                 m_receive_queue_drops(0),
+                 m_dispatch_scheduled(false),
                  m_clock(0),
                  m_frequency_calculator(3.0f),
                  m_message_drops(0),
@@ -95,6 +111,24 @@ namespace eCAL
     m_clock         = 0;
     m_message_drops = 0;
     m_created       = false;
+
+    // polling receive ring
+    {
+      const std::lock_guard<std::mutex> read_buffer_lock(m_read_buf_mutex);
+      m_read_ring.clear();
+      m_read_ring.resize(static_cast<size_t>(std::max(m_qos.history_kind_depth, 1)));
+      m_read_ring_head  = 0;
+      m_read_ring_count = 0;
+    }
+
+    // asynchronous delivery, samples are queued and the receive callbacks are called by the dispatcher threads
+    m_receive_queue.reset();
+    m_receive_queue_size  = 0;
+    m_receive_queue_drops = 0;
+    if ((m_qos.delivery == QOS::asynchronous_delivery_qos) && (Config::Experimental::GetSubscriberDispatcherThreadCount() > 0))
+    {
+      m_receive_queue = std::make_unique<ReceiveQueueT>(static_cast<size_t>(std::max(m_qos.history_kind_depth, 1)));
+    }
 #ifndef NDEBUG
     // log it
     Logging::Log(log_level_debug1, m_topic_name + "::CDataReader::Create");
@@ -139,10 +173,17 @@ namespace eCAL
     // stop transport layers
     UnsubscribeFromLayers();
 
-    // reset receive callback
+    // reset receive callback and discard queued samples
     {
+      const std::lock_guard<std::mutex> dispatch_lock(m_dispatch_sync);
       const std::lock_guard<std::mutex> lock(m_receive_callback_sync);
-      m_receive_callback = nullptr;
+      m_receive_callback      = nullptr;
+      m_receive_view_callback = nullptr;
+      if (m_receive_queue)
+      {
+        while (m_receive_queue->Pop(m_dispatch_sample)) {}
+        m_receive_queue_size = 0;
+      }
     }
 
     // reset event callback map
@@ -395,33 +436,23 @@ namespace eCAL
 
     std::unique_lock<std::mutex> read_buffer_lock(m_read_buf_mutex);
 
-    // No need to wait (for whatever time) if something has been received
-    if (!m_read_buf_received)
-    {
-      if (rcv_timeout_ms_ < 0)
-      {
-        m_read_buf_cv.wait(read_buffer_lock, [this]() { return this->m_read_buf_received; });
-      }
-      else if (rcv_timeout_ms_ > 0)
-      {
-        m_read_buf_cv.wait_for(read_buffer_lock, std::chrono::milliseconds(rcv_timeout_ms_), [this]() { return this->m_read_buf_received; });
-      }
-    }
-
     // did we receive new samples ?
-    if (m_read_buf_received)
+    if (WaitForReadSamples(read_buffer_lock, rcv_timeout_ms_))
     {
 #ifndef NDEBUG
       // log it
       Logging::Log(log_level_debug3, m_topic_name + "::CDataReader::Receive");
 #endif
-      // copy content to target string
+      // move newest sample to target string, older ones are discarded
+      SReceivedSample& sample = m_read_ring[(m_read_ring_head + m_read_ring_count - 1) % m_read_ring.size()];
       buf_.clear();
-      buf_.swap(m_read_buf);
-      m_read_buf_received = false;
+      buf_.swap(sample.buf);
 
       // apply time
-      if(time_ != nullptr) *time_ = m_read_time;
+      if(time_ != nullptr) *time_ = sample.time;
+
+      m_read_ring_head  = (m_read_ring_head + m_read_ring_count) % m_read_ring.size();
+      m_read_ring_count = 0;
 
       // return success
       return(true);
@@ -430,7 +461,55 @@ namespace eCAL
     return(false);
   }
 
-  size_t CDataReader::AddSample(const std::string& tid_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_)
+  size_t CDataReader::ReceiveBatch(std::vector<SReceivedSample>& samples_, int rcv_timeout_ms_ /* = 0 */)
+  {
+    if (!m_created) return(0);
+
+    std::unique_lock<std::mutex> read_buffer_lock(m_read_buf_mutex);
+
+    // did we receive new samples ?
+    if (!WaitForReadSamples(read_buffer_lock, rcv_timeout_ms_)) return(0);
+
+#ifndef NDEBUG
+    // log it
+    Logging::Log(log_level_debug3, m_topic_name + "::CDataReader::ReceiveBatch");
+#endif
+    // move all samples out (oldest first), the ring gets the buffers of the target samples in exchange
+    const size_t count = m_read_ring_count;
+    samples_.resize(count);
+    for (size_t idx = 0; idx < count; ++idx)
+    {
+      SReceivedSample& sample = m_read_ring[(m_read_ring_head + idx) % m_read_ring.size()];
+      samples_[idx].buf.swap(sample.buf);
+      samples_[idx].id    = sample.id;
+      samples_[idx].clock = sample.clock;
+      samples_[idx].time  = sample.time;
+    }
+
+    m_read_ring_head  = (m_read_ring_head + count) % m_read_ring.size();
+    m_read_ring_count = 0;
+
+    return(count);
+  }
+
+  bool CDataReader::WaitForReadSamples(std::unique_lock<std::mutex>& read_buffer_lock_, int rcv_timeout_ms_)
+  {
+    // No need to wait (for whatever time) if something has been received
+    if (m_read_ring_count == 0)
+    {
+      if (rcv_timeout_ms_ < 0)
+      {
+        m_read_buf_cv.wait(read_buffer_lock_, [this]() { return this->m_read_ring_count > 0; });
+      }
+      else if (rcv_timeout_ms_ > 0)
+      {
+        m_read_buf_cv.wait_for(read_buffer_lock_, std::chrono::milliseconds(rcv_timeout_ms_), [this]() { return this->m_read_ring_count > 0; });
+      }
+    }
+    return(m_read_ring_count > 0);
+  }
+
+  size_t CDataReader::AddSample(const std::string& tid_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_, const SamplePinT& pin_ /*= SamplePinT()*/)
   {
     // ensure thread safety
     const std::lock_guard<std::mutex> lock(m_receive_callback_sync);
@@ -442,13 +521,11 @@ namespace eCAL
     m_use_tcp_confirmed    |= layer_ == eCAL::pb::tl_ecal_tcp;
     m_use_inproc_confirmed |= layer_ == eCAL::pb::tl_inproc;
 
-    // number of hash values to track for duplicates
-    constexpr int hash_queue_size(64);
-
     // use hash to discard multiple receives of the same payload
-    //   if a hash is in the queue we received this message recently (on another transport layer ?)
+    //   if a hash is in the set we received this message recently (on another transport layer ?)
     //   so we return and do not process this sample again
-    if(std::find(m_sample_hash_queue.begin(), m_sample_hash_queue.end(), hash_) != m_sample_hash_queue.end())
+    //   (the set remembers the last 64 sample hashes)
+    if (!m_sample_hash_set.Insert(hash_))
     {
 #ifndef NDEBUG
       // log it
@@ -456,11 +533,23 @@ namespace eCAL
 #endif
       return(size_);
     }
-    //   this is a new sample -> store its hash
-    m_sample_hash_queue.push_back(hash_);
 
-    // limit size of hash queue to the last 64 messages
-    while (m_sample_hash_queue.size() > hash_queue_size) m_sample_hash_queue.pop_front();
+    // batch frame, every contained sample is processed like a single received one
+    if (Batch::IsFrame(payload_, size_, id_))
+    {
+      Batch::ForEachSample(payload_, size_, [this, &tid_, &pin_](const char* sample_payload_, size_t sample_size_, long long sample_id_, long long sample_clock_, long long sample_time_)
+        {
+          ProcessSample(tid_, sample_payload_, sample_size_, sample_id_, sample_clock_, sample_time_, pin_);
+        });
+      return(size_);
+    }
+
+    return(ProcessSample(tid_, payload_, size_, id_, clock_, time_, pin_));
+  }
+
+  size_t CDataReader::ProcessSample(const std::string& tid_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, const SamplePinT& pin_)
+  {
+    // called by AddSample (m_receive_callback_sync locked)
 
     // check id
     if (!m_id_set.empty())
@@ -500,6 +589,75 @@ namespace eCAL
     // store size
     m_topic_size = size_;
 
+    // asynchronous delivery, the dispatcher threads call the receive callbacks
+    if (m_receive_queue)
+    {
+      EnqueueSample(payload_, size_, id_, clock_, time_);
+      return(size_);
+    }
+
+    // synchronous delivery
+    DeliverSample(payload_, size_, id_, clock_, time_, pin_);
+
+    return(size_);
+  }
+
+  void CDataReader::EnqueueSample(const char* payload_, size_t size_, long long id_, long long clock_, long long time_)
+  {
+    // called by AddSample (m_receive_callback_sync locked)
+    m_enqueue_sample.payload.assign(payload_, payload_ + size_);
+    m_enqueue_sample.id    = id_;
+    m_enqueue_sample.clock = clock_;
+    m_enqueue_sample.time  = time_;
+
+    while (!m_receive_queue->Push(m_enqueue_sample))
+    {
+      // queue is full, drop the new sample or make room by dropping the oldest one
+      if ((m_qos.overflow == QOS::drop_newest_overflow_qos) || m_receive_queue->Pop(m_overflow_sample))
+      {
+        m_receive_queue_drops++;
+        m_message_drops++;
+#ifndef NDEBUG
+        // log it
+        Logging::Log(log_level_debug3, m_topic_name + "::CDataReader::AddSample::Queue overflow");
+#endif
+        if (m_qos.overflow == QOS::drop_newest_overflow_qos) return;
+        m_receive_queue_size--;
+      }
+    }
+    m_receive_queue_size++;
+  }
+
+  bool CDataReader::RequestDispatch()
+  {
+    if (!m_receive_queue || (m_receive_queue_size == 0)) return(false);
+    return(!m_dispatch_scheduled.exchange(true));
+  }
+
+  bool CDataReader::DispatchSamples()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_dispatch_sync);
+
+      // deliver at most one queue length per turn, so one busy topic does not starve the others
+      for (size_t count = 0; count < m_receive_queue->Capacity(); ++count)
+      {
+        if (!m_receive_queue->Pop(m_dispatch_sample)) break;
+        m_receive_queue_size--;
+
+        if (!m_created) continue;
+        DeliverSample(m_dispatch_sample.payload.data(), m_dispatch_sample.payload.size(), m_dispatch_sample.id, m_dispatch_sample.clock, m_dispatch_sample.time, SamplePinT());
+      }
+    }
+
+    // samples queued after the last pop are seen either by the
+    // AddSample caller (RequestDispatch) or by this check
+    m_dispatch_scheduled = false;
+    return(RequestDispatch());
+  }
+
+  void CDataReader::DeliverSample(const char* payload_, size_t size_, long long id_, long long clock_, long long time_, const SamplePinT& pin_)
+  {
     // execute callback
     bool processed = false;
     {
@@ -521,6 +679,36 @@ namespace eCAL
         (m_receive_callback)(m_topic_name.c_str(), &cb_data);
         processed = true;
       }
+
+      // call user receive view callback function
+      if(m_receive_view_callback)
+      {
+#ifndef NDEBUG
+        // log it
+        Logging::Log(log_level_debug3, m_topic_name + "::CDataReader::AddSample::ReceiveViewCallback");
+#endif
+        // pin the payload if the transport layer supports it, copy it otherwise
+        auto holder = std::make_shared<SReceiveViewHolder>();
+        if (pin_) holder->pin = pin_();
+        if (holder->pin)
+        {
+          holder->view.buf       = payload_;
+          holder->view.zero_copy = true;
+        }
+        else
+        {
+          holder->copy.assign(payload_, payload_ + size_);
+          holder->view.buf       = holder->copy.data();
+        }
+        holder->view.size  = size_;
+        holder->view.id    = id_;
+        holder->view.time  = time_;
+        holder->view.clock = clock_;
+        // execute it (the view shares the ownership of the holder)
+        const std::shared_ptr<const SReceiveViewData> view(holder, &holder->view);
+        (m_receive_view_callback)(m_topic_name.c_str(), view);
+        processed = true;
+      }
     }
 
     // if not consumed by user receive call
@@ -528,10 +716,20 @@ namespace eCAL
     {
       // push sample into read buffer
       const std::lock_guard<std::mutex> read_buffer_lock(m_read_buf_mutex);
-      m_read_buf.clear();
-      m_read_buf.assign(payload_, payload_ + size_);
-      m_read_time = time_;
-      m_read_buf_received = true;
+      if (m_read_ring.empty()) return;
+
+      // ring is full, overwrite the oldest sample
+      if (m_read_ring_count == m_read_ring.size())
+      {
+        m_read_ring_head = (m_read_ring_head + 1) % m_read_ring.size();
+        m_read_ring_count--;
+      }
+      SReceivedSample& sample = m_read_ring[(m_read_ring_head + m_read_ring_count) % m_read_ring.size()];
+      sample.buf.assign(payload_, payload_ + size_);
+      sample.id    = id_;
+      sample.clock = clock_;
+      sample.time  = time_;
+      m_read_ring_count++;
 
       // inform receive
       m_read_buf_cv.notify_one();
@@ -540,8 +738,6 @@ namespace eCAL
       Logging::Log(log_level_debug3, m_topic_name + "::CDataReader::AddSample::Receive::Buffered");
 #endif
     }
-
-    return(size_);
   }
 
   bool CDataReader::AddReceiveCallback(ReceiveCallbackT callback_)
@@ -550,6 +746,7 @@ namespace eCAL
 
     // store receive callback
     {
+      const std::lock_guard<std::mutex> dispatch_lock(m_dispatch_sync);
       const std::lock_guard<std::mutex> lock(m_receive_callback_sync);
 #ifndef NDEBUG
       // log it
@@ -567,6 +764,7 @@ namespace eCAL
 
     // reset receive callback
     {
+      const std::lock_guard<std::mutex> dispatch_lock(m_dispatch_sync);
       const std::lock_guard<std::mutex> lock(m_receive_callback_sync);
 #ifndef NDEBUG
       // log it
@@ -578,6 +776,42 @@ namespace eCAL
     return(true);
   }
 
+  bool CDataReader::AddReceiveViewCallback(ReceiveViewCallbackT callback_)
+  {
+    if (!m_created) return(false);
+
+    // store receive view callback
+    {
+      const std::lock_guard<std::mutex> dispatch_lock(m_dispatch_sync);
+      const std::lock_guard<std::mutex> lock(m_receive_callback_sync);
+#ifndef NDEBUG
+      // log it
+      Logging::Log(log_level_debug2, m_topic_name + "::CDataReader::AddReceiveViewCallback");
+#endif
+      m_receive_view_callback = std::move(callback_);
+    }
+
+    return(true);
+  }
+
+  bool CDataReader::RemReceiveViewCallback()
+  {
+    if (!m_created) return(false);
+
+    // reset receive view callback
+    {
+      const std::lock_guard<std::mutex> dispatch_lock(m_dispatch_sync);
+      const std::lock_guard<std::mutex> lock(m_receive_callback_sync);
+#ifndef NDEBUG
+      // log it
+      Logging::Log(log_level_debug2, m_topic_name + "::CDataReader::RemReceiveViewCallback");
+#endif
+      m_receive_view_callback = nullptr;
+    }
+
+    return(true);
+  }
+
   bool CDataReader::AddEventCallback(eCAL_Subscriber_Event type_, SubEventCallbackT callback_)
   {
     if (!m_created) return(false);
@@ -995,8 +1229,8 @@ namespace eCAL
     out << indent_ << "m_topic_info.name:                  " << m_topic_info.name                  << std::endl;
     out << indent_ << "m_topic_info.descriptor:            " << m_topic_info.descriptor            << std::endl;
     out << indent_ << "m_topic_size:                       " << m_topic_size                       << std::endl;
-    out << indent_ << "m_read_buf.size():                  " << m_read_buf.size()                  << std::endl;
-    out << indent_ << "m_read_time:                        " << m_read_time                        << std::endl;
+    out << indent_ << "m_read_ring.size():                 " << m_read_ring.size()                 << std::endl;
+    out << indent_ << "m_read_ring_count:                  " << m_read_ring_count                  << std::endl;
     out << indent_ << "m_clock:                            " << m_clock                            << std::endl;
     out << indent_ << "frequency [mHz]:                    " << GetFrequency()                     << std::endl;
     out << indent_ << "m_created:                          " << m_created                          << std::endl;
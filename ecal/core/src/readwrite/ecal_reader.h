@@ -26,7 +26,6 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
-#include <deque>
 #include <ecal/ecal.h>
 #include <ecal/ecal_callback.h>
 #include <ecal/ecal_types.h>
@@ -40,9 +39,13 @@
 #pragma warning(pop)
 #endif
 
+#include "readwrite/ecal_reader_data.h"
+#include "util/ecal_bounded_queue.h"
 #include "util/ecal_expmap.h"
+#include "util/ecal_recent_hash_set.h"
 
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <atomic>
 #include <set>
@@ -50,6 +53,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <util/frequency_calculator.h>
 
@@ -69,10 +73,14 @@ namespace eCAL
     bool SetQOS(const QOS::SReaderQOS& qos_);
 
     bool Receive(std::string& buf_, long long* time_ = nullptr, int rcv_timeout_ms_ = 0);
+    size_t ReceiveBatch(std::vector<SReceivedSample>& samples_, int rcv_timeout_ms_ = 0);
 
     bool AddReceiveCallback(ReceiveCallbackT callback_);
     bool RemReceiveCallback();
 
+    bool AddReceiveViewCallback(ReceiveViewCallbackT callback_);
+    bool RemReceiveViewCallback();
+
     bool AddEventCallback(eCAL_Subscriber_Event type_, SubEventCallbackT callback_);
     bool RemEventCallback(eCAL_Subscriber_Event type_);
 
@@ -109,7 +117,14 @@ namespace eCAL
     void RefreshRegistration();
     void CheckReceiveTimeout();
 
-    size_t AddSample(const std::string& tid_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_);
+    size_t AddSample(const std::string& tid_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_, const SamplePinT& pin_ = SamplePinT());
+
+    // asynchronous delivery: true if samples are queued and the reader has to be scheduled for dispatching
+    bool RequestDispatch();
+    // asynchronous delivery: deliver queued samples, true if the reader has to be scheduled again
+    bool DispatchSamples();
+
+    size_t GetQueueDropCount() const {return(static_cast<size_t>(m_receive_queue_drops));}
 
   protected:
     void SubscribeToLayers();
@@ -121,6 +136,10 @@ namespace eCAL
     void Connect(const std::string& tid_, const SDataTypeInformation& topic_info_);
     void Disconnect();
     bool CheckMessageClock(const std::string& tid_, long long current_clock_);
+    size_t ProcessSample(const std::string& tid_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, const SamplePinT& pin_);
+
+    void EnqueueSample(const char* payload_, size_t size_, long long id_, long long clock_, long long time_);
+    void DeliverSample(const char* payload_, size_t size_, long long id_, long long clock_, long long time_, const SamplePinT& pin_);
 
     int32_t GetFrequency();
 
@@ -143,18 +162,41 @@ namespace eCAL
     ConnectedMapT                             m_loc_pub_map;
     ConnectedMapT                             m_ext_pub_map;
 
+    // samples for polling receive (if no receive callback is set), ring of qos history depth slots
+    bool WaitForReadSamples(std::unique_lock<std::mutex>& read_buffer_lock_, int rcv_timeout_ms_);
+
     mutable std::mutex                        m_read_buf_mutex;
     std::condition_variable                   m_read_buf_cv;
-    bool                                      m_read_buf_received;
-    std::string                               m_read_buf;
-    long long                                 m_read_time;
+    std::vector<SReceivedSample>              m_read_ring;
+    size_t                                    m_read_ring_head;
+    size_t                                    m_read_ring_count;
 
     std::mutex                                m_receive_callback_sync;
     ReceiveCallbackT                          m_receive_callback;
+    ReceiveViewCallbackT                      m_receive_view_callback;
     std::atomic<int>                          m_receive_timeout;
     std::atomic<int>                          m_receive_time;
 
-    std::deque<size_t>                        m_sample_hash_queue;
+    // hashes of the last received samples (discard samples received on multiple layers)
+    Util::CRecentHashSet<64>                  m_sample_hash_set;
+
+    // receive queue for asynchronous delivery (sized by qos history depth)
+    struct SQueuedSample
+    {
+      std::vector<char> payload;
+      long long         id    = 0;
+      long long         clock = 0;
+      long long         time  = 0;
+    };
+    using ReceiveQueueT = Util::CBoundedQueue<SQueuedSample>;
+    std::unique_ptr<ReceiveQueueT>            m_receive_queue;
+    std::atomic<size_t>                       m_receive_queue_size;
+    std::atomic<size_t>                       m_receive_queue_drops;
+    SQueuedSample                             m_enqueue_sample;
+    SQueuedSample                             m_overflow_sample;
+    std::atomic<bool>                         m_dispatch_scheduled;
+    std::mutex                                m_dispatch_sync;
+    SQueuedSample                             m_dispatch_sample;
 
     std::mutex                                m_event_callback_map_sync;
     using EventCallbackMapT = std::map<eCAL_Subscriber_Event, SubEventCallbackT>;
@@ -0,0 +1,34 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  data reader sample pin
+**/
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+namespace eCAL
+{
+  // keeps the payload of a received sample valid (e.g. by holding a memory file read lock)
+  // as long as the returned owner exists, returns nullptr if the payload can not be pinned
+  using SamplePinT = std::function<std::shared_ptr<const void> ()>;
+}
@@ -0,0 +1,116 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL data reader dispatcher (asynchronous sample delivery)
+**/
+
+#include "ecal_reader_dispatcher.h"
+#include "ecal_reader.h"
+
+#include <utility>
+
+namespace eCAL
+{
+  CReaderDispatcher::CReaderDispatcher() :
+    m_thread_count(0),
+    m_do_dispatch(false)
+  {
+  }
+
+  CReaderDispatcher::~CReaderDispatcher()
+  {
+    Destroy();
+  }
+
+  void CReaderDispatcher::Create(size_t thread_count_)
+  {
+    const std::lock_guard<std::mutex> lock(m_queue_mtx);
+    if (m_do_dispatch) return;
+
+    m_thread_count = thread_count_;
+    m_do_dispatch  = (m_thread_count > 0);
+  }
+
+  void CReaderDispatcher::Destroy()
+  {
+    std::vector<std::thread> threads;
+    {
+      const std::lock_guard<std::mutex> lock(m_queue_mtx);
+      if (!m_do_dispatch) return;
+
+      m_do_dispatch = false;
+      m_queue.clear();
+      threads.swap(m_threads);
+    }
+    m_queue_cv.notify_all();
+
+    for (auto& thread : threads)
+    {
+      if (thread.joinable()) thread.join();
+    }
+  }
+
+  bool CReaderDispatcher::Schedule(const std::shared_ptr<CDataReader>& reader_)
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_queue_mtx);
+      if (!m_do_dispatch) return false;
+
+      // start threads on first use, most processes never use asynchronous delivery
+      if (m_threads.empty())
+      {
+        for (size_t idx = 0; idx < m_thread_count; ++idx)
+        {
+          m_threads.emplace_back(&CReaderDispatcher::DispatcherThread, this);
+        }
+      }
+
+      m_queue.push_back(reader_);
+    }
+    m_queue_cv.notify_one();
+
+    return true;
+  }
+
+  void CReaderDispatcher::DispatcherThread()
+  {
+    for (;;)
+    {
+      std::shared_ptr<CDataReader> reader;
+      {
+        std::unique_lock<std::mutex> lock(m_queue_mtx);
+        m_queue_cv.wait(lock, [this]() { return !m_do_dispatch || !m_queue.empty(); });
+        if (!m_do_dispatch) return;
+
+        reader = std::move(m_queue.front());
+        m_queue.pop_front();
+      }
+
+      // drain the reader, it is scheduled again (at the end of the queue)
+      // if new samples arrived while draining
+      if (reader->DispatchSamples())
+      {
+        const std::lock_guard<std::mutex> lock(m_queue_mtx);
+        if (!m_do_dispatch) return;
+        m_queue.push_back(std::move(reader));
+      }
+    }
+  }
+}
@@ -0,0 +1,67 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL data reader dispatcher (asynchronous sample delivery)
+**/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eCAL
+{
+  class CDataReader;
+
+  /**
+   * @brief Thread pool calling the receive callbacks of data readers with asynchronous delivery qos.
+   *
+   * Transport layer threads only queue the samples inside the data reader and
+   * schedule the reader here. A scheduled reader is drained by exactly one
+   * dispatcher thread at a time. Threads are started with the first scheduled reader.
+  **/
+  class CReaderDispatcher
+  {
+  public:
+    CReaderDispatcher();
+    ~CReaderDispatcher();
+
+    void Create(size_t thread_count_);
+    void Destroy();
+
+    bool Schedule(const std::shared_ptr<CDataReader>& reader_);
+
+  protected:
+    void DispatcherThread();
+
+    size_t                                     m_thread_count;
+    std::vector<std::thread>                   m_threads;
+
+    std::mutex                                 m_queue_mtx;
+    std::condition_variable                    m_queue_cv;
+    std::deque<std::shared_ptr<CDataReader>>   m_queue;
+    bool                                       m_do_dispatch;
+  };
+}
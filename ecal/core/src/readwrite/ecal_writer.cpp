@@ -27,6 +27,7 @@
 #include <ecal/ecal_payload_writer.h>
 
 #include "ecal_def.h"
+#include "ecal_batch_frame.h"
 #include "ecal_buffer_payload_writer.h"
 #include "config/ecal_config_reader_hlp.h"
 
@@ -39,6 +40,7 @@
 
 #include "pubsub/ecal_pubgate.h"
 
+#include <algorithm>
 #include <chrono>
 #include <functional>
 #include <mutex>
@@ -76,8 +78,14 @@ namespace eCAL
     m_pname(Process::GetProcessName()),
     m_topic_size(0),
     m_buffering_shm(PUB_MEMFILE_BUF_COUNT),
+    m_ring_slots_shm(PUB_MEMFILE_RING_SLOTS),
     m_zero_copy(PUB_MEMFILE_ZERO_COPY),
     m_acknowledge_timeout_ms(PUB_MEMFILE_ACK_TO),
+    m_loan_state(eLoanState::none),
+    m_loan_size(0),
+    m_batch_max_size(0),
+    m_batch_max_delay(0),
+    m_batch_time(0),
     m_connected(false),
     m_id(0),
     m_clock(0),
@@ -115,6 +123,7 @@ namespace eCAL
     m_clock                  = 0;
     m_bandwidth_max_udp      = Config::GetMaxUdpBandwidthBytesPerSecond();
     m_buffering_shm          = Config::GetMemfileBufferCount();
+    m_ring_slots_shm         = Config::GetMemfileRingSlotCount();
     m_zero_copy              = Config::IsMemfileZerocopyEnabled();
     m_acknowledge_timeout_ms = Config::GetMemfileAckTimeoutMs();
     m_connected              = false;
@@ -175,11 +184,15 @@ namespace eCAL
     Logging::Log(log_level_debug1, m_topic_name + "::CDataWriter::Destroy");
 #endif
 
+    // send pending batched samples and stop batching
+    SetBatching(0, 0);
+
     // destroy udp multicast writer
     m_writer.udp_mc.Destroy();
 
-    // destroy memory file writer
+    // destroy memory file writer (releases a pending loan too)
     m_writer.shm.Destroy();
+    m_loan_state = eLoanState::none;
 
     // destroy inproc writer
     m_writer.inproc.Destroy();
@@ -189,6 +202,7 @@ namespace eCAL
     m_clock                  = 0;
     m_bandwidth_max_udp      = Config::GetMaxUdpBandwidthBytesPerSecond();
     m_buffering_shm          = Config::GetMemfileBufferCount();
+    m_ring_slots_shm         = Config::GetMemfileRingSlotCount();
     m_zero_copy              = Config::IsMemfileZerocopyEnabled();
     m_acknowledge_timeout_ms = Config::GetMemfileAckTimeoutMs();
     m_connected              = false;
@@ -353,6 +367,13 @@ namespace eCAL
     return true;
   }
 
+  bool CDataWriter::ShmSetRingSlotCount(size_t slots_)
+  {
+    // applied with the next write call
+    m_ring_slots_shm = slots_;
+    return true;
+  }
+
   bool CDataWriter::ShmEnableZeroCopy(bool state_)
   {
     m_zero_copy = state_;
@@ -404,7 +425,145 @@ namespace eCAL
     return(true);
   }
 
+  bool CDataWriter::SetBatching(size_t max_size_, long long max_delay_us_)
+  {
+    if (!m_created) return(false);
+
+    // stop the flush thread first, it locks the batch itself
+    if (m_batch_flush_thread)
+    {
+      m_batch_flush_thread->stop();
+      m_batch_flush_thread.reset();
+    }
+
+    {
+      const std::lock_guard<std::mutex> lock(m_batch_sync);
+
+      // send the samples collected with the old settings
+      FlushBatchLocked();
+
+      m_batch_max_size  = max_size_;
+      m_batch_max_delay = std::chrono::microseconds(max_delay_us_ > 0 ? max_delay_us_ : 0);
+    }
+
+    // a partly filled frame is sent by the next write or by the flush thread when the time window elapsed,
+    // the thread only covers publishers that stopped sending, so it does not need to wake up more often than every millisecond
+    if ((max_size_ > 0) && (max_delay_us_ > 0))
+    {
+      const std::chrono::microseconds flush_period((std::max)(max_delay_us_ / 2, static_cast<long long>(PUB_BATCH_FLUSH_PERIOD_MIN_US)));
+      m_batch_flush_thread = std::make_shared<CCallbackThread>(std::bind(&CDataWriter::CheckBatchTimeout, this));
+      m_batch_flush_thread->start(flush_period);
+    }
+
+#ifndef NDEBUG
+    // log it
+    Logging::Log(log_level_debug2, m_topic_name + "::CDataWriter::SetBatching");
+#endif
+
+    return(true);
+  }
+
+  bool CDataWriter::FlushBatch()
+  {
+    const std::lock_guard<std::mutex> lock(m_batch_sync);
+    return FlushBatchLocked();
+  }
+
   size_t CDataWriter::Write(CPayloadWriter& payload_, long long time_, long long id_)
+  {
+    // batching mode, small samples are collected and sent as one frame
+    if (m_batch_max_size > 0)
+    {
+      return WriteBatched(payload_, time_, id_);
+    }
+
+    return WriteLayers(payload_, time_, id_, true);
+  }
+
+  size_t CDataWriter::WriteBatched(CPayloadWriter& payload_, long long time_, long long id_)
+  {
+    const std::lock_guard<std::mutex> lock(m_batch_sync);
+
+    const size_t max_size(m_batch_max_size);
+    const size_t payload_buf_size(payload_.GetSize());
+
+    // sample does not fit into the current frame, send the frame first
+    if ((Batch::SampleCount(m_batch_frame) > 0) && (m_batch_frame.size() + Batch::SampleFrameSize(payload_buf_size) > max_size))
+    {
+      FlushBatchLocked();
+    }
+
+    // sample does not fit into any frame (or batching was switched off meanwhile), send it as a usual sample
+    if (sizeof(Batch::SFrameHeader) + Batch::SampleFrameSize(payload_buf_size) > max_size)
+    {
+      return WriteLayers(payload_, time_, id_, true);
+    }
+
+    // check writer modes
+    if (!CheckWriterModes())
+    {
+      // incompatible writer configurations
+      return 0;
+    }
+
+    // first sample opens the time window
+    if (Batch::SampleCount(m_batch_frame) == 0)
+    {
+      Batch::InitFrame(m_batch_frame);
+      m_batch_start = std::chrono::steady_clock::now();
+    }
+
+    // every sample gets its own id, clock and time
+    m_id = id_;
+    RefreshSendCounter();
+    char* sample_buf = Batch::AppendSample(m_batch_frame, payload_buf_size, id_, m_clock, time_);
+    if (payload_buf_size > 0)
+    {
+      payload_.WriteFull(sample_buf, payload_buf_size);
+    }
+    m_batch_time = time_;
+
+    // frame is full or the time window elapsed (no window -> frames are sent when full or flushed explicitly)
+    const bool frame_full  = m_batch_frame.size() + sizeof(Batch::SSampleHeader) > max_size;
+    const bool window_full  = (m_batch_max_delay.count() > 0) && (std::chrono::steady_clock::now() - m_batch_start >= m_batch_max_delay);
+    if (frame_full || window_full)
+    {
+      FlushBatchLocked();
+    }
+
+    return payload_buf_size;
+  }
+
+  bool CDataWriter::FlushBatchLocked()
+  {
+    // called with m_batch_sync locked
+    if (Batch::SampleCount(m_batch_frame) == 0) return(false);
+
+    // the frame is sent like a usual sample with the clock of its last sample
+    CBufferPayloadWriter frame_payload(m_batch_frame.data(), m_batch_frame.size());
+    const size_t sent = WriteLayers(frame_payload, m_batch_time, Batch::frame_id, false);
+    m_batch_frame.clear();
+
+#ifndef NDEBUG
+    // log it
+    Logging::Log(log_level_debug4, m_topic_name + "::CDataWriter::FlushBatch");
+#endif
+
+    return(sent > 0);
+  }
+
+  void CDataWriter::CheckBatchTimeout()
+  {
+    const std::lock_guard<std::mutex> lock(m_batch_sync);
+    if (Batch::SampleCount(m_batch_frame) == 0) return;
+
+    if (std::chrono::steady_clock::now() - m_batch_start >= m_batch_max_delay)
+    {
+      FlushBatchLocked();
+    }
+  }
+
+  size_t CDataWriter::WriteLayers(CPayloadWriter& payload_, long long time_, long long id_, bool new_sample_)
   {
     // check writer modes
     if (!CheckWriterModes())
@@ -432,7 +591,7 @@ namespace eCAL
     }
 
     // prepare counter and internal states
-    const size_t snd_hash = PrepareWrite(id_, payload_buf_size);
+    const size_t snd_hash = PrepareWrite(id_, payload_buf_size, new_sample_);
 
     // did we write anything
     bool written(false);
@@ -453,11 +612,12 @@ namespace eCAL
         // fill writer data
         struct SWriterAttr wattr;
         wattr.len                    = payload_buf_size;
-        wattr.id                     = m_id;
+        wattr.id                     = id_;
         wattr.clock                  = m_clock;
         wattr.hash                   = snd_hash;
         wattr.time                   = time_;
         wattr.buffering              = m_buffering_shm;
+        wattr.ring_slots             = m_ring_slots_shm;
         wattr.zero_copy              = m_zero_copy;
         wattr.acknowledge_timeout_ms = m_acknowledge_timeout_ms;
 
@@ -517,7 +677,7 @@ namespace eCAL
         // fill writer data
         struct SWriterAttr wdata;
         wdata.len   = payload_buf_size;
-        wdata.id    = m_id;
+        wdata.id    = id_;
         wdata.clock = m_clock;
         wdata.hash  = snd_hash;
         wdata.time  = time_;
@@ -572,7 +732,7 @@ namespace eCAL
         // fill writer data
         struct SWriterAttr wattr;
         wattr.len       = payload_buf_size;
-        wattr.id        = m_id;
+        wattr.id        = id_;
         wattr.clock     = m_clock;
         wattr.hash      = snd_hash;
         wattr.time      = time_;
@@ -622,7 +782,7 @@ namespace eCAL
         // fill writer data
         struct SWriterAttr wattr;
         wattr.len       = payload_buf_size;
-        wattr.id        = m_id;
+        wattr.id        = id_;
         wattr.clock     = m_clock;
         wattr.hash      = snd_hash;
         wattr.time      = time_;
@@ -652,6 +812,142 @@ namespace eCAL
     else         return 0;
   }
 
+  void* CDataWriter::Loan(size_t max_len_)
+  {
+    if (!m_created) return nullptr;
+
+    // only one loan at a time
+    if (m_loan_state != eLoanState::none)
+    {
+      Logging::Log(log_level_error, m_topic_name + "::CDataWriter::Loan: Buffer is already loaned - Loan failed !");
+      return nullptr;
+    }
+
+    // check writer modes
+    if (!CheckWriterModes())
+    {
+      // incompatible writer configurations
+      return nullptr;
+    }
+
+    // can we loan the buffer from the memory file ?
+    const bool allow_shm_loan =
+          (m_batch_max_size == 0)           // no batching (samples are collected in the frame buffer)
+      &&  m_writer.shm_mode.activated       // shm layer active
+      && !m_writer.inproc_mode.activated    // all other layers not active
+      && !m_writer.udp_mc_mode.activated
+      && !m_writer.tcp_mode.activated;
+
+    if (allow_shm_loan)
+    {
+      // fill writer data
+      struct SWriterAttr wattr;
+      wattr.len                    = max_len_;
+      wattr.buffering              = m_buffering_shm;
+      wattr.ring_slots             = m_ring_slots_shm;
+      wattr.zero_copy              = m_zero_copy;
+      wattr.acknowledge_timeout_ms = m_acknowledge_timeout_ms;
+
+      // prepare send (the memory file is sized for the maximum length)
+      if (m_writer.shm.PrepareWrite(wattr))
+      {
+        // register new to update listening subscribers and rematch
+        Register(true);
+        Process::SleepMS(5);
+      }
+
+      void* buf = m_writer.shm.Loan(wattr);
+      if (buf != nullptr)
+      {
+#ifndef NDEBUG
+        // log it
+        Logging::Log(log_level_debug3, m_topic_name + "::CDataWriter::Loan::SHM");
+#endif
+        m_loan_state = eLoanState::shm;
+        m_loan_size  = max_len_;
+        return buf;
+      }
+    }
+
+    // multiple layer are active (or the memory file is not available) -> we loan a local buffer
+    m_loan_buffer.resize(max_len_);
+    m_loan_state = eLoanState::buffer;
+    m_loan_size  = max_len_;
+    return m_loan_buffer.data();
+  }
+
+  size_t CDataWriter::Commit(size_t len_, long long time_, long long id_)
+  {
+    if (m_loan_state == eLoanState::none) return 0;
+
+    // the loaned buffer may be filled partially only
+    if (len_ > m_loan_size)
+    {
+      Logging::Log(log_level_error, m_topic_name + "::CDataWriter::Commit: Length exceeds the loaned buffer size - Commit failed !");
+      Discard();
+      return 0;
+    }
+
+    // local buffer -> we send it like a usual payload
+    if (m_loan_state == eLoanState::buffer)
+    {
+      m_loan_state = eLoanState::none;
+      CBufferPayloadWriter payload_buf(m_loan_buffer.data(), len_);
+      return Write(payload_buf, time_, id_);
+    }
+    m_loan_state = eLoanState::none;
+
+    // prepare counter and internal states
+    const size_t snd_hash = PrepareWrite(id_, len_);
+
+    // fill writer data
+    struct SWriterAttr wattr;
+    wattr.len                    = len_;
+    wattr.id                     = m_id;
+    wattr.clock                  = m_clock;
+    wattr.hash                   = snd_hash;
+    wattr.time                   = time_;
+    wattr.buffering              = m_buffering_shm;
+    wattr.ring_slots             = m_ring_slots_shm;
+    wattr.zero_copy              = m_zero_copy;
+    wattr.acknowledge_timeout_ms = m_acknowledge_timeout_ms;
+
+    // publish the memory file content
+    const bool shm_sent = m_writer.shm.Commit(wattr);
+    m_writer.shm_mode.confirmed = true;
+
+#ifndef NDEBUG
+    // log it
+    if (shm_sent)
+    {
+      Logging::Log(log_level_debug3, m_topic_name + "::CDataWriter::Commit::SHM - SUCCESS");
+    }
+    else
+    {
+      Logging::Log(log_level_error, m_topic_name + "::CDataWriter::Commit::SHM - FAILED");
+    }
+#endif
+
+    // return success
+    if (shm_sent) return len_;
+    else          return 0;
+  }
+
+  bool CDataWriter::Discard()
+  {
+    switch (m_loan_state)
+    {
+    case eLoanState::shm:
+      m_loan_state = eLoanState::none;
+      return m_writer.shm.Discard();
+    case eLoanState::buffer:
+      m_loan_state = eLoanState::none;
+      return true;
+    default:
+      return false;
+    }
+  }
+
   void CDataWriter::ApplyLocSubscription(const SLocalSubscriptionInfo& local_info_, const SDataTypeInformation& tinfo_, const std::string& reader_par_)
   {
     Connect(local_info_.topic_id, tinfo_);
@@ -1255,13 +1551,17 @@ namespace eCAL
     return true;
   }
 
-  size_t CDataWriter::PrepareWrite(long long id_, size_t len_)
+  size_t CDataWriter::PrepareWrite(long long id_, size_t len_, bool new_sample_ /*= true*/)
   {
-    // store id
-    m_id = id_;
+    // a batch frame keeps id and clock of its last sample
+    if (new_sample_)
+    {
+      // store id
+      m_id = id_;
 
-    // handle write counters
-    RefreshSendCounter();
+      // handle write counters
+      RefreshSendCounter();
+    }
 
     // calculate unique send hash
     const std::hash<SSndHash> hf;
@@ -31,6 +31,7 @@
 
 #include "ecal_def.h"
 #include "util/ecal_expmap.h"
+#include "util/ecal_thread.h"
 #include <util/frequency_calculator.h>
 
 
@@ -40,7 +41,9 @@
 #include "inproc/ecal_writer_inproc.h"
 
 #include <atomic>
+#include <chrono>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <tuple>
@@ -96,16 +99,24 @@ namespace eCAL
     bool SetMaxBandwidthUDP(long bandwidth_);
 
     bool ShmSetBufferCount(size_t buffering_);
+    bool ShmSetRingSlotCount(size_t slots_);
     bool ShmEnableZeroCopy(bool state_);
 
     bool ShmSetAcknowledgeTimeout(long long acknowledge_timeout_ms_);
     long long ShmGetAcknowledgeTimeout() const;
 
+    bool SetBatching(size_t max_size_, long long max_delay_us_);
+    bool FlushBatch();
+
     bool AddEventCallback(eCAL_Publisher_Event type_, PubEventCallbackT callback_);
     bool RemEventCallback(eCAL_Publisher_Event type_);
 
     size_t Write(CPayloadWriter& payload_, long long time_, long long id_);
 
+    void* Loan(size_t max_len_);
+    size_t Commit(size_t len_, long long time_, long long id_);
+    bool Discard();
+
     void ApplyLocSubscription(const SLocalSubscriptionInfo& local_info_, const SDataTypeInformation& tinfo_, const std::string& reader_par_);
     void RemoveLocSubscription(const SLocalSubscriptionInfo& local_info_);
 
@@ -142,7 +153,12 @@ namespace eCAL
     void SetUseInProc(TLayer::eSendMode mode_);
 
     bool CheckWriterModes();
-    size_t PrepareWrite(long long id_, size_t len_);
+    size_t PrepareWrite(long long id_, size_t len_, bool new_sample_ = true);
+    size_t WriteLayers(CPayloadWriter& payload_, long long time_, long long id_, bool new_sample_);
+
+    size_t WriteBatched(CPayloadWriter& payload_, long long time_, long long id_);
+    bool FlushBatchLocked();
+    void CheckBatchTimeout();
     bool IsInternalSubscribedOnly();
     void LogSendMode(TLayer::eSendMode smode_, const std::string & base_msg_);
 
@@ -162,11 +178,25 @@ namespace eCAL
     QOS::SWriterQOS    m_qos;
 
     size_t             m_buffering_shm;
+    size_t             m_ring_slots_shm;
     bool               m_zero_copy;
     long long          m_acknowledge_timeout_ms;
 
     std::vector<char>  m_payload_buffer;
 
+    enum class eLoanState { none, shm, buffer };
+    eLoanState         m_loan_state;
+    size_t             m_loan_size;
+    std::vector<char>  m_loan_buffer;
+
+    std::mutex                                m_batch_sync;
+    std::atomic<size_t>                       m_batch_max_size;
+    std::chrono::microseconds                 m_batch_max_delay;
+    std::vector<char>                         m_batch_frame;
+    std::chrono::steady_clock::time_point     m_batch_start;
+    long long                                 m_batch_time;
+    std::shared_ptr<CCallbackThread>          m_batch_flush_thread;
+
     std::atomic<bool>  m_connected;
 
     using LocalConnectedMapT = Util::CExpMap<SLocalSubscriptionInfo, bool>;
@@ -35,9 +35,11 @@ namespace eCAL
     size_t       hash                   = 0;
     long long    time                   = 0;
     size_t       buffering              = 1;
+    size_t       ring_slots             = 0;
     long         bandwidth              = 0;
     bool         loopback               = false;
     bool         zero_copy              = false;
+    bool         pinnable               = false;
     long long    acknowledge_timeout_ms = 0;
   };
 }
@@ -51,6 +51,8 @@ namespace eCAL
   {
     // list of memory file to register
     std::vector<std::string> memfile_names;
+    // list of lock-free ring memory files to register
+    std::vector<std::string> memring_names;
 
     // ----------------------------------------------------------------------
     // REMOVE ME IN ECAL6
@@ -83,6 +85,10 @@ namespace eCAL
         {
           memfile_names.push_back(memfile_name);
         }
+        for (const auto& memring_name : connection_par.layer_par_shm().memory_ring_list())
+        {
+          memring_names.push_back(memring_name);
+        }
       }
       else
       {
@@ -93,23 +99,34 @@ namespace eCAL
 
     for (const auto& memfile_name : memfile_names)
     {
-      // start memory file receive thread if topic is subscribed in this process
-      if (g_memfile_pool() != nullptr)
-      {
-        const std::string process_id = std::to_string(Process::GetProcessID());
-        const std::string memfile_event = memfile_name + "_" + process_id;
-        const MemFileDataCallbackT memfile_data_callback = std::bind(&CSHMReaderLayer::OnNewShmFileContent, this,
-          std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5, std::placeholders::_6, std::placeholders::_7, std::placeholders::_8);
-        g_memfile_pool()->ObserveFile(memfile_name, memfile_event, par_.topic_name, par_.topic_id, Config::GetRegistrationTimeoutMs(), memfile_data_callback);
-      }
+      ObserveFile(memfile_name, par_, false);
+    }
+    for (const auto& memring_name : memring_names)
+    {
+      ObserveFile(memring_name, par_, true);
+    }
+  }
+
+  void CSHMReaderLayer::ObserveFile(const std::string& memfile_name_, const SReaderLayerPar& par_, bool ring_)
+  {
+    // start memory file receive thread if topic is subscribed in this process
+    if (g_memfile_pool() != nullptr)
+    {
+      const std::string process_id = std::to_string(Process::GetProcessID());
+      const std::string memfile_event = memfile_name_ + "_" + process_id;
+      // every memory file is observed by one thread, so it gets its own data reader lookup cache
+      const auto lookup_cache = std::make_shared<CSubGate::ReaderLookupCacheT>();
+      const MemFileDataCallbackT memfile_data_callback = std::bind(&CSHMReaderLayer::OnNewShmFileContent, this, lookup_cache,
+        std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5, std::placeholders::_6, std::placeholders::_7, std::placeholders::_8, std::placeholders::_9);
+      g_memfile_pool()->ObserveFile(memfile_name_, memfile_event, par_.topic_name, par_.topic_id, Config::GetRegistrationTimeoutMs(), memfile_data_callback, ring_);
     }
   }
 
-  size_t CSHMReaderLayer::OnNewShmFileContent(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_)
+  size_t CSHMReaderLayer::OnNewShmFileContent(const std::shared_ptr<CSubGate::ReaderLookupCacheT>& lookup_cache_, const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, const SamplePinT& pin_)
   {
     if (g_subgate() != nullptr)
     {
-      if (g_subgate()->ApplySample(topic_name_, topic_id_, buf_, len_, id_, clock_, time_, hash_, eCAL::pb::tl_ecal_shm))
+      if (g_subgate()->ApplySample(*lookup_cache_, topic_name_, topic_id_, buf_, len_, id_, clock_, time_, hash_, eCAL::pb::tl_ecal_shm, pin_))
       {
         return len_;
       }
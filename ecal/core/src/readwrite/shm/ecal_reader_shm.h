@@ -24,7 +24,9 @@
 #pragma once
 
 #include "ecal_def.h"
+#include "readwrite/ecal_reader_data.h"
 #include "readwrite/ecal_reader_layer.h"
+#include "pubsub/ecal_subgate.h"
 
 #include <cstddef>
 #include <memory>
@@ -48,6 +50,7 @@ namespace eCAL
     void SetConnectionParameter(SReaderLayerPar& par_) override;
 
   private:
-    size_t OnNewShmFileContent(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_);
+    void ObserveFile(const std::string& memfile_name_, const SReaderLayerPar& par_, bool ring_);
+    size_t OnNewShmFileContent(const std::shared_ptr<CSubGate::ReaderLookupCacheT>& lookup_cache_, const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, const SamplePinT& pin_);
   };
 }
@@ -81,6 +81,7 @@ namespace eCAL
     m_memory_file_attr.reserve         = Config::GetMemfileOverprovisioningPercentage();
     m_memory_file_attr.timeout_open_ms = PUB_MEMFILE_OPEN_TO;
     m_memory_file_attr.timeout_ack_ms  = Config::GetMemfileAckTimeoutMs();
+    m_memory_file_attr.ring_slots      = Config::GetMemfileRingSlotCount();
 
     // initialize memory file buffer
     m_created = SetBufferCount(m_buffer_count);;
@@ -94,6 +95,7 @@ namespace eCAL
 
     {
       const std::lock_guard<std::mutex> lock(m_memory_file_vec_mtx);
+      m_loaned_memory_file.reset();
       m_memory_file_vec.clear();
     }
 
@@ -159,13 +161,27 @@ namespace eCAL
     // connection parameters needed
     bool ret_state(false);
 
+    // switch between single buffer and ring mode if needed
+    if (attr_.ring_slots != m_memory_file_attr.ring_slots)
+    {
+      {
+        const std::lock_guard<std::mutex> lock(m_memory_file_vec_mtx);
+        m_memory_file_attr.ring_slots = attr_.ring_slots;
+        m_memory_file_vec.clear();
+      }
+      SetBufferCount(m_buffer_count);
+      ret_state |= true;
+    }
+
     // adapt number of used memory files if needed
-    if (attr_.buffering != m_buffer_count)
+    // (in ring mode the slots of one file replace the multi buffering)
+    const size_t buffer_count = (attr_.ring_slots > 0) ? 1 : attr_.buffering;
+    if (buffer_count != m_buffer_count)
     {
-      SetBufferCount(attr_.buffering);
+      SetBufferCount(buffer_count);
 
       // store new buffer count and flag change
-      m_buffer_count = attr_.buffering;
+      m_buffer_count = buffer_count;
       ret_state |= true;
     }
 
@@ -175,6 +191,35 @@ namespace eCAL
       // adapt write index if needed
       m_write_idx %= m_memory_file_vec.size();
 
+      // skip memory files that are pinned by a sample view (only those are probed, see
+      // CSyncMemoryFile::IsLocked), if all of them are locked we add a spare file instead
+      // of waiting for a pinned one
+      m_pinnable = false;
+      if (m_memory_file_vec.size() > 1)
+      {
+        size_t unlocked_count(0);
+        for (size_t probe = 0; (probe < m_memory_file_vec.size()) && (unlocked_count < 2); ++probe)
+        {
+          const size_t idx = (m_write_idx + probe) % m_memory_file_vec.size();
+          if (!m_memory_file_vec[idx]->IsLocked())
+          {
+            if (unlocked_count == 0) m_write_idx = idx;
+            unlocked_count++;
+          }
+        }
+
+        if ((unlocked_count == 0) && AddSpareBuffer())
+        {
+          m_write_idx = m_memory_file_vec.size() - 1;
+          unlocked_count++;
+          ret_state |= true;
+        }
+
+        // readers can only pin the sample if there is another file left for the next one
+        // (or a spare one can be added), with a single buffer the readers have to copy it
+        m_pinnable = (unlocked_count > 1) || (m_memory_file_vec.size() < 2 * m_buffer_count);
+      }
+
       // check size and reserve new if needed
       ret_state |= m_memory_file_vec[m_write_idx]->CheckSize(attr_.len);
     }
@@ -190,8 +235,44 @@ namespace eCAL
     const std::lock_guard<std::mutex> lock(m_memory_file_vec_mtx);
 
     // write content
+    SWriterAttr attr(attr_);
+    attr.pinnable = m_pinnable;
     const bool force_full_write(m_memory_file_vec.size() > 1);
-    const bool sent = m_memory_file_vec[m_write_idx]->Write(payload_, attr_, force_full_write);
+    const bool sent = m_memory_file_vec[m_write_idx]->Write(payload_, attr, force_full_write);
+
+    // and increment file index
+    m_write_idx++;
+    m_write_idx %= m_memory_file_vec.size();
+
+    return sent;
+  }
+
+  void* CDataWriterSHM::Loan(const SWriterAttr& attr_)
+  {
+    if (!m_created) return nullptr;
+
+    // protect m_memory_file_vec
+    const std::lock_guard<std::mutex> lock(m_memory_file_vec_mtx);
+    if (m_loaned_memory_file) return nullptr;
+
+    // loan the payload area of the current memory file
+    void* buf = m_memory_file_vec[m_write_idx]->Loan(attr_.len);
+    if (buf != nullptr) m_loaned_memory_file = m_memory_file_vec[m_write_idx];
+
+    return buf;
+  }
+
+  bool CDataWriterSHM::Commit(const SWriterAttr& attr_)
+  {
+    // protect m_memory_file_vec
+    const std::lock_guard<std::mutex> lock(m_memory_file_vec_mtx);
+    if (!m_loaned_memory_file) return false;
+
+    // publish content
+    SWriterAttr attr(attr_);
+    attr.pinnable = m_pinnable;
+    const bool sent = m_loaned_memory_file->Commit(attr);
+    m_loaned_memory_file.reset();
 
     // and increment file index
     m_write_idx++;
@@ -200,6 +281,44 @@ namespace eCAL
     return sent;
   }
 
+  bool CDataWriterSHM::Discard()
+  {
+    // protect m_memory_file_vec
+    const std::lock_guard<std::mutex> lock(m_memory_file_vec_mtx);
+    if (!m_loaned_memory_file) return false;
+
+    const bool discarded = m_loaned_memory_file->Discard();
+    m_loaned_memory_file.reset();
+
+    return discarded;
+  }
+
+  bool CDataWriterSHM::AddSpareBuffer()
+  {
+    // m_memory_file_vec is protected by the caller
+
+    // limit the number of spare files to the configured buffer count, if all of them are
+    // locked too we have to wait for the current one (it may be locked by a crashed process)
+    if (m_memory_file_vec.size() >= 2 * m_buffer_count) return false;
+
+    auto sync_memfile = std::make_shared<CSyncMemoryFile>(m_memfile_base_name, m_memory_file_vec[m_write_idx]->GetSize(), m_memory_file_attr);
+    if (!sync_memfile->IsCreated()) return false;
+
+    // connect the processes of the existing files, the readers observe
+    // the new file after the connection parameters are registered again
+    for (const auto& process_id : m_memory_file_vec[m_write_idx]->GetConnectedProcesses())
+    {
+      sync_memfile->Connect(process_id);
+    }
+    m_memory_file_vec.push_back(sync_memfile);
+
+#ifndef NDEBUG
+    Logging::Log(log_level_debug2, m_topic_name + "::CDataWriterSHM::AddSpareBuffer - all memory files are locked, added " + sync_memfile->GetName());
+#endif
+
+    return true;
+  }
+
   void CDataWriterSHM::AddLocConnection(const std::string& process_id_, const std::string& /*topic_id_*/, const std::string& /*conn_par_*/)
   {
     if (!m_created) return;
@@ -226,7 +345,9 @@ namespace eCAL
 
     for (auto& memory_file : m_memory_file_vec)
     {
-      connection_par.mutable_layer_par_shm()->add_memory_file_list(memory_file->GetName());
+      // ring files are announced separately, older readers will not be able to interpret them
+      if (memory_file->IsRing()) connection_par.mutable_layer_par_shm()->add_memory_ring_list(memory_file->GetName());
+      else                       connection_par.mutable_layer_par_shm()->add_memory_file_list(memory_file->GetName());
     }
     return connection_par.SerializeAsString();
   }
@@ -54,17 +54,25 @@ namespace eCAL
 
     bool Write(CPayloadWriter& payload_, const SWriterAttr& attr_) override;
 
+    void* Loan(const SWriterAttr& attr_);
+    bool Commit(const SWriterAttr& attr_);
+    bool Discard();
+
     void AddLocConnection(const std::string& process_id_, const std::string& topic_id_, const std::string& conn_par_) override;
 
     std::string GetConnectionParameter() override;
 
   protected:      
+    bool AddSpareBuffer();
+
     size_t                                        m_write_idx    = 0;
     size_t                                        m_buffer_count = 1;
+    bool                                          m_pinnable     = false;
     SSyncMemoryFileAttr                           m_memory_file_attr = {};
 
     std::mutex                                    m_memory_file_vec_mtx;
     std::vector<std::shared_ptr<CSyncMemoryFile>> m_memory_file_vec;
+    std::shared_ptr<CSyncMemoryFile>              m_loaned_memory_file;
     
     static const std::string                      m_memfile_base_name;
   };
@@ -117,6 +117,7 @@ namespace eCAL
         const auto& ecal_header_content = m_ecal_header.content();
         // apply sample
         g_subgate()->ApplySample(
+          m_lookup_cache,
           ecal_header_topic.tname(),
           ecal_header_topic.tid(),
           data_payload,
@@ -24,6 +24,7 @@
 #pragma once
 
 #include "readwrite/ecal_reader_layer.h"
+#include "pubsub/ecal_subgate.h"
 
 #include <cstdint>
 #include <memory>
@@ -61,6 +62,7 @@ namespace eCAL
     std::shared_ptr<tcp_pubsub::Subscriber> m_subscriber;
     bool                                    m_callback_active;
     eCAL::pb::Sample                        m_ecal_header;
+    CSubGate::ReaderLookupCacheT            m_lookup_cache;
   };
 
   ////////////////
@@ -27,6 +27,7 @@
 
 #include "io/udp/ecal_udp_sample_receiver.h"
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <string>
@@ -52,6 +53,7 @@ namespace eCAL
   private:
     bool HasSample(const std::string& sample_name_);
     bool ApplySample(const eCAL::pb::Sample& ecal_sample_);
+    bool ApplyRawSample(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_);
 
     bool                                   m_started;
     bool                                   m_local_mode;
@@ -22,6 +22,7 @@
 **/
 
 #include <cstddef>
+#include <cstdint>
 #include <ecal/ecal_config.h>
 #include <ecal/ecal_log.h>
 #include <memory>
@@ -63,6 +64,9 @@ namespace eCAL
     m_topic_name  = topic_name_;
     m_topic_id    = topic_id_;
 
+    // sample format
+    m_raw_samples = Config::Experimental::IsUdpRawSampleFormatEnabled();
+
     // set network attributes
     IO::UDP::SSenderAttr attr;
     attr.address   = UDP::GetTopicPayloadAddress(topic_name_);
@@ -98,6 +102,20 @@ namespace eCAL
   {
     if (!m_created) return false;
 
+    // send it
+    const size_t sent = m_raw_samples ? SendRawSample(attr_, buf_) : SendSample(attr_, buf_);
+
+    // log it
+    if (sent == 0)
+    {
+      Logging::Log(log_level_fatal, "CDataWriterUDP::Send failed to send message !");
+    }
+
+    return(sent > 0);
+  }
+
+  size_t CDataWriterUdpMC::SendSample(const SWriterAttr& attr_, const void* buf_)
+  {
     // create new sample
     m_ecal_sample.Clear();
     m_ecal_sample.set_cmd_type(eCAL::pb::bct_set_sample);
@@ -111,38 +129,33 @@ namespace eCAL
     layer->set_type(eCAL::pb::eTLayerType::tl_ecal_udp_mc);
     layer->set_confirmed(true);
 
-    // append content
+    // append content (the payload itself is appended on sending without copying it into the sample)
     auto *ecal_sample_mutable_content = m_ecal_sample.mutable_content();
     ecal_sample_mutable_content->set_id(attr_.id);
     ecal_sample_mutable_content->set_clock(attr_.clock);
     ecal_sample_mutable_content->set_time(attr_.time);
     ecal_sample_mutable_content->set_hash(attr_.hash);
     ecal_sample_mutable_content->set_size((google::protobuf::int32)attr_.len);
-    ecal_sample_mutable_content->set_payload(buf_, attr_.len);
 
     // send it
-    size_t sent = 0;
-    if (attr_.loopback)
-    {
-      if (m_sample_sender_loopback)
-      {
-        sent = m_sample_sender_loopback->Send(m_ecal_sample.topic().tname(), m_ecal_sample, attr_.bandwidth);
-      }
-    }
-    else
-    {
-      if (m_sample_sender_no_loopback)
-      {
-        sent = m_sample_sender_no_loopback->Send(m_ecal_sample.topic().tname(), m_ecal_sample, attr_.bandwidth);
-      }
-    }
+    const std::shared_ptr<UDP::CSampleSender>& sample_sender = attr_.loopback ? m_sample_sender_loopback : m_sample_sender_no_loopback;
+    if (!sample_sender) return 0;
+    return sample_sender->Send(m_ecal_sample.topic().tname(), m_ecal_sample, buf_, attr_.len, attr_.bandwidth);
+  }
 
-    // log it
-    if (sent == 0)
-    {
-      Logging::Log(log_level_fatal, "CDataWriterUDP::Send failed to send message !");
-    }
+  size_t CDataWriterUdpMC::SendRawSample(const SWriterAttr& attr_, const void* buf_)
+  {
+    // create sample head
+    IO::UDP::SUDPRawSampleHead sample_head;
+    sample_head.id           = attr_.id;
+    sample_head.clock        = attr_.clock;
+    sample_head.time         = attr_.time;
+    sample_head.hash         = static_cast<uint64_t>(attr_.hash);
+    sample_head.payload_size = static_cast<uint64_t>(attr_.len);
 
-    return(sent > 0);
+    // send it
+    const std::shared_ptr<UDP::CSampleSender>& sample_sender = attr_.loopback ? m_sample_sender_loopback : m_sample_sender_no_loopback;
+    if (!sample_sender) return 0;
+    return sample_sender->Send(m_topic_name, m_topic_id, sample_head, buf_, attr_.bandwidth);
   }
 }
@@ -56,6 +56,10 @@ namespace eCAL
     bool Write(const void* buf_, const SWriterAttr& attr_) override;
 
   protected:
+    size_t SendSample(const SWriterAttr& attr_, const void* buf_);
+    size_t SendRawSample(const SWriterAttr& attr_, const void* buf_);
+
+    bool                                m_raw_samples = false;
     eCAL::pb::Sample                    m_ecal_sample;
 
     std::shared_ptr<UDP::CSampleSender> m_sample_sender_loopback;
@@ -0,0 +1,301 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL delta registration
+**/
+
+#include "ecal_registration_delta.h"
+
+#include <functional>
+
+#ifdef _MSC_VER
+#pragma warning(push, 0) // disable proto warnings
+#endif
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+namespace
+{
+  // frequently changing fields, they are transported by the heartbeats
+  void ClearHeartbeatFields(eCAL::pb::Sample& ecal_sample_)
+  {
+    ecal_sample_.clear_reg_hash();
+
+    auto* topic = ecal_sample_.mutable_topic();
+    topic->clear_rclock();
+    topic->clear_tsize();
+    topic->clear_connections_loc();
+    topic->clear_connections_ext();
+    topic->clear_message_drops();
+    topic->clear_did();
+    topic->clear_dclock();
+    topic->clear_dfreq();
+
+    auto* process = ecal_sample_.mutable_process();
+    process->clear_rclock();
+    process->clear_pmemory();
+    process->clear_pcpu();
+    process->clear_usrptime();
+    process->clear_datawrite();
+    process->clear_dataread();
+
+    auto* service = ecal_sample_.mutable_service();
+    service->clear_rclock();
+    for (auto& method : *service->mutable_methods())
+    {
+      method.clear_call_count();
+    }
+
+    ecal_sample_.mutable_client()->clear_rclock();
+  }
+}
+
+namespace eCAL
+{
+  namespace Registration
+  {
+    bool IsDeltaRegistration(eCAL::pb::eCmdType cmd_type_)
+    {
+      switch (cmd_type_)
+      {
+      case eCAL::pb::bct_reg_publisher:
+      case eCAL::pb::bct_reg_subscriber:
+      case eCAL::pb::bct_reg_process:
+      case eCAL::pb::bct_reg_service:
+      case eCAL::pb::bct_reg_client:
+        return true;
+      default:
+        return false;
+      }
+    }
+
+    eCAL::pb::eCmdType GetRegistrationCmdType(eCAL::pb::eCmdType unreg_cmd_type_)
+    {
+      switch (unreg_cmd_type_)
+      {
+      case eCAL::pb::bct_unreg_publisher:  return eCAL::pb::bct_reg_publisher;
+      case eCAL::pb::bct_unreg_subscriber: return eCAL::pb::bct_reg_subscriber;
+      case eCAL::pb::bct_unreg_process:    return eCAL::pb::bct_reg_process;
+      case eCAL::pb::bct_unreg_service:    return eCAL::pb::bct_reg_service;
+      case eCAL::pb::bct_unreg_client:     return eCAL::pb::bct_reg_client;
+      default:                             return eCAL::pb::bct_none;
+      }
+    }
+
+    std::string GetEntityKey(const eCAL::pb::Sample& ecal_sample_, eCAL::pb::eCmdType cmd_type_)
+    {
+      std::string key = std::to_string(cmd_type_);
+      switch (cmd_type_)
+      {
+      case eCAL::pb::bct_reg_publisher:
+      case eCAL::pb::bct_reg_subscriber:
+        key += ":" + ecal_sample_.topic().hname() + ":" + std::to_string(ecal_sample_.topic().pid()) + ":" + ecal_sample_.topic().tname() + ":" + ecal_sample_.topic().tid();
+        break;
+      case eCAL::pb::bct_reg_process:
+        key += ":" + ecal_sample_.process().hname() + ":" + std::to_string(ecal_sample_.process().pid()) + ":" + ecal_sample_.process().pname();
+        break;
+      case eCAL::pb::bct_reg_service:
+        key += ":" + ecal_sample_.service().hname() + ":" + std::to_string(ecal_sample_.service().pid()) + ":" + ecal_sample_.service().sname() + ":" + ecal_sample_.service().sid();
+        break;
+      case eCAL::pb::bct_reg_client:
+        key += ":" + ecal_sample_.client().hname() + ":" + std::to_string(ecal_sample_.client().pid()) + ":" + ecal_sample_.client().sname() + ":" + ecal_sample_.client().sid();
+        break;
+      default:
+        break;
+      }
+      return key;
+    }
+
+    void GetEntityProcess(const eCAL::pb::Sample& ecal_sample_, eCAL::pb::eCmdType cmd_type_, std::string& host_name_, int& process_id_)
+    {
+      switch (cmd_type_)
+      {
+      case eCAL::pb::bct_reg_publisher:
+      case eCAL::pb::bct_reg_subscriber:
+        host_name_  = ecal_sample_.topic().hname();
+        process_id_ = ecal_sample_.topic().pid();
+        break;
+      case eCAL::pb::bct_reg_process:
+        host_name_  = ecal_sample_.process().hname();
+        process_id_ = ecal_sample_.process().pid();
+        break;
+      case eCAL::pb::bct_reg_service:
+        host_name_  = ecal_sample_.service().hname();
+        process_id_ = ecal_sample_.service().pid();
+        break;
+      case eCAL::pb::bct_reg_client:
+        host_name_  = ecal_sample_.client().hname();
+        process_id_ = ecal_sample_.client().pid();
+        break;
+      default:
+        host_name_.clear();
+        process_id_ = 0;
+        break;
+      }
+    }
+
+    uint64_t GetStateHash(const eCAL::pb::Sample& ecal_sample_)
+    {
+      eCAL::pb::Sample state_sample(ecal_sample_);
+      ClearHeartbeatFields(state_sample);
+
+      // map fields (topic attributes) need a deterministic order for a stable hash
+      std::string state_buffer;
+      {
+        google::protobuf::io::StringOutputStream output_stream(&state_buffer);
+        google::protobuf::io::CodedOutputStream  coded_stream(&output_stream);
+        coded_stream.SetSerializationDeterministic(true);
+        state_sample.SerializeToCodedStream(&coded_stream);
+      }
+
+      // 0 is reserved for "no hash"
+      const uint64_t state_hash = static_cast<uint64_t>(std::hash<std::string>{}(state_buffer));
+      return (state_hash != 0) ? state_hash : 1;
+    }
+
+    void CreateHeartbeat(const eCAL::pb::Sample& ecal_sample_, uint64_t state_hash_, eCAL::pb::Sample& heartbeat_)
+    {
+      heartbeat_.Clear();
+      heartbeat_.set_cmd_type(eCAL::pb::bct_reg_heartbeat);
+      heartbeat_.set_reg_cmd_type(ecal_sample_.cmd_type());
+      heartbeat_.set_reg_hash(state_hash_);
+
+      switch (ecal_sample_.cmd_type())
+      {
+      case eCAL::pb::bct_reg_publisher:
+      case eCAL::pb::bct_reg_subscriber:
+      {
+        const auto& topic = ecal_sample_.topic();
+        auto* hb_topic = heartbeat_.mutable_topic();
+        hb_topic->set_hname(topic.hname());
+        hb_topic->set_pid(topic.pid());
+        hb_topic->set_tname(topic.tname());
+        hb_topic->set_tid(topic.tid());
+        hb_topic->set_rclock(topic.rclock());
+        hb_topic->set_tsize(topic.tsize());
+        hb_topic->set_connections_loc(topic.connections_loc());
+        hb_topic->set_connections_ext(topic.connections_ext());
+        hb_topic->set_message_drops(topic.message_drops());
+        hb_topic->set_did(topic.did());
+        hb_topic->set_dclock(topic.dclock());
+        hb_topic->set_dfreq(topic.dfreq());
+      }
+      break;
+      case eCAL::pb::bct_reg_process:
+      {
+        const auto& process = ecal_sample_.process();
+        auto* hb_process = heartbeat_.mutable_process();
+        hb_process->set_hname(process.hname());
+        hb_process->set_pid(process.pid());
+        hb_process->set_pname(process.pname());
+        hb_process->set_rclock(process.rclock());
+        hb_process->set_pmemory(process.pmemory());
+        hb_process->set_pcpu(process.pcpu());
+        hb_process->set_usrptime(process.usrptime());
+        hb_process->set_datawrite(process.datawrite());
+        hb_process->set_dataread(process.dataread());
+      }
+      break;
+      case eCAL::pb::bct_reg_service:
+      {
+        const auto& service = ecal_sample_.service();
+        auto* hb_service = heartbeat_.mutable_service();
+        hb_service->set_hname(service.hname());
+        hb_service->set_pid(service.pid());
+        hb_service->set_sname(service.sname());
+        hb_service->set_sid(service.sid());
+        hb_service->set_rclock(service.rclock());
+        // call counters in method order
+        for (const auto& method : service.methods())
+        {
+          hb_service->add_methods()->set_call_count(method.call_count());
+        }
+      }
+      break;
+      case eCAL::pb::bct_reg_client:
+      {
+        const auto& client = ecal_sample_.client();
+        auto* hb_client = heartbeat_.mutable_client();
+        hb_client->set_hname(client.hname());
+        hb_client->set_pid(client.pid());
+        hb_client->set_sname(client.sname());
+        hb_client->set_sid(client.sid());
+        hb_client->set_rclock(client.rclock());
+      }
+      break;
+      default:
+        break;
+      }
+    }
+
+    void ApplyHeartbeat(const eCAL::pb::Sample& heartbeat_, eCAL::pb::Sample& ecal_sample_)
+    {
+      switch (heartbeat_.reg_cmd_type())
+      {
+      case eCAL::pb::bct_reg_publisher:
+      case eCAL::pb::bct_reg_subscriber:
+      {
+        const auto& hb_topic = heartbeat_.topic();
+        auto* topic = ecal_sample_.mutable_topic();
+        topic->set_rclock(hb_topic.rclock());
+        topic->set_tsize(hb_topic.tsize());
+        topic->set_connections_loc(hb_topic.connections_loc());
+        topic->set_connections_ext(hb_topic.connections_ext());
+        topic->set_message_drops(hb_topic.message_drops());
+        topic->set_did(hb_topic.did());
+        topic->set_dclock(hb_topic.dclock());
+        topic->set_dfreq(hb_topic.dfreq());
+      }
+      break;
+      case eCAL::pb::bct_reg_process:
+      {
+        const auto& hb_process = heartbeat_.process();
+        auto* process = ecal_sample_.mutable_process();
+        process->set_rclock(hb_process.rclock());
+        process->set_pmemory(hb_process.pmemory());
+        process->set_pcpu(hb_process.pcpu());
+        process->set_usrptime(hb_process.usrptime());
+        process->set_datawrite(hb_process.datawrite());
+        process->set_dataread(hb_process.dataread());
+      }
+      break;
+      case eCAL::pb::bct_reg_service:
+      {
+        const auto& hb_service = heartbeat_.service();
+        auto* service = ecal_sample_.mutable_service();
+        service->set_rclock(hb_service.rclock());
+        for (int idx = 0; (idx < service->methods_size()) && (idx < hb_service.methods_size()); ++idx)
+        {
+          service->mutable_methods(idx)->set_call_count(hb_service.methods(idx).call_count());
+        }
+      }
+      break;
+      case eCAL::pb::bct_reg_client:
+        ecal_sample_.mutable_client()->set_rclock(heartbeat_.client().rclock());
+        break;
+      default:
+        break;
+      }
+    }
+  }
+}
@@ -0,0 +1,67 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL delta registration
+ *
+ * Registrations are sent completely only if they changed. Otherwise a heartbeat
+ * with the frequently changing fields and the hash of the remaining registration
+ * is sent, the receiver completes it with the registration it got before.
+ *
+**/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#ifdef _MSC_VER
+#pragma warning(push, 0) // disable proto warnings
+#endif
+#include <ecal/core/pb/ecal.pb.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+namespace eCAL
+{
+  namespace Registration
+  {
+    // true for registration commands that can be replaced by heartbeats
+    bool IsDeltaRegistration(eCAL::pb::eCmdType cmd_type_);
+
+    // registration command type matching an unregistration command type (bct_none if there is none)
+    eCAL::pb::eCmdType GetRegistrationCmdType(eCAL::pb::eCmdType unreg_cmd_type_);
+
+    // unique key of the registered entity (publisher, subscriber, server, client or process)
+    std::string GetEntityKey(const eCAL::pb::Sample& ecal_sample_, eCAL::pb::eCmdType cmd_type_);
+
+    // host name and process id of the registered entity
+    void GetEntityProcess(const eCAL::pb::Sample& ecal_sample_, eCAL::pb::eCmdType cmd_type_, std::string& host_name_, int& process_id_);
+
+    // hash of the registration without its frequently changing fields
+    uint64_t GetStateHash(const eCAL::pb::Sample& ecal_sample_);
+
+    // create a heartbeat containing the entity key fields and the frequently changing fields
+    void CreateHeartbeat(const eCAL::pb::Sample& ecal_sample_, uint64_t state_hash_, eCAL::pb::Sample& heartbeat_);
+
+    // update the frequently changing fields of a registration from a heartbeat
+    void ApplyHeartbeat(const eCAL::pb::Sample& heartbeat_, eCAL::pb::Sample& ecal_sample_);
+  }
+}
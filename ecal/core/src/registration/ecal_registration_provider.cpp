@@ -32,6 +32,7 @@
 #include "ecal_def.h"
 #include "ecal_globals.h"
 #include "ecal_registration_provider.h"
+#include "ecal_registration_delta.h"
 #include "ecal_descgate.h"
 
 #include "io/udp/ecal_udp_configurations.h"
@@ -62,7 +63,11 @@ namespace eCAL
                     m_reg_services(false),
                     m_reg_process(false),
                     m_use_network_monitoring(false),
-                    m_use_shm_monitoring(false)
+                    m_use_shm_monitoring(false),
+                    m_use_delta_registration(false),
+                    m_full_registration_requested(false),
+                    m_full_registration_cycle(false),
+                    m_use_desc_interning(false)
 
   {
   }
@@ -84,6 +89,8 @@ namespace eCAL
 
     m_use_shm_monitoring     = Config::Experimental::IsShmMonitoringEnabled();
     m_use_network_monitoring = !Config::Experimental::IsNetworkMonitoringDisabled();
+    m_use_delta_registration = Config::Experimental::IsDeltaRegistrationEnabled();
+    m_use_desc_interning     = Config::Experimental::IsDescriptorInterningEnabled();
 
     if (m_use_network_monitoring)
     {
@@ -441,7 +448,26 @@ namespace eCAL
     bool return_value {true};
 
     if (m_use_network_monitoring && m_reg_sample_snd)
-      return_value &= (m_reg_sample_snd->Send(sample_name_, sample_, -1) != 0);
+    {
+      // descriptor interning, send the descriptor hash instead of the descriptor
+      if (m_use_desc_interning && sample_.has_topic() && !sample_.topic().tdatatype().desc().empty())
+      {
+        const std::lock_guard<std::mutex> lock(m_desc_sync);
+        m_desc_interned_sample.CopyFrom(sample_);
+        auto* topic = m_desc_interned_sample.mutable_topic();
+        const uint64_t desc_hash = CDescriptorStore::GetHash(topic->tdatatype().desc());
+        topic->mutable_tdatatype()->clear_desc();
+        topic->mutable_tdatatype()->set_desc_hash(desc_hash);
+        topic->clear_tdesc();
+        m_sent_descriptors[desc_hash].last_sent = std::chrono::steady_clock::now();
+
+        return_value &= SendNetworkSample(sample_name_, m_desc_interned_sample);
+      }
+      else
+      {
+        return_value &= SendNetworkSample(sample_name_, sample_);
+      }
+    }
 
     if(m_use_shm_monitoring)
     {
@@ -452,6 +478,109 @@ namespace eCAL
     return return_value;
   }
 
+  bool CRegistrationProvider::SendNetworkSample(const std::string& sample_name_, const eCAL::pb::Sample& sample_)
+  {
+    if (m_use_delta_registration)
+      return SendDeltaSample(sample_name_, sample_);
+    else
+      return (m_reg_sample_snd->Send(sample_name_, sample_, -1) != 0);
+  }
+
+  bool CRegistrationProvider::SendDeltaSample(const std::string& sample_name_, const eCAL::pb::Sample& sample_)
+  {
+    const std::lock_guard<std::mutex> lock(m_delta_sync);
+
+    // unregistration, the next registration of that entity has to be complete again
+    const eCAL::pb::eCmdType reg_cmd_type = Registration::GetRegistrationCmdType(sample_.cmd_type());
+    if (reg_cmd_type != eCAL::pb::bct_none)
+    {
+      m_sent_state_hash.erase(Registration::GetEntityKey(sample_, reg_cmd_type));
+    }
+
+    if (!Registration::IsDeltaRegistration(sample_.cmd_type()))
+    {
+      return (m_reg_sample_snd->Send(sample_name_, sample_, -1) != 0);
+    }
+
+    // send the complete registration if it changed (or was requested), otherwise a heartbeat only
+    const uint64_t    state_hash = Registration::GetStateHash(sample_);
+    const std::string entity_key = Registration::GetEntityKey(sample_, sample_.cmd_type());
+    auto iter = m_sent_state_hash.find(entity_key);
+    if (m_full_registration_cycle || (iter == m_sent_state_hash.end()) || (iter->second != state_hash))
+    {
+      m_delta_sample.CopyFrom(sample_);
+      m_delta_sample.set_reg_hash(state_hash);
+      m_sent_state_hash[entity_key] = state_hash;
+    }
+    else
+    {
+      Registration::CreateHeartbeat(sample_, state_hash, m_delta_sample);
+    }
+
+    return (m_reg_sample_snd->Send(sample_name_, m_delta_sample, -1) != 0);
+  }
+
+  void CRegistrationProvider::RequestFullRegistration()
+  {
+    m_full_registration_requested = true;
+  }
+
+  bool CRegistrationProvider::SendRegistrationRequest(const std::string& host_name_, int process_id_)
+  {
+    if (!m_created) return(false);
+    if (!m_use_network_monitoring || !m_reg_sample_snd) return(false);
+
+    eCAL::pb::Sample request_sample;
+    request_sample.set_cmd_type(eCAL::pb::bct_reg_request);
+    request_sample.mutable_process()->set_hname(host_name_);
+    request_sample.mutable_process()->set_pid(process_id_);
+
+    return (m_reg_sample_snd->Send(host_name_, request_sample, -1) != 0);
+  }
+
+  bool CRegistrationProvider::SendDescriptorRequest(uint64_t descriptor_hash_)
+  {
+    if (!m_created) return(false);
+    if (!m_use_network_monitoring || !m_reg_sample_snd) return(false);
+
+    eCAL::pb::Sample request_sample;
+    request_sample.set_cmd_type(eCAL::pb::bct_desc_request);
+    request_sample.mutable_topic()->mutable_tdatatype()->set_desc_hash(descriptor_hash_);
+
+    return (m_reg_sample_snd->Send(Process::GetHostName(), request_sample, -1) != 0);
+  }
+
+  bool CRegistrationProvider::SendDescriptor(uint64_t descriptor_hash_)
+  {
+    if (!m_created) return(false);
+    if (!m_use_network_monitoring || !m_reg_sample_snd) return(false);
+    if (g_descgate() == nullptr) return(false);
+
+    // answer requests for our own descriptors only, once per registration refresh cycle at most
+    {
+      const std::lock_guard<std::mutex> lock(m_desc_sync);
+      auto iter = m_sent_descriptors.find(descriptor_hash_);
+      if (iter == m_sent_descriptors.end()) return(false);
+
+      const auto now = std::chrono::steady_clock::now();
+      if (now - iter->second.last_sent > std::chrono::milliseconds(Config::GetRegistrationTimeoutMs()))
+      {
+        m_sent_descriptors.erase(iter);
+        return(false);
+      }
+      if (now - iter->second.last_response < std::chrono::milliseconds(m_reg_refresh)) return(false);
+      iter->second.last_response = now;
+    }
+
+    eCAL::pb::Sample descriptor_sample;
+    descriptor_sample.set_cmd_type(eCAL::pb::bct_desc_response);
+    auto* tdatatype = descriptor_sample.mutable_topic()->mutable_tdatatype();
+    if (!g_descgate()->GetDescriptor(descriptor_hash_, *tdatatype->mutable_desc())) return(false);
+    tdatatype->set_desc_hash(descriptor_hash_);
+
+    return (m_reg_sample_snd->Send(Process::GetHostName(), descriptor_sample, -1) != 0);
+  }
+
   bool CRegistrationProvider::SendSampleList(bool reset_sample_list_)
   {
     if(!m_created) return(false);
@@ -481,6 +610,13 @@ namespace eCAL
     g_process_wbytes = static_cast<long long>(((double)g_process_wbytes_sum / m_reg_refresh) * 1000.0);
     g_process_wbytes_sum = 0;
 
+    // another process asked for our complete registrations
+    if (m_use_delta_registration)
+    {
+      const std::lock_guard<std::mutex> lock(m_delta_sync);
+      m_full_registration_cycle = m_full_registration_requested.exchange(false);
+    }
+
     // refresh subscriber registration
     if (g_subgate() != nullptr) g_subgate()->RefreshRegistrations();
 
@@ -507,6 +643,12 @@ namespace eCAL
 
     // write sample list to shared memory
     SendSampleList();
+
+    if (m_use_delta_registration)
+    {
+      const std::lock_guard<std::mutex> lock(m_delta_sync);
+      m_full_registration_cycle = false;
+    }
  }
 
   bool CRegistrationProvider::ApplyTopicToDescGate(const std::string& topic_name_
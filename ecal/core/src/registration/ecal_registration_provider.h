@@ -36,6 +36,8 @@
 #include "util/ecal_thread.h"
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -70,6 +72,16 @@ namespace eCAL
     bool RegisterClient(const std::string& client_name_, const std::string& client_id_, const eCAL::pb::Sample& ecal_sample_, bool force_);
     bool UnregisterClient(const std::string& client_name_, const std::string& client_id_, const eCAL::pb::Sample& ecal_sample_, bool force_);
 
+    // delta registration, send all registrations completely in the next refresh cycle
+    void RequestFullRegistration();
+    // delta registration, ask another process for its complete registrations
+    bool SendRegistrationRequest(const std::string& host_name_, int process_id_);
+
+    // descriptor interning, ask other processes for the descriptor with the given hash
+    bool SendDescriptorRequest(uint64_t descriptor_hash_);
+    // descriptor interning, answer a descriptor request (if we sent that descriptor hash)
+    bool SendDescriptor(uint64_t descriptor_hash_);
+
   protected:
     bool RegisterProcess();
     bool UnregisterProcess();
@@ -79,6 +91,8 @@ namespace eCAL
     bool RegisterTopics();
 
     bool ApplySample(const std::string& sample_name_, const eCAL::pb::Sample& sample_);
+    bool SendNetworkSample(const std::string& sample_name_, const eCAL::pb::Sample& sample_);
+    bool SendDeltaSample(const std::string& sample_name_, const eCAL::pb::Sample& sample_);
       
     void RegisterSendThread();
 
@@ -121,5 +135,26 @@ namespace eCAL
 
     bool                                m_use_network_monitoring;
     bool                                m_use_shm_monitoring;
+
+    // delta registration, state hash of the last complete registration sent per entity
+    using StateHashMapT = std::unordered_map<std::string, uint64_t>;
+    bool                                m_use_delta_registration;
+    std::atomic<bool>                   m_full_registration_requested;
+    std::mutex                          m_delta_sync;
+    bool                                m_full_registration_cycle;
+    StateHashMapT                       m_sent_state_hash;
+    eCAL::pb::Sample                    m_delta_sample;
+
+    // descriptor interning, descriptor hashes sent instead of descriptors (we answer requests for them)
+    struct SSentDescriptor
+    {
+      std::chrono::steady_clock::time_point last_sent;
+      std::chrono::steady_clock::time_point last_response;
+    };
+    using SentDescriptorMapT = std::unordered_map<uint64_t, SSentDescriptor>;
+    bool                                m_use_desc_interning;
+    std::mutex                          m_desc_sync;
+    SentDescriptorMapT                  m_sent_descriptors;
+    eCAL::pb::Sample                    m_desc_interned_sample;
   };
 }
@@ -26,6 +26,9 @@
 **/
 
 #include "ecal_registration_receiver.h"
+#include "ecal_registration_delta.h"
+#include "ecal_registration_provider.h"
+#include "ecal_globals.h"
 
 #include "pubsub/ecal_subgate.h"
 #include "pubsub/ecal_pubgate.h"
@@ -34,6 +37,7 @@
 
 #include "io/udp/ecal_udp_configurations.h"
 #include "ecal_sample_to_topicinfo.h"
+#include "ecal_descgate.h"
 
 #include <atomic>
 #include <chrono>
@@ -84,13 +88,12 @@ namespace eCAL
     MemfileBroadcastMessageListT message_list;
     if (m_memfile_broadcast_reader->Read(message_list, 0))
     {
-      eCAL::pb::SampleList sample_list;
-
       for (const auto& message : message_list)
       {
-        if (sample_list.ParseFromArray(message.data, static_cast<int>(message.size)))
+        // parse into the same sample list every time to reuse its allocated samples
+        if (m_sample_list.ParseFromArray(message.data, static_cast<int>(message.size)))
         {
-          for (const auto& sample : sample_list.samples())
+          for (const auto& sample : m_sample_list.samples())
           {
             if (g_registration_receiver()) g_registration_receiver()->ApplySample(sample);
           }
@@ -146,7 +149,7 @@ namespace eCAL
       attr.rcvbuf    = Config::GetUdpMulticastRcvBufSizeBytes();
 
       // start registration sample receiver
-      m_registration_receiver = std::make_shared<UDP::CSampleReceiver>(attr, std::bind(&CRegistrationReceiver::HasSample, this, std::placeholders::_1), std::bind(&CRegistrationReceiver::ApplySample, this, std::placeholders::_1));
+      m_registration_receiver = std::make_shared<UDP::CSampleReceiver>(attr, std::bind(&CRegistrationReceiver::HasSample, this, std::placeholders::_1), std::bind(&CRegistrationReceiver::ApplySample, this, std::placeholders::_1, std::placeholders::_3, std::placeholders::_4));
     }
 
     if (m_use_shm_monitoring)
@@ -194,33 +197,85 @@ namespace eCAL
     m_loopback = state_;
   }
 
-  bool CRegistrationReceiver::ApplySample(const eCAL::pb::Sample& ecal_sample_)
+  bool CRegistrationReceiver::ApplySample(const eCAL::pb::Sample& ecal_sample_, const char* serialized_buf_ /*= nullptr*/, size_t serialized_len_ /*= 0*/)
   {
     if(!m_created) return false;
 
+    switch (ecal_sample_.cmd_type())
+    {
+    case eCAL::pb::bct_reg_heartbeat:
+      return ApplyRegistrationHeartbeat(ecal_sample_);
+    case eCAL::pb::bct_reg_request:
+      // another process asks for our complete registrations
+      if ((ecal_sample_.process().pid() == Process::GetProcessID()) && (ecal_sample_.process().hname() == Process::GetHostName()))
+      {
+        if (g_registration_provider() != nullptr) g_registration_provider()->RequestFullRegistration();
+      }
+      return true;
+    case eCAL::pb::bct_desc_request:
+      // another process asks for a descriptor (we answer only if we sent its hash)
+      if (g_registration_provider() != nullptr) g_registration_provider()->SendDescriptor(ecal_sample_.topic().tdatatype().desc_hash());
+      return true;
+    case eCAL::pb::bct_desc_response:
+      return ApplyDescriptor(ecal_sample_);
+    default:
+      break;
+    }
+
+    // remember complete registrations of delta registering processes
+    StoreRegistrationState(ecal_sample_);
+
+    return ApplyRegistration(ecal_sample_, serialized_buf_, serialized_len_);
+  }
+
+  bool CRegistrationReceiver::ApplyRegistration(const eCAL::pb::Sample& ecal_sample_, const char* serialized_buf_ /*= nullptr*/, size_t serialized_len_ /*= 0*/)
+  {
+    // complete registrations that carry a descriptor hash only
+    std::string descriptor;
+    const bool resolve_descriptor = ResolveDescriptor(ecal_sample_, descriptor);
+
+    // the sample is forwarded as it is, only samples that need to be completed are copied
+    const eCAL::pb::Sample* reg_sample_ptr(&ecal_sample_);
+    eCAL::pb::Sample        modified_sample;
+
     //Remove in eCAL6
-    // for the time being we need to copy the incoming sample and set the incompatible fields
-    eCAL::pb::Sample modified_ttype_sample;
-    ModifyIncomingSampleForBackwardsCompatibility(ecal_sample_, modified_ttype_sample);
+    // for the time being we need to set the incompatible fields of samples from older eCAL versions
+    if (resolve_descriptor || (ecal_sample_.has_topic() && !ecal_sample_.topic().has_tdatatype()))
+    {
+      ModifyIncomingSampleForBackwardsCompatibility(ecal_sample_, modified_sample);
+      if (resolve_descriptor)
+      {
+        auto* topic = modified_sample.mutable_topic();
+        topic->set_tdesc(descriptor);
+        topic->mutable_tdatatype()->set_desc(std::move(descriptor));
+      }
+      reg_sample_ptr  = &modified_sample;
+      serialized_buf_ = nullptr;
+      serialized_len_ = 0;
+    }
+    const eCAL::pb::Sample& reg_sample(*reg_sample_ptr);
 
     // forward all registration samples to outside "customer" (e.g. Monitoring)
     {
       const std::lock_guard<std::mutex> lock(m_callback_custom_apply_sample_mtx);
-      m_callback_custom_apply_sample(modified_ttype_sample);
+      m_callback_custom_apply_sample(reg_sample);
     }
 
-    std::string reg_sample;
-    if ( m_callback_pub
-      || m_callback_sub
-      || m_callback_service
-      || m_callback_client
-      || m_callback_process
-      )
+    // the registration callbacks get the received buffer, the sample is serialized only if there is none
+    std::string reg_sample_buffer;
+    auto reg_sample_callback = [&](const RegistrationCallbackT& callback_)
     {
-      reg_sample = modified_ttype_sample.SerializeAsString();
-    }
+      if (!callback_) return;
+      if (serialized_buf_ == nullptr)
+      {
+        reg_sample.SerializeToString(&reg_sample_buffer);
+        serialized_buf_ = reg_sample_buffer.data();
+        serialized_len_ = reg_sample_buffer.size();
+      }
+      callback_(serialized_buf_, static_cast<int>(serialized_len_));
+    };
 
-    switch(modified_ttype_sample.cmd_type())
+    switch(reg_sample.cmd_type())
     {
     case eCAL::pb::bct_none:
     case eCAL::pb::bct_set_sample:
@@ -228,33 +283,33 @@ namespace eCAL
     case eCAL::pb::bct_reg_process:
     case eCAL::pb::bct_unreg_process:
       // unregistration event not implemented currently
-      if (m_callback_process) m_callback_process(reg_sample.c_str(), static_cast<int>(reg_sample.size()));
+      reg_sample_callback(m_callback_process);
       break;
     case eCAL::pb::bct_reg_service:
-      if (g_clientgate() != nullptr)  g_clientgate()->ApplyServiceRegistration(modified_ttype_sample);
-      if (m_callback_service) m_callback_service(reg_sample.c_str(), static_cast<int>(reg_sample.size()));
+      if (g_clientgate() != nullptr)  g_clientgate()->ApplyServiceRegistration(reg_sample);
+      reg_sample_callback(m_callback_service);
       break;
     case eCAL::pb::bct_unreg_service:
       // current client implementation doesn't need that information
-      if (m_callback_service) m_callback_service(reg_sample.c_str(), static_cast<int>(reg_sample.size()));
+      reg_sample_callback(m_callback_service);
       break;
     case eCAL::pb::bct_reg_client:
       // current service implementation doesn't need that information
-      if (m_callback_client) m_callback_client(reg_sample.c_str(), static_cast<int>(reg_sample.size()));
+      reg_sample_callback(m_callback_client);
       break;
     case eCAL::pb::bct_unreg_client:
       // current service implementation doesn't need that information
-      if (m_callback_client) m_callback_client(reg_sample.c_str(), static_cast<int>(reg_sample.size()));
+      reg_sample_callback(m_callback_client);
       break;
     case eCAL::pb::bct_reg_subscriber:
     case eCAL::pb::bct_unreg_subscriber:
-      ApplySubscriberRegistration(modified_ttype_sample);
-      if (m_callback_sub) m_callback_sub(reg_sample.c_str(), static_cast<int>(reg_sample.size()));
+      ApplySubscriberRegistration(reg_sample);
+      reg_sample_callback(m_callback_sub);
       break;
     case eCAL::pb::bct_reg_publisher:
     case eCAL::pb::bct_unreg_publisher:
-      ApplyPublisherRegistration(modified_ttype_sample);
-      if (m_callback_pub) m_callback_pub(reg_sample.c_str(), static_cast<int>(reg_sample.size()));
+      ApplyPublisherRegistration(reg_sample);
+      reg_sample_callback(m_callback_pub);
       break;
     default:
       eCAL::Logging::Log(log_level_debug1, "CRegistrationReceiver::ApplySample : unknown sample type");
@@ -264,6 +319,150 @@ namespace eCAL
     return true;
   }
 
+  void CRegistrationReceiver::StoreRegistrationState(const eCAL::pb::Sample& ecal_sample_)
+  {
+    const eCAL::pb::eCmdType unregistered_cmd_type = Registration::GetRegistrationCmdType(ecal_sample_.cmd_type());
+    const bool               is_delta_reg   = (ecal_sample_.reg_hash() != 0) && Registration::IsDeltaRegistration(ecal_sample_.cmd_type());
+    if (!is_delta_reg && (unregistered_cmd_type == eCAL::pb::bct_none)) return;
+
+    const std::lock_guard<std::mutex> lock(m_registration_state_mtx);
+    if (is_delta_reg)
+    {
+      SRegistrationState& state = m_registration_state_map[Registration::GetEntityKey(ecal_sample_, ecal_sample_.cmd_type())];
+      state.sample.CopyFrom(ecal_sample_);
+      state.last_seen = std::chrono::steady_clock::now();
+    }
+    else if (!m_registration_state_map.empty())
+    {
+      m_registration_state_map.erase(Registration::GetEntityKey(ecal_sample_, unregistered_cmd_type));
+    }
+
+    RemoveTimedOutRegistrationStates();
+  }
+
+  bool CRegistrationReceiver::ApplyRegistrationHeartbeat(const eCAL::pb::Sample& heartbeat_)
+  {
+    const std::string entity_key = Registration::GetEntityKey(heartbeat_, heartbeat_.reg_cmd_type());
+
+    // complete the heartbeat with the stored registration, the copy is applied
+    // without lock (gates and user callbacks are called from there)
+    eCAL::pb::Sample reg_sample;
+    bool             known_registration(false);
+    {
+      const std::lock_guard<std::mutex> lock(m_registration_state_mtx);
+      RemoveTimedOutRegistrationStates();
+
+      auto iter = m_registration_state_map.find(entity_key);
+      if ((iter != m_registration_state_map.end()) && (iter->second.sample.reg_hash() == heartbeat_.reg_hash()))
+      {
+        Registration::ApplyHeartbeat(heartbeat_, iter->second.sample);
+        iter->second.last_seen = std::chrono::steady_clock::now();
+        reg_sample.CopyFrom(iter->second.sample);
+        known_registration = true;
+      }
+    }
+
+    // unknown or outdated registration, ask the sender for the complete one
+    if (!known_registration)
+    {
+      RequestRegistration(heartbeat_);
+      return false;
+    }
+
+    return ApplyRegistration(reg_sample);
+  }
+
+  void CRegistrationReceiver::RequestRegistration(const eCAL::pb::Sample& heartbeat_)
+  {
+    std::string host_name;
+    int         process_id(0);
+    Registration::GetEntityProcess(heartbeat_, heartbeat_.reg_cmd_type(), host_name, process_id);
+
+    // ask every process once per registration refresh cycle at most
+    {
+      const std::lock_guard<std::mutex> lock(m_registration_state_mtx);
+      const auto now = std::chrono::steady_clock::now();
+      auto& last_request = m_registration_request_map[host_name + ":" + std::to_string(process_id)];
+      if (now - last_request < std::chrono::milliseconds(Config::GetRegistrationRefreshMs())) return;
+      last_request = now;
+    }
+
+    if (g_registration_provider() != nullptr) g_registration_provider()->SendRegistrationRequest(host_name, process_id);
+  }
+
+  void CRegistrationReceiver::RemoveTimedOutRegistrationStates()
+  {
+    // called with locked m_registration_state_mtx
+    const auto now     = std::chrono::steady_clock::now();
+    const auto timeout = std::chrono::milliseconds(Config::GetRegistrationTimeoutMs());
+    if (now - m_registration_state_cleanup < timeout) return;
+    m_registration_state_cleanup = now;
+
+    for (auto iter = m_registration_state_map.begin(); iter != m_registration_state_map.end();)
+    {
+      if (now - iter->second.last_seen > timeout) iter = m_registration_state_map.erase(iter);
+      else                                        ++iter;
+    }
+    for (auto iter = m_registration_request_map.begin(); iter != m_registration_request_map.end();)
+    {
+      if (now - iter->second > timeout) iter = m_registration_request_map.erase(iter);
+      else                              ++iter;
+    }
+  }
+
+  bool CRegistrationReceiver::ResolveDescriptor(const eCAL::pb::Sample& ecal_sample_, std::string& descriptor_)
+  {
+    if (!ecal_sample_.has_topic()) return false;
+    const auto& tdatatype = ecal_sample_.topic().tdatatype();
+    if ((tdatatype.desc_hash() == 0) || !tdatatype.desc().empty()) return false;
+    if (g_descgate() == nullptr) return false;
+
+    // known descriptor, use it from the store
+    if (g_descgate()->GetDescriptor(tdatatype.desc_hash(), descriptor_)) return true;
+
+    // unknown descriptor, ask for it (the registration is applied without descriptor meanwhile)
+    RequestDescriptor(tdatatype.desc_hash());
+    return false;
+  }
+
+  void CRegistrationReceiver::RequestDescriptor(uint64_t descriptor_hash_)
+  {
+    // ask for every descriptor once per registration refresh cycle at most
+    {
+      const std::lock_guard<std::mutex> lock(m_descriptor_request_mtx);
+      const auto now     = std::chrono::steady_clock::now();
+      const auto timeout = std::chrono::milliseconds(Config::GetRegistrationTimeoutMs());
+      for (auto iter = m_descriptor_request_map.begin(); iter != m_descriptor_request_map.end();)
+      {
+        if (now - iter->second > timeout) iter = m_descriptor_request_map.erase(iter);
+        else                              ++iter;
+      }
+
+      auto& last_request = m_descriptor_request_map[descriptor_hash_];
+      if (now - last_request < std::chrono::milliseconds(Config::GetRegistrationRefreshMs())) return;
+      last_request = now;
+    }
+
+    if (g_registration_provider() != nullptr) g_registration_provider()->SendDescriptorRequest(descriptor_hash_);
+  }
+
+  bool CRegistrationReceiver::ApplyDescriptor(const eCAL::pb::Sample& ecal_sample_)
+  {
+    const auto& tdatatype = ecal_sample_.topic().tdatatype();
+
+    // not requested by us
+    {
+      const std::lock_guard<std::mutex> lock(m_descriptor_request_mtx);
+      if (m_descriptor_request_map.erase(tdatatype.desc_hash()) == 0) return false;
+    }
+
+    // reject corrupted or colliding descriptors
+    if (CDescriptorStore::GetHash(tdatatype.desc()) != tdatatype.desc_hash()) return false;
+
+    if (g_descgate() == nullptr) return false;
+    return g_descgate()->ApplyDescriptor(tdatatype.desc()) != 0;
+  }
+
   bool CRegistrationReceiver::AddRegistrationCallback(enum eCAL_Registration_Event event_, const RegistrationCallbackT& callback_)
   {
     if (!m_created) return false;
@@ -37,11 +37,15 @@
 #include "io/shm/ecal_memfile_broadcast_reader.h"
 
 #include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
 
 #ifdef _MSC_VER
 #pragma warning(push, 0) // disable proto warnings
@@ -76,6 +80,7 @@ namespace eCAL
 
     CMemoryFileBroadcastReader*       m_memfile_broadcast_reader = nullptr;
     std::shared_ptr<CCallbackThread>  m_memfile_broadcast_reader_thread;
+    eCAL::pb::SampleList              m_sample_list;
 
     bool m_created = false;
   };
@@ -95,7 +100,8 @@ namespace eCAL
     bool LoopBackEnabled() const { return m_loopback; };
 
     bool HasSample(const std::string& /*sample_name_*/) { return(true); };
-    bool ApplySample(const eCAL::pb::Sample& ecal_sample_);
+    // serialized_buf_ optionally contains the sample as received, it is forwarded to the registration callbacks then
+    bool ApplySample(const eCAL::pb::Sample& ecal_sample_, const char* serialized_buf_ = nullptr, size_t serialized_len_ = 0);
 
     bool AddRegistrationCallback(enum eCAL_Registration_Event event_, const RegistrationCallbackT& callback_);
     bool RemRegistrationCallback(enum eCAL_Registration_Event event_);
@@ -104,6 +110,19 @@ namespace eCAL
     void RemCustomApplySampleCallback();
 
   protected:
+    bool ApplyRegistration(const eCAL::pb::Sample& ecal_sample_, const char* serialized_buf_ = nullptr, size_t serialized_len_ = 0);
+
+    // delta registration
+    void StoreRegistrationState(const eCAL::pb::Sample& ecal_sample_);
+    bool ApplyRegistrationHeartbeat(const eCAL::pb::Sample& heartbeat_);
+    void RequestRegistration(const eCAL::pb::Sample& heartbeat_);
+    void RemoveTimedOutRegistrationStates();
+
+    // descriptor interning
+    bool ResolveDescriptor(const eCAL::pb::Sample& ecal_sample_, std::string& descriptor_);
+    void RequestDescriptor(uint64_t descriptor_hash_);
+    bool ApplyDescriptor(const eCAL::pb::Sample& ecal_sample_);
+
     void ApplySubscriberRegistration(const eCAL::pb::Sample& ecal_sample_);
     void ApplyPublisherRegistration(const eCAL::pb::Sample& ecal_sample_);
 
@@ -133,5 +152,23 @@ namespace eCAL
     ApplySampleCallbackT                  m_callback_custom_apply_sample;
 
     std::string                           m_host_group_name;
+
+    // delta registration, last complete registration per entity (heartbeats refer to it)
+    struct SRegistrationState
+    {
+      eCAL::pb::Sample                      sample;
+      std::chrono::steady_clock::time_point last_seen;
+    };
+    using RegistrationStateMapT   = std::unordered_map<std::string, SRegistrationState>;
+    using RegistrationRequestMapT = std::unordered_map<std::string, std::chrono::steady_clock::time_point>;
+    std::mutex                            m_registration_state_mtx;
+    RegistrationStateMapT                 m_registration_state_map;
+    RegistrationRequestMapT               m_registration_request_map;
+
+    // descriptor interning, last request per descriptor hash
+    using DescriptorRequestMapT   = std::unordered_map<uint64_t, std::chrono::steady_clock::time_point>;
+    std::mutex                            m_descriptor_request_mtx;
+    DescriptorRequestMapT                 m_descriptor_request_map;
+    std::chrono::steady_clock::time_point m_registration_state_cleanup;
   };
 }
@@ -179,15 +179,43 @@ namespace eCAL
    *
    * @param method_name_  Method name.
    * @param request_      Request string.
-   * @param timeout_      Maximum time before operation returns (in milliseconds, -1 means infinite) - NOT SUPPORTED YET.
+   * @param timeout_      Maximum time for every single call (in milliseconds, -1 means infinite).
    *
    * @return  True if successful.
   **/
   bool CServiceClient::CallAsync(const std::string& method_name_, const std::string& request_, int timeout_)
   {
     if (!m_created) return(false);
-    (void)timeout_; // will be implemented later
-    return(m_service_client_impl->CallAsync(method_name_, request_ /*, timeout_*/));
+    return(m_service_client_impl->CallAsync(method_name_, request_, timeout_));
+  }
+
+  /**
+   * @brief Call a method of this service asynchronously, every called service sets its own future.
+   *
+   * @param       method_name_  Method name.
+   * @param       request_      Request string.
+   * @param       timeout_      Maximum time for every single call (in milliseconds, -1 means infinite).
+   * @param [out] call_id_      Id of this call for CancelCall (null pointer == not needed).
+   *
+   * @return  One future per called service.
+  **/
+  ServiceResponseFutureVecT CServiceClient::CallFuture(const std::string& method_name_, const std::string& request_, int timeout_, ServiceCallIdT* call_id_)
+  {
+    if (!m_created) return(ServiceResponseFutureVecT());
+    return(m_service_client_impl->CallFuture(method_name_, request_, timeout_, call_id_));
+  }
+
+  /**
+   * @brief Cancel an asynchronous call.
+   *
+   * @param call_id_  Id of the call.
+   *
+   * @return  True if the call was still pending.
+  **/
+  bool CServiceClient::CancelCall(ServiceCallIdT call_id_)
+  {
+    if (!m_created) return(false);
+    return(m_service_client_impl->CancelCall(call_id_));
   }
 
   /**
@@ -21,16 +21,23 @@
  * @brief  eCAL service client implementation
 **/
 
+#include <ecal/ecal_config.h>
+
 #include "ecal_global_accessors.h"
 
 #include "registration/ecal_registration_provider.h"
 #include "ecal_clientgate.h"
+#include "ecal_def.h"
 #include "ecal_service_client_impl.h"
+#include "ecal_service_frame.h"
 
+#include <algorithm>
 #include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -59,6 +66,7 @@ namespace eCAL
   **/
   CServiceClientImpl::CServiceClientImpl() :
     m_response_callback(nullptr),
+    m_call_id_counter(0),
     m_created(false)
   {
   }
@@ -94,9 +102,17 @@ namespace eCAL
     if (!m_created) return(false);
 
     // reset client map
+    ShmClientMapT shm_client_map;
     {
       std::lock_guard<std::mutex> const lock(m_client_map_sync);
       m_client_map.clear();
+      shm_client_map.swap(m_shm_client_map);
+    }
+
+    // stop shared memory clients (outside the lock, pending calls are failed by their callbacks)
+    for (auto& shm_client : shm_client_map)
+    {
+      if (shm_client.second.client) shm_client.second.client->Destroy();
     }
 
     // reset method callback map
@@ -111,6 +127,20 @@ namespace eCAL
       m_event_callback_map.clear();
     }
 
+    // fail all outstanding asynchronous calls (so their futures get ready)
+    PendingCallMapT pending_call_map;
+    {
+      std::lock_guard<std::mutex> const lock(m_call_state_sync);
+      pending_call_map.swap(m_pending_call_map);
+    }
+    for (const auto& pending_calls : pending_call_map)
+    {
+      for (const auto& pending_call : pending_calls.second)
+      {
+        CompleteCall(shared_from_this(), pending_call.first, pending_call.second, FailedResponse(pending_call.first, "Cancelled"), false);
+      }
+    }
+
     // mark as no more created (and prevent reregistering)
     m_created = false;
 
@@ -208,19 +238,14 @@ namespace eCAL
         auto client = m_client_map.find(iter.key);
         if (client != m_client_map.end())
         {
-          // Copy raw request in a protocol buffer
-          // TODO: The next version of the service protocol should omit the double-serialization (i.e. copying the binary data in a protocol buffer and then serializing that again)
-          eCAL::pb::Request request_pb;
-          request_pb.mutable_header()->set_mname(method_name_);
-          request_pb.set_request(request_);
-          auto request_shared_ptr  = std::make_shared<std::string>();
+          const bool raw_frame     = UseRawFrame(iter);
+          auto request_shared_ptr  = SerializeRequest(method_name_, request_, raw_frame);
           auto response_shared_ptr = std::make_shared<std::string>();
-          *request_shared_ptr      = request_pb.SerializeAsString();
           
           auto error = client->second->call_service(request_shared_ptr, response_shared_ptr);
           if (!error)
           {
-            fromSerializedProtobuf(*response_shared_ptr, service_response_);
+            fromSerializedResponse(raw_frame, *response_shared_ptr, service_response_);
             return true;
           }
         }
@@ -243,141 +268,56 @@ namespace eCAL
     // check for new server
     CheckForNewServices();
 
-    // Copy raw request in a protocol buffer
-    // TODO: The next version of the service protocol should omit the double-serialization (i.e. copying the binary data in a protocol buffer and then serializing that again)
-    eCAL::pb::Request request_pb;
-    request_pb.mutable_header()->set_mname(method_name_);
-    request_pb.set_request(request_);
-    auto request_shared_ptr = std::make_shared<std::string>();
-    *request_shared_ptr = request_pb.SerializeAsString();
-
-    std::vector<SServiceAttr> const service_vec = g_clientgate()->GetServiceAttr(m_service_name);
-
-    // Create a condition variable and a mutex to wait for the response
-    // All variables are in shared pointers, as we need to pass them to the
-    // callback function via the lambda capture. When the user uses the timeout,
-    // this method may finish earlier than the service calls, so we need to make
-    // sure the callbacks can still operate on those variables.
-    const auto  mutex                       = std::make_shared<std::mutex>();
-    const auto  condition_variable          = std::make_shared<std::condition_variable>();
-    const auto  responses                   = std::make_shared<std::vector<std::pair<bool, SServiceResponse>>>(); // Vector with [has_returned, response] pairs, so we know where a timeout has happened.
-    const auto  block_modifying_responses   = std::make_shared<bool>(false);
-    const auto  finished_service_call_count = std::make_shared<int>(0);
-
-    const auto  expected_service_call_count = std::make_shared<int>(0);
-
-    // Iterate over all service sessions and call each of them.
-    // Each successfull call will increment the finished_service_call_count.
-    // By comparing that with the expected_service_call_count we later know
-    // Whether all service calls have been completed.
-    for (const auto& service : service_vec)
+    // the calls use the pooled call states of the asynchronous calls, the responses
+    // are collected in one shared object (a response may still be in delivery
+    // while this call times out, so the completions keep it alive)
+    struct SBlockingCall
     {
-      // Only call service if host name matches
-      if (m_host_name.empty() || (m_host_name == service.hname))
-      {
-        // Lock mutex for iterating over client session map
-        std::lock_guard<std::mutex> const client_map_lock(m_client_map_sync);
-
-        // Find the actual client session in the map
-        auto client = m_client_map.find(service.key);
-        if (client != m_client_map.end())
-        {
-          eCAL::service::ClientResponseCallbackT response_callback;
-
-          {
-            const std::lock_guard<std::mutex> lock(*mutex);
-            (*expected_service_call_count)++;
-            responses->emplace_back();
-            responses->back().first               = false; // If this stays false, we have a timout
-            responses->back().second.host_name    = service.hname;
-            responses->back().second.service_name = service.sname;
-            responses->back().second.service_id   = service.key;
-            responses->back().second.method_name  = method_name_;
-            responses->back().second.error_msg    = "Timeout";
-            responses->back().second.ret_state    = 0;
-            responses->back().second.call_state   = eCallState::call_state_failed;
-            responses->back().second.response     = "";
-
-            // Create a response callback, that will set the response and notify the condition variable
-            response_callback
-                      = [mutex, condition_variable, responses, block_modifying_responses, finished_service_call_count, i = (responses->size() - 1)]
-                        (const eCAL::service::Error& response_error, const std::shared_ptr<std::string>& response_)
+      std::mutex                                             mutex;
+      std::condition_variable                                condition_variable;
+      size_t                                                 pending_calls = 0;
+      std::vector<std::pair<bool, eCAL::SServiceResponse>>   responses;  // [has_returned, response] pairs, so we know where a timeout has happened
+    };
+    const auto blocking_call = std::make_shared<SBlockingCall>();
+
+    const ServiceCallIdT call_id = ++m_call_id_counter;
+    CallServicesAsync(method_name_, request_, 0, call_id, true,
+                      [&blocking_call]() -> CompletionT
+                      {
+                        size_t index(0);
                         {
-                          const std::lock_guard<std::mutex> lock(*mutex);
-
-                          if (!(*block_modifying_responses))
-                          {
-                            // This calback has not timeouted. This does not tell us anything about the success, though.
-                            (*responses)[i].first = true;
-
-                            if (response_error)
-                            {
-                              (*responses)[i].second.error_msg    = response_error.ToString();
-                              (*responses)[i].second.call_state   = eCallState::call_state_failed;
-                              (*responses)[i].second.ret_state    = 0;
-                            }
-                            else
-                            {
-                              fromSerializedProtobuf(*response_, (*responses)[i].second);
-                            }
-                          }
-                          
-                          (*finished_service_call_count)++;
-                          condition_variable->notify_all();
-                        };
-
-            // Call service asynchronously
-            const bool call_success = client->second->async_call_service(request_shared_ptr, response_callback);
-
-            if (!call_success)
-            {
-              // If the call failed, we know that the callback will never be called.
-              // Thus, we need to increment the finished_service_call_count here.
-              (*finished_service_call_count)++;
-
-              // We also store an error in the response vector
-              responses->back().second.error_msg    = "Stopped by user";
-              responses->back().second.ret_state    = 0;
-              responses->back().second.call_state   = eCallState::call_state_failed;
-            }
-
-          } // unlock mutex
-
-        }
-
-      }
-    }
-
-    // Lock mutex, call service asynchronously and wait for the condition variable to be notified
+                          const std::lock_guard<std::mutex> lock(blocking_call->mutex);
+                          index = blocking_call->responses.size();
+                          blocking_call->responses.emplace_back();
+                          blocking_call->pending_calls++;
+                        }
+                        return [blocking_call, index](const SServiceResponse& response_, bool timed_out_)
+                               {
+                                 const std::lock_guard<std::mutex> lock(blocking_call->mutex);
+                                 blocking_call->responses[index].first  = !timed_out_;
+                                 blocking_call->responses[index].second = response_;
+                                 blocking_call->pending_calls--;
+                                 blocking_call->condition_variable.notify_all();
+                               };
+                      });
+
+    // wait for all services to return something
+    std::unique_lock<std::mutex> lock(blocking_call->mutex);
+    const auto all_returned = [&blocking_call]() { return blocking_call->pending_calls == 0; };
+    if (timeout_ > std::chrono::nanoseconds::zero())
     {
-      std::unique_lock<std::mutex> lock(*mutex);
-      if (timeout_ > std::chrono::nanoseconds::zero())
-      {
-        condition_variable->wait_for(lock
-                                    , timeout_
-                                    , [&expected_service_call_count, &finished_service_call_count]()
-                                      {
-                                        // Wait for all services to return something
-                                        return *expected_service_call_count == *finished_service_call_count;
-                                      });
-
-      }
-      else
+      if (!blocking_call->condition_variable.wait_for(lock, timeout_, all_returned))
       {
-        condition_variable->wait(lock, [&expected_service_call_count, &finished_service_call_count]()
-                                        {
-                                          // Wait for all services to return something
-                                          return *expected_service_call_count == *finished_service_call_count;
-                                        });
+        // complete the outstanding calls as timed out, responses arriving later are ignored
+        lock.unlock();
+        FailPendingCalls(call_id, "Timeout", true);
+        lock.lock();
       }
-      // Stop the callbacks from modifying the responses vector. This is important
-      //in a timeout case, as we want to preserve the vector from when the timeout
-      // occured. There is no way to stop the service calls from succeeding after
-      // that, but we don't want their values, any more.
-      *block_modifying_responses = true;
-
-      return responses;
     }
+    // (after a timeout only completions that are in delivery right now are left)
+    blocking_call->condition_variable.wait(lock, all_returned);
+
+    return std::shared_ptr<std::vector<std::pair<bool, eCAL::SServiceResponse>>>(blocking_call, &blocking_call->responses);
   }
 
   // blocking call, all responses will be returned in service_response_vec_
@@ -489,10 +429,8 @@ namespace eCAL
   }
 
   // asynchronously call, using callback
-  bool CServiceClientImpl::CallAsync(const std::string& method_name_, const std::string& request_ /*, int timeout_ms_*/)
+  bool CServiceClientImpl::CallAsync(const std::string& method_name_, const std::string& request_, int timeout_ms_)
   {
-    // TODO: implement timeout
-
     if (g_clientgate() == nullptr)
     {
       ErrorCallback(method_name_, "Clientgate error.");
@@ -515,67 +453,95 @@ namespace eCAL
     // check for new server
     CheckForNewServices();
 
-    // Copy raw request in a protocol buffer
-    // TODO: The next version of the service protocol should omit the double-serialization (i.e. copying the binary data in a protocol buffer and then serializing that again)
-    eCAL::pb::Request request_pb;
-    request_pb.mutable_header()->set_mname(method_name_);
-    request_pb.set_request(request_);
-    auto request_shared_ptr = std::make_shared<std::string>();
-    *request_shared_ptr = request_pb.SerializeAsString();
+    // responses are passed to the response callback, timeouts are reported by the timeout event
+    const CompletionT completion
+            = [weak_me = std::weak_ptr<CServiceClientImpl>(shared_from_this())]
+              (const SServiceResponse& response_, bool timed_out_)
+              {
+                auto me = weak_me.lock();
+                if (!me)
+                {
+                  return;
+                }
+
+                if (timed_out_)
+                {
+                  std::lock_guard<std::mutex> const lock_eb(me->m_event_callback_map_sync);
+                  auto callback_it = me->m_event_callback_map.find(eCAL_Client_Event::client_event_timeout);
+                  if ((callback_it != me->m_event_callback_map.end()) && callback_it->second)
+                  {
+                    SClientEventCallbackData sdata;
+                    sdata.type = client_event_timeout;
+                    sdata.time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+                    (callback_it->second)(me->m_service_name.c_str(), &sdata);
+                  }
+                }
+                else
+                {
+                  std::lock_guard<std::mutex> const lock(me->m_response_callback_sync);
+                  if (me->m_response_callback)
+                  {
+                    me->m_response_callback(response_);
+                  }
+                }
+              };
+
+    // calls that could not be sent are not reported (the client session has been stopped)
+    const size_t called_services = CallServicesAsync(method_name_, request_, timeout_ms_, ++m_call_id_counter, false, [&completion]() { return completion; });
+    return(called_services > 0);
+  }
 
-    bool at_least_one_service_was_called (false);
+  // asynchronously call, one future per called service
+  ServiceResponseFutureVecT CServiceClientImpl::CallFuture(const std::string& method_name_, const std::string& request_, int timeout_ms_, ServiceCallIdT* call_id_)
+  {
+    ServiceResponseFutureVecT futures;
 
-    // Call all services
-    std::vector<SServiceAttr> const service_vec = g_clientgate()->GetServiceAttr(m_service_name);
-    for (const auto& service : service_vec)
+    if (g_clientgate() == nullptr) return futures;
+    if (!m_created)                return futures;
+
+    if (m_service_name.empty() || method_name_.empty())
+      return futures;
+
+    // check for new server
+    CheckForNewServices();
+
+    const ServiceCallIdT call_id = ++m_call_id_counter;
+    if (call_id_ != nullptr) *call_id_ = call_id;
+
+    // every called service gets its own promise, calls that could not be sent fail immediately
+    CallServicesAsync(method_name_, request_, timeout_ms_, call_id, true,
+                      [&futures]() -> CompletionT
+                      {
+                        auto promise = std::make_shared<std::promise<SServiceResponse>>();
+                        futures.push_back(promise->get_future());
+                        return [promise](const SServiceResponse& response_, bool /*timed_out_*/) { promise->set_value(response_); };
+                      });
+
+    return futures;
+  }
+
+  // cancel an asynchronous call
+  bool CServiceClientImpl::CancelCall(ServiceCallIdT call_id_)
+  {
+    return FailPendingCalls(call_id_, "Cancelled", false);
+  }
+
+  bool CServiceClientImpl::FailPendingCalls(ServiceCallIdT call_id_, const std::string& error_msg_, bool timed_out_)
+  {
+    PendingCallMapT::mapped_type pending_calls;
     {
-      if (m_host_name.empty() || (m_host_name == service.hname))
-      {
-        std::lock_guard<std::mutex> const lock(m_client_map_sync);
-        auto client = m_client_map.find(service.key);
-        if (client != m_client_map.end())
-        {
-          const eCAL::service::ClientResponseCallbackT response_callback
-                      = [weak_me = std::weak_ptr<CServiceClientImpl>(shared_from_this()), hostname = service.hname, servicename = service.sname]
-                        (const eCAL::service::Error& response_error, const std::shared_ptr<std::string>& response_)
-                        {
-                          auto me = weak_me.lock();
-                          if (!me)
-                          {
-                            return;
-                          }
-
-                          std::lock_guard<std::mutex> const lock(me->m_response_callback_sync);
-                          
-                          if (me->m_response_callback)
-                          {
-                            eCAL::SServiceResponse service_response_struct;
-                            
-                            service_response_struct.host_name    = hostname;
-                            service_response_struct.service_name = servicename;
-
-                            if (response_error)
-                            {
-                              service_response_struct.error_msg    = response_error.ToString();
-                              service_response_struct.call_state   = eCallState::call_state_failed;
-                              service_response_struct.ret_state    = 0;
-                            }
-                            else
-                            {
-                              fromSerializedProtobuf(*response_, service_response_struct);
-                            }
-
-                            me->m_response_callback(service_response_struct);
-                          }
-                        };
-
-          if (client->second->async_call_service(request_shared_ptr, response_callback))
-            at_least_one_service_was_called = true;
-        }
-      }
+      std::lock_guard<std::mutex> const lock(m_call_state_sync);
+      auto pending_call = m_pending_call_map.find(call_id_);
+      if (pending_call == m_pending_call_map.end()) return false;
+      pending_calls = std::move(pending_call->second);
+      m_pending_call_map.erase(pending_call);
     }
 
-    return(at_least_one_service_was_called);
+    for (const auto& pending_call : pending_calls)
+    {
+      CompleteCall(shared_from_this(), pending_call.first, pending_call.second, FailedResponse(pending_call.first, error_msg_), timed_out_);
+    }
+    return true;
   }
 
   // check connection state
@@ -622,6 +588,44 @@ namespace eCAL
     Register(false);
   }
 
+  bool CServiceClientImpl::UseRawFrame(const SServiceAttr& service_)
+  {
+    return service_.frame_version >= ServiceFrame::frame_version;
+  }
+
+  std::shared_ptr<std::string> CServiceClientImpl::SerializeRequest(const std::string& method_name_, const std::string& request_, bool raw_frame_)
+  {
+    auto request_shared_ptr = std::make_shared<std::string>();
+    if (raw_frame_)
+    {
+      ServiceFrame::BuildRequestFrame(method_name_, request_, *request_shared_ptr);
+    }
+    else
+    {
+      // Copy raw request in a protocol buffer (servers without raw frame support)
+      eCAL::pb::Request request_pb;
+      request_pb.mutable_header()->set_mname(method_name_);
+      request_pb.set_request(request_);
+      *request_shared_ptr = request_pb.SerializeAsString();
+    }
+    return request_shared_ptr;
+  }
+
+  void CServiceClientImpl::fromSerializedResponse(bool raw_frame_, std::string& response_buffer_, eCAL::SServiceResponse& response)
+  {
+    if (!raw_frame_)
+    {
+      fromSerializedProtobuf(response_buffer_, response);
+    }
+    else if (!ServiceFrame::ParseResponseFrame(response_buffer_, response))
+    {
+      response.error_msg  = "Could not parse server response";
+      response.ret_state  = 0;
+      response.call_state = eCallState::call_state_failed;
+      response.response   = "";
+    }
+  }
+
   void CServiceClientImpl::fromSerializedProtobuf(const std::string& response_pb_string, eCAL::SServiceResponse& response)
   {
     eCAL::pb::Response response_pb;
@@ -767,6 +771,259 @@ namespace eCAL
           m_client_map[iter.key] = new_client_session;
       }
     }
+
+    // call services on the same host via shared memory
+    if (Config::Experimental::IsServiceShmTransportEnabled()) UpdateShmClients(service_vec);
+  }
+
+  void CServiceClientImpl::UpdateShmClients(const std::vector<SServiceAttr>& service_vec_)
+  {
+    std::vector<std::shared_ptr<CServiceShmClient>> stale_clients;
+    {
+      std::lock_guard<std::mutex> const lock(m_client_map_sync);
+      const auto now = std::chrono::steady_clock::now();
+
+      // forget services that left the registration, and clients that lost their server
+      for (auto shm_client = m_shm_client_map.begin(); shm_client != m_shm_client_map.end();)
+      {
+        const bool registered = std::any_of(service_vec_.begin(), service_vec_.end(), [&shm_client](const SServiceAttr& service_) { return service_.key == shm_client->first; });
+        if (!registered)
+        {
+          if (shm_client->second.client) stale_clients.push_back(std::move(shm_client->second.client));
+          shm_client = m_shm_client_map.erase(shm_client);
+          continue;
+        }
+        if (shm_client->second.client && !shm_client->second.client->IsConnected())
+        {
+          stale_clients.push_back(std::move(shm_client->second.client));
+          shm_client->second.client.reset();
+          shm_client->second.retry_time = now + std::chrono::milliseconds(CMN_SERVICE_SHM_RETRY_MS);
+        }
+        ++shm_client;
+      }
+
+      // claim a channel of new services (and retry the ones that had no free channel)
+      for (const auto& service : service_vec_)
+      {
+        if (service.shm_name.empty() || (service.hname != Process::GetHostName())) continue;
+
+        auto& shm_client = m_shm_client_map[service.key];
+        if (shm_client.client || (now < shm_client.retry_time)) continue;
+
+        auto new_client = std::make_shared<CServiceShmClient>();
+        if (new_client->Create(service.shm_name))
+        {
+          shm_client.client = new_client;
+        }
+        else
+        {
+          // no free channel (or server gone), this service is called via tcp for now
+          shm_client.retry_time = now + std::chrono::milliseconds(CMN_SERVICE_SHM_RETRY_MS);
+        }
+      }
+    }
+
+    // stop them outside the lock, pending calls are failed by their callbacks
+    for (const auto& stale_client : stale_clients)
+    {
+      stale_client->Destroy();
+    }
+  }
+
+  bool CServiceClientImpl::AsyncCallService(const std::string& key_, const std::shared_ptr<eCAL::service::ClientSession>& tcp_client_, const std::shared_ptr<std::string>& request_, const eCAL::service::ClientResponseCallbackT& response_callback_)
+  {
+    // m_client_map_sync is locked by the caller
+
+    // prefer shared memory, tcp is used if the request does not fit into the channel or the server is gone
+    auto shm_client = m_shm_client_map.find(key_);
+    if ((shm_client != m_shm_client_map.end()) && shm_client->second.client)
+    {
+      if (shm_client->second.client->AsyncCall(request_, response_callback_))
+        return true;
+    }
+    return tcp_client_->async_call_service(request_, response_callback_);
+  }
+
+  size_t CServiceClientImpl::CallServicesAsync(const std::string& method_name_, const std::string& request_, int timeout_ms_, ServiceCallIdT call_id_, bool complete_unsent_, const std::function<CompletionT()>& make_completion_)
+  {
+    // the request is serialized once per format, servers that know the
+    // raw frame format get a raw frame, all others a protobuf Request
+    std::shared_ptr<std::string> request_pb_shared_ptr;
+    std::shared_ptr<std::string> request_frame_shared_ptr;
+
+    const std::weak_ptr<CServiceClientImpl> weak_me = shared_from_this();
+    size_t called_services(0);
+
+    // Call all services
+    std::vector<SServiceAttr> const service_vec = g_clientgate()->GetServiceAttr(m_service_name);
+    for (const auto& service : service_vec)
+    {
+      if (!m_host_name.empty() && (m_host_name != service.hname)) continue;
+
+      std::lock_guard<std::mutex> const lock(m_client_map_sync);
+      auto client = m_client_map.find(service.key);
+      if (client == m_client_map.end()) continue;
+
+      // no call state without a running service manager
+      auto state = AcquireCallState();
+      if (!state) break;
+
+      const bool raw_frame = UseRawFrame(service);
+      auto& request_shared_ptr = raw_frame ? request_frame_shared_ptr : request_pb_shared_ptr;
+      if (!request_shared_ptr) request_shared_ptr = SerializeRequest(method_name_, request_, raw_frame);
+
+      // prepare the call state and start its timer
+      std::uint64_t generation(0);
+      {
+        std::lock_guard<std::mutex> const state_lock(state->mutex);
+        generation        = ++state->generation;
+        state->completed  = false;
+        state->call_id    = call_id_;
+        state->completion = make_completion_();
+
+        state->response              = SServiceResponse();
+        state->response.host_name    = service.hname;
+        state->response.service_name = service.sname;
+        state->response.service_id   = service.key;
+        state->response.method_name  = method_name_;
+        state->response.call_state   = eCallState::call_state_failed;
+
+        // register the call as pending before the timer and the request can complete it,
+        // so the completion always finds (and removes) its pending entry
+        {
+          std::lock_guard<std::mutex> const pending_lock(m_call_state_sync);
+          m_pending_call_map[call_id_].emplace_back(state, generation);
+        }
+
+        if (timeout_ms_ > 0)
+        {
+          state->timer.expires_after(std::chrono::milliseconds(timeout_ms_));
+          state->timer.async_wait([weak_me, state, generation](const asio::error_code& timer_error)
+                                  {
+                                    // cancelled, the call has been completed already
+                                    if (timer_error) return;
+                                    CompleteCall(weak_me, state, generation, FailedResponse(state, "Timeout"), true);
+                                  });
+        }
+      }
+
+      const eCAL::service::ClientResponseCallbackT response_callback
+                  = [weak_me, state, generation, raw_frame, hostname = service.hname, servicename = service.sname]
+                    (const eCAL::service::Error& response_error, const std::shared_ptr<std::string>& response_)
+                    {
+                      eCAL::SServiceResponse service_response_struct;
+
+                      service_response_struct.host_name    = hostname;
+                      service_response_struct.service_name = servicename;
+
+                      if (response_error)
+                      {
+                        service_response_struct.error_msg    = response_error.ToString();
+                        service_response_struct.call_state   = eCallState::call_state_failed;
+                        service_response_struct.ret_state    = 0;
+                      }
+                      else
+                      {
+                        fromSerializedResponse(raw_frame, *response_, service_response_struct);
+                      }
+
+                      CompleteCall(weak_me, state, generation, service_response_struct, false);
+                    };
+
+      if (AsyncCallService(service.key, client->second, request_shared_ptr, response_callback))
+      {
+        called_services++;
+      }
+      else if (complete_unsent_)
+      {
+        // the client session has been stopped, the response callback will never be called
+        CompleteCall(weak_me, state, generation, FailedResponse(state, "Stopped by user"), false);
+      }
+      else
+      {
+        // forget the call
+        {
+          std::lock_guard<std::mutex> const state_lock(state->mutex);
+          state->completed  = true;
+          state->completion = nullptr;
+          state->timer.cancel();
+        }
+        ReleaseCallState(state, call_id_);
+      }
+    }
+
+    return called_services;
+  }
+
+  std::shared_ptr<CServiceClientImpl::SCallState> CServiceClientImpl::AcquireCallState()
+  {
+    auto timer_context = eCAL::service::ServiceManager::instance()->get_client_timer_context();
+    if (!timer_context) return nullptr;
+
+    // reuse the state of a completed call (if its timer belongs to the actual timer context)
+    {
+      std::lock_guard<std::mutex> const lock(m_call_state_sync);
+      while (!m_call_state_pool.empty())
+      {
+        auto state = std::move(m_call_state_pool.back());
+        m_call_state_pool.pop_back();
+        if (state->timer_context == timer_context) return state;
+      }
+    }
+    return std::make_shared<SCallState>(timer_context);
+  }
+
+  void CServiceClientImpl::ReleaseCallState(const std::shared_ptr<SCallState>& state_, ServiceCallIdT call_id_)
+  {
+    std::lock_guard<std::mutex> const lock(m_call_state_sync);
+
+    // the call is not pending anymore
+    auto pending_call = m_pending_call_map.find(call_id_);
+    if (pending_call != m_pending_call_map.end())
+    {
+      auto& pending_calls = pending_call->second;
+      pending_calls.erase(std::remove_if(pending_calls.begin(), pending_calls.end(),
+                                         [&state_](const std::pair<std::shared_ptr<SCallState>, std::uint64_t>& pending) { return pending.first == state_; }),
+                          pending_calls.end());
+      if (pending_calls.empty()) m_pending_call_map.erase(pending_call);
+    }
+
+    // keep the state for later calls
+    if (m_call_state_pool.size() < m_max_pooled_call_states)
+    {
+      m_call_state_pool.push_back(state_);
+    }
+  }
+
+  void CServiceClientImpl::CompleteCall(const std::weak_ptr<CServiceClientImpl>& weak_me_, const std::shared_ptr<SCallState>& state_, std::uint64_t generation_, const SServiceResponse& response_, bool timed_out_)
+  {
+    // only the first of response, timeout and cancellation completes the call,
+    // late events of former calls (with an older generation) are ignored
+    CompletionT    completion;
+    ServiceCallIdT call_id(0);
+    {
+      std::lock_guard<std::mutex> const state_lock(state_->mutex);
+      if (state_->completed || (state_->generation != generation_)) return;
+
+      state_->completed = true;
+      state_->timer.cancel();
+      call_id    = state_->call_id;
+      completion = std::move(state_->completion);
+      state_->completion = nullptr;
+    }
+
+    if (completion) completion(response_, timed_out_);
+
+    auto me = weak_me_.lock();
+    if (me) me->ReleaseCallState(state_, call_id);
+  }
+
+  SServiceResponse CServiceClientImpl::FailedResponse(const std::shared_ptr<SCallState>& state_, const std::string& error_msg_)
+  {
+    std::lock_guard<std::mutex> const state_lock(state_->mutex);
+    SServiceResponse response = state_->response;
+    response.error_msg = error_msg_;
+    return response;
   }
 
   void CServiceClientImpl::ErrorCallback(const std::string& method_name_, const std::string& error_message_)
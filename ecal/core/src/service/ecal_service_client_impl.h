@@ -27,10 +27,17 @@
 
 #include <ecal/service/client_session.h>
 
+#include "ecal_service_shm_client.h"
+
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
 #include <map>
 #include <mutex>
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace eCAL
 {
@@ -77,8 +84,14 @@ namespace eCAL
     // blocking call, using callback
     bool Call(const std::string& method_name_, const std::string& request_, int timeout_ms_);
 
-    // asynchronously call, using callback (timeout not supported yet)
-    bool CallAsync(const std::string& method_name_, const std::string& request_ /*, int timeout_ms_*/);
+    // asynchronously call, using callback
+    bool CallAsync(const std::string& method_name_, const std::string& request_, int timeout_ms_);
+
+    // asynchronously call, one future per called service
+    ServiceResponseFutureVecT CallFuture(const std::string& method_name_, const std::string& request_, int timeout_ms_, ServiceCallIdT* call_id_);
+
+    // cancel an asynchronous call
+    bool CancelCall(ServiceCallIdT call_id_);
 
     // check connection state
     bool IsConnected();
@@ -98,6 +111,10 @@ namespace eCAL
     CServiceClientImpl& operator=(CServiceClientImpl&&) = delete;
 
   private:
+    static bool                         UseRawFrame(const SServiceAttr& service_);
+    static std::shared_ptr<std::string> SerializeRequest(const std::string& method_name_, const std::string& request_, bool raw_frame_);
+
+    static void fromSerializedResponse(bool raw_frame_, std::string& response_buffer_, eCAL::SServiceResponse& response);
     static void fromSerializedProtobuf(const std::string&        response_pb_string, eCAL::SServiceResponse& response);
     static void fromProtobuf          (const eCAL::pb::Response& response_pb,        eCAL::SServiceResponse& response);
 
@@ -105,12 +122,52 @@ namespace eCAL
     void Unregister();
 
     void CheckForNewServices();
+    void UpdateShmClients(const std::vector<SServiceAttr>& service_vec_);
+
+    bool AsyncCallService(const std::string& key_, const std::shared_ptr<eCAL::service::ClientSession>& tcp_client_, const std::shared_ptr<std::string>& request_, const eCAL::service::ClientResponseCallbackT& response_callback_);
 
     void ErrorCallback(const std::string &method_name_, const std::string &error_message_);
 
+    // called once per called service with the response (or a failed response on timeout / cancellation)
+    using CompletionT = std::function<void(const SServiceResponse& response_, bool timed_out_)>;
+
+    // state of an asynchronous call to a single service, reused by later calls
+    struct SCallState
+    {
+      explicit SCallState(const std::shared_ptr<asio::io_context>& timer_context_) : timer_context(timer_context_), timer(*timer_context_) {}
+
+      std::mutex                        mutex;
+      std::uint64_t                     generation = 0;     //!< incremented for every call, late responses of former calls are ignored
+      bool                              completed  = true;
+      ServiceCallIdT                    call_id    = 0;
+      SServiceResponse                  response;           //!< response information reported on timeout / cancellation
+      CompletionT                       completion;
+      std::shared_ptr<asio::io_context> timer_context;
+      asio::steady_timer                timer;
+    };
+
+    // call all matching services, make_completion_ is called once per service before it is called
+    // complete the outstanding calls of a call id with a failed response
+    bool FailPendingCalls(ServiceCallIdT call_id_, const std::string& error_msg_, bool timed_out_);
+
+    size_t CallServicesAsync(const std::string& method_name_, const std::string& request_, int timeout_ms_, ServiceCallIdT call_id_, bool complete_unsent_, const std::function<CompletionT()>& make_completion_);
+
+    std::shared_ptr<SCallState> AcquireCallState();
+    void ReleaseCallState(const std::shared_ptr<SCallState>& state_, ServiceCallIdT call_id_);
+
+    static void CompleteCall(const std::weak_ptr<CServiceClientImpl>& weak_me_, const std::shared_ptr<SCallState>& state_, std::uint64_t generation_, const SServiceResponse& response_, bool timed_out_);
+    static SServiceResponse FailedResponse(const std::shared_ptr<SCallState>& state_, const std::string& error_msg_);
+
     using ClientMapT = std::map<std::string, std::shared_ptr<eCAL::service::ClientSession>>;
     std::mutex            m_client_map_sync;
     ClientMapT            m_client_map;
+    struct SShmClient
+    {
+      std::shared_ptr<CServiceShmClient>    client;      //!< nullptr if no channel could be claimed (yet)
+      std::chrono::steady_clock::time_point retry_time;  //!< next attempt to claim a channel
+    };
+    using ShmClientMapT = std::map<std::string, SShmClient>;
+    ShmClientMapT         m_shm_client_map;   //!< services on the same host (guarded by m_client_map_sync)
 
     std::mutex            m_response_callback_sync;
     ResponseCallbackT     m_response_callback;
@@ -119,11 +176,18 @@ namespace eCAL
     using EventCallbackMapT = std::map<eCAL_Client_Event, ClientEventCallbackT>;
     EventCallbackMapT     m_event_callback_map;
 
+    std::mutex            m_call_state_sync;        //!< may be locked while holding SCallState::mutex, never the other way round
+    using PendingCallMapT = std::map<ServiceCallIdT, std::vector<std::pair<std::shared_ptr<SCallState>, std::uint64_t>>>;
+    PendingCallMapT       m_pending_call_map;       //!< outstanding asynchronous calls (call states and their generation)
+    std::vector<std::shared_ptr<SCallState>> m_call_state_pool;
+    std::atomic<ServiceCallIdT> m_call_id_counter;
+
     std::mutex            m_connected_services_map_sync;
     using ServiceAttrMapT = std::map<std::string, SServiceAttr>;
     ServiceAttrMapT       m_connected_services_map;
 
     static constexpr int  m_client_version = 1;
+    static constexpr size_t m_max_pooled_call_states = 64;   //!< call states kept for reuse
 
     std::string           m_service_name;
     std::string           m_service_id;
@@ -0,0 +1,179 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL service raw request / response frames
+**/
+
+#include "ecal_service_frame.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+
+namespace
+{
+  // first byte of a request frame (protobuf field number 0 is invalid)
+  constexpr std::uint8_t request_magic = 0x00;
+  // last byte of a response frame
+  constexpr std::uint8_t response_magic = 0xEC;
+
+  // magic (1) | version (1) | method name size (2)
+  constexpr std::size_t request_header_size = 4;
+
+  // ret_state (8) | error size (4) | hname, sname, sid, mname size (4 x 2) | call state (1) | reserved (1) | version (1) | magic (1)
+  constexpr std::size_t response_trailer_size = 24;
+
+  void PutUInt(std::string& buffer_, std::uint64_t value_, std::size_t bytes_)
+  {
+    for (std::size_t i = 0; i < bytes_; ++i)
+    {
+      buffer_.push_back(static_cast<char>((value_ >> (8 * i)) & 0xFF));
+    }
+  }
+
+  std::uint64_t GetUInt(const char* data_, std::size_t bytes_)
+  {
+    std::uint64_t value(0);
+    for (std::size_t i = 0; i < bytes_; ++i)
+    {
+      value |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(data_[i])) << (8 * i);
+    }
+    return value;
+  }
+
+  // names are limited to 64 KiB, errors to 4 GiB
+  std::size_t LimitedSize(const std::string& value_, std::uint64_t max_size_)
+  {
+    return static_cast<std::size_t>(std::min(static_cast<std::uint64_t>(value_.size()), max_size_));
+  }
+}
+
+namespace eCAL
+{
+  namespace ServiceFrame
+  {
+    bool IsRequestFrame(const std::string& buffer_)
+    {
+      return !buffer_.empty() && (static_cast<std::uint8_t>(buffer_[0]) == request_magic);
+    }
+
+    void BuildRequestFrame(const std::string& method_name_, const std::string& payload_, std::string& frame_)
+    {
+      const std::size_t method_size = LimitedSize(method_name_, std::numeric_limits<std::uint16_t>::max());
+
+      frame_.clear();
+      frame_.reserve(request_header_size + method_size + payload_.size());
+      PutUInt(frame_, request_magic, 1);
+      PutUInt(frame_, frame_version, 1);
+      PutUInt(frame_, method_size, 2);
+      frame_.append(method_name_, 0, method_size);
+      frame_.append(payload_);
+    }
+
+    bool ParseRequestFrame(const std::string& frame_, std::string& method_name_, std::string& payload_)
+    {
+      if (frame_.size() < request_header_size)                           return false;
+      if (static_cast<std::uint8_t>(frame_[0]) != request_magic)         return false;
+      if (static_cast<std::uint8_t>(frame_[1]) != frame_version)         return false;
+
+      const std::size_t method_size = static_cast<std::size_t>(GetUInt(frame_.data() + 2, 2));
+      if (frame_.size() < request_header_size + method_size)             return false;
+
+      method_name_.assign(frame_, request_header_size, method_size);
+      payload_.assign(frame_, request_header_size + method_size, std::string::npos);
+      return true;
+    }
+
+    void AppendResponseTrailer(const SServiceResponse& response_info_, std::string& payload_)
+    {
+      const std::uint64_t name_max   = std::numeric_limits<std::uint16_t>::max();
+      const std::size_t   hname_size = LimitedSize(response_info_.host_name,    name_max);
+      const std::size_t   sname_size = LimitedSize(response_info_.service_name, name_max);
+      const std::size_t   sid_size   = LimitedSize(response_info_.service_id,   name_max);
+      const std::size_t   mname_size = LimitedSize(response_info_.method_name,  name_max);
+      const std::size_t   error_size = LimitedSize(response_info_.error_msg,    std::numeric_limits<std::uint32_t>::max());
+
+      payload_.reserve(payload_.size() + hname_size + sname_size + sid_size + mname_size + error_size + response_trailer_size);
+      payload_.append(response_info_.host_name,    0, hname_size);
+      payload_.append(response_info_.service_name, 0, sname_size);
+      payload_.append(response_info_.service_id,   0, sid_size);
+      payload_.append(response_info_.method_name,  0, mname_size);
+      payload_.append(response_info_.error_msg,    0, error_size);
+
+      PutUInt(payload_, static_cast<std::uint64_t>(static_cast<std::int64_t>(response_info_.ret_state)), 8);
+      PutUInt(payload_, error_size, 4);
+      PutUInt(payload_, hname_size, 2);
+      PutUInt(payload_, sname_size, 2);
+      PutUInt(payload_, sid_size,   2);
+      PutUInt(payload_, mname_size, 2);
+      PutUInt(payload_, static_cast<std::uint64_t>(response_info_.call_state), 1);
+      PutUInt(payload_, 0, 1);
+      PutUInt(payload_, frame_version, 1);
+      PutUInt(payload_, response_magic, 1);
+    }
+
+    bool ParseResponseFrame(std::string& frame_, SServiceResponse& response_)
+    {
+      if (frame_.size() < response_trailer_size) return false;
+
+      const char* trailer = frame_.data() + frame_.size() - response_trailer_size;
+      if (static_cast<std::uint8_t>(trailer[23]) != response_magic) return false;
+      if (static_cast<std::uint8_t>(trailer[22]) != frame_version)  return false;
+
+      const std::size_t error_size = static_cast<std::size_t>(GetUInt(trailer +  8, 4));
+      const std::size_t hname_size = static_cast<std::size_t>(GetUInt(trailer + 12, 2));
+      const std::size_t sname_size = static_cast<std::size_t>(GetUInt(trailer + 14, 2));
+      const std::size_t sid_size   = static_cast<std::size_t>(GetUInt(trailer + 16, 2));
+      const std::size_t mname_size = static_cast<std::size_t>(GetUInt(trailer + 18, 2));
+      const std::size_t info_size  = hname_size + sname_size + sid_size + mname_size + error_size;
+      if (frame_.size() < info_size + response_trailer_size) return false;
+
+      const std::size_t payload_size = frame_.size() - info_size - response_trailer_size;
+      const char*       info         = frame_.data() + payload_size;
+      response_.host_name.assign   (info, hname_size); info += hname_size;
+      response_.service_name.assign(info, sname_size); info += sname_size;
+      response_.service_id.assign  (info, sid_size);   info += sid_size;
+      response_.method_name.assign (info, mname_size); info += mname_size;
+      response_.error_msg.assign   (info, error_size);
+      response_.ret_state = static_cast<int>(static_cast<std::int64_t>(GetUInt(trailer, 8)));
+
+      switch (static_cast<std::uint8_t>(trailer[20]))
+      {
+      case call_state_executed:
+        response_.call_state = call_state_executed;
+        break;
+      case call_state_failed:
+        response_.call_state = call_state_failed;
+        break;
+      default:
+        response_.call_state = call_state_none;
+        break;
+      }
+
+      // cut off the response information and take over the buffer
+      frame_.resize(payload_size);
+      response_.response = std::move(frame_);
+      return true;
+    }
+  }
+}
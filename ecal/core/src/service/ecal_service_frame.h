@@ -0,0 +1,68 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL service raw request / response frames
+**/
+
+#pragma once
+
+#include <ecal/ecal_service_info.h>
+
+#include <cstdint>
+#include <string>
+
+namespace eCAL
+{
+  /**
+   * @brief Binary framing of service calls, an alternative to the protobuf Request / Response messages.
+   *
+   * The payload is carried raw, so it is neither copied into a protobuf
+   * message nor serialized / parsed again.
+   *
+   * Request : SRequestHeader | method name | payload
+   * Response: payload | host name | service name | service id | method name | error | SResponseTrailer
+   *
+   * The response information is appended as trailer, so the method callback
+   * can write its response directly into the buffer that is sent.
+   * A request frame starts with a zero byte, which is never the first byte of a
+   * serialized protobuf Request, so the server can tell both formats apart.
+   * Clients only send frames to servers announcing the frame version in their registration.
+   * All numbers are little endian.
+  **/
+  namespace ServiceFrame
+  {
+    constexpr std::uint8_t frame_version = 1;
+
+    // check if the buffer contains a request frame (and not a protobuf Request)
+    bool IsRequestFrame(const std::string& buffer_);
+
+    // build a request frame
+    void BuildRequestFrame(const std::string& method_name_, const std::string& payload_, std::string& frame_);
+
+    // split a request frame into method name and payload
+    bool ParseRequestFrame(const std::string& frame_, std::string& method_name_, std::string& payload_);
+
+    // append the response information (all but the payload) to the payload
+    void AppendResponseTrailer(const SServiceResponse& response_info_, std::string& payload_);
+
+    // split a response frame, the payload is moved out of the frame into response_.response
+    bool ParseResponseFrame(std::string& frame_, SServiceResponse& response_);
+  }
+}
@@ -152,6 +152,20 @@ namespace eCAL
     return m_service_server_impl->RemMethodCallback(method_);
   }
 
+  /**
+   * @brief Serialize the execution of a method.
+   *
+   * @param method_      Service method name.
+   * @param serialized_  Execute the method calls one after another.
+   *
+   * @return  True if succeeded, false if not.
+  **/
+  bool CServiceServer::SetMethodSerialization(const std::string& method_, bool serialized_)
+  {
+    if (!m_created) return false;
+    return m_service_server_impl->SetMethodSerialization(method_, serialized_);
+  }
+
   /**
    * @brief Add callback function for server events.
    *
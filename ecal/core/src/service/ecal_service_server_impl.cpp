@@ -28,6 +28,7 @@
 #include "ecal_servicegate.h"
 #include "ecal_global_accessors.h"
 #include "ecal_service_server_impl.h"
+#include "ecal_service_frame.h"
 
 #include <chrono>
 #include <iostream>
@@ -116,16 +117,45 @@ namespace eCAL
                   return -1;
               };
 
+    // method calls of different clients are executed in parallel, by the
+    // worker threads if configured or by the service io threads otherwise (nullptr)
+    const std::shared_ptr<asio::io_context> callback_context = eCAL::service::ServiceManager::instance()->get_server_worker_context();
+
     // start service protocol version 0
     if (Config::IsServiceProtocolV0Enabled())
     {
-      m_tcp_server_v0 = server_manager->create_server(0, 0, service_callback, true, event_callback);
+      m_tcp_server_v0 = server_manager->create_server(0, 0, service_callback, true, callback_context, event_callback);
     }
 
-    // start service protocol version 1
+    // start service protocol version 1, the actual version (up to m_server_version)
+    // is negotiated with every client, so older clients are still served
     if (Config::IsServiceProtocolV1Enabled())
     {
-      m_tcp_server_v1 = server_manager->create_server(1, 0, service_callback, true, event_callback);
+      m_tcp_server_v1 = server_manager->create_server(static_cast<std::uint8_t>(m_server_version), 0, service_callback, true, callback_context, event_callback);
+    }
+
+    // offer the shared memory transport to clients on the same host
+    if (Config::Experimental::IsServiceShmTransportEnabled())
+    {
+      const CServiceShmServer::RequestCallbackT shm_request_callback
+              = [weak_me = std::weak_ptr<CServiceServerImpl>(shared_from_this())]
+                (const std::string& request, std::string& response) -> int
+                {
+                  auto me = weak_me.lock();
+                  if (me)
+                    return me->RequestCallback(request, response);
+                  else
+                    return -1;
+                };
+
+      // the requests are executed by the worker threads if configured or
+      // inline by the serving thread otherwise (no thread hop at all)
+      m_shm_server = std::make_shared<CServiceShmServer>();
+      if (!m_shm_server->Create(shm_request_callback, callback_context, Config::Experimental::GetServiceShmChannelCount(), Config::Experimental::GetServiceShmChannelSize()))
+      {
+        // clients will use tcp only
+        m_shm_server.reset();
+      }
     }
 
     // mark as created
@@ -147,6 +177,12 @@ namespace eCAL
     if (m_tcp_server_v1)
       m_tcp_server_v1->stop();
 
+    if (m_shm_server)
+    {
+      m_shm_server->Destroy();
+      m_shm_server.reset();
+    }
+
     // reset method callback map
     {
       std::lock_guard<std::mutex> const lock(m_method_map_sync);
@@ -265,6 +301,26 @@ namespace eCAL
     return false;
   }
 
+  // execute calls of a method one after another
+  bool CServiceServerImpl::SetMethodSerialization(const std::string& method_, bool serialized_)
+  {
+    std::lock_guard<std::mutex> const lock(m_method_map_sync);
+
+    // the method may be serialized before its callback is added
+    auto& method = m_method_map[method_];
+    method.method_pb.set_mname(method_);
+
+    if (!serialized_)
+    {
+      method.serialization_mutex.reset();
+    }
+    else if (!method.serialization_mutex)
+    {
+      method.serialization_mutex = std::make_shared<std::mutex>();
+    }
+    return true;
+  }
+
   // add callback function for server events
   bool CServiceServerImpl::AddEventCallback(eCAL_Server_Event type_, ServerEventCallbackT callback_)
   {
@@ -349,6 +405,8 @@ namespace eCAL
     service_mutable_service->set_sid(m_service_id);
     service_mutable_service->set_tcp_port_v0(server_tcp_port_v0);
     service_mutable_service->set_tcp_port_v1(server_tcp_port_v1);
+    if (m_shm_server) service_mutable_service->set_shm_name(m_shm_server->GetName());
+    service_mutable_service->set_frame_version(ServiceFrame::frame_version);
 
     // add methods
     {
@@ -391,6 +449,10 @@ namespace eCAL
 
   int CServiceServerImpl::RequestCallback(const std::string& request_, std::string& response_)
   {
+    // raw request frames (clients that know our frame version) skip the protobuf wrapping
+    if (ServiceFrame::IsRequestFrame(request_))
+      return RawRequestCallback(request_, response_);
+
     // prepare response
     eCAL::pb::Response response_pb;
     auto* response_pb_mutable_header = response_pb.mutable_header();
@@ -416,45 +478,27 @@ namespace eCAL
       return -1;
     }
 
-    // get method
-    SMethod method;
+    // execute method
     const auto& request_pb_header = request_pb.header();
     response_pb_mutable_header->set_mname(request_pb_header.mname());
+    std::string response_s;
+    int service_return_state(0);
+    if (!ExecuteMethod(request_pb_header.mname(), request_pb.request(), response_s, service_return_state))
     {
-      std::lock_guard<std::mutex> const lock(m_method_map_sync);
+      // set method call state 'failed'
+      response_pb_mutable_header->set_state(eCAL::pb::ServiceHeader_eCallState_failed);
+      // set error message
+      std::string const emsg = "Service '" + m_service_name + "' has no method named '" + request_pb_header.mname() + "'";
+      response_pb_mutable_header->set_error(emsg);
 
-      auto requested_method_iterator = m_method_map.find(request_pb_header.mname());
-      if (requested_method_iterator == m_method_map.end())
-      {
-        // set method call state 'failed'
-        response_pb_mutable_header->set_state(eCAL::pb::ServiceHeader_eCallState_failed);
-        // set error message
-        std::string const emsg = "Service '" + m_service_name + "' has no method named '" + request_pb_header.mname() + "'";
-        response_pb_mutable_header->set_error(emsg);
-
-        // serialize response and return "method not found"
-        response_ = response_pb.SerializeAsString();
-
-        // Return Success (error_code = 0), as parsing the request worked. The
-        // return value is not propagated to the remote caller.
-        return 0;
-      }
-      else
-      {
-        // increase call count
-        auto call_count = requested_method_iterator->second.method_pb.call_count();
-        requested_method_iterator->second.method_pb.set_call_count(++call_count);
+      // serialize response and return "method not found"
+      response_ = response_pb.SerializeAsString();
 
-        // store (copy) the method object, so we can release the mutex before calling the function
-        method = requested_method_iterator->second;
-      }
+      // Return Success (error_code = 0), as parsing the request worked. The
+      // return value is not propagated to the remote caller.
+      return 0;
     }
 
-    // execute method (outside lock guard)
-    const std::string& request_s = request_pb.request();
-    std::string response_s;
-    int const service_return_state = method.callback(method.method_pb.mname(), method.method_pb.req_type(), method.method_pb.resp_type(), request_s, response_s);
-
     // set method call state 'executed'
     response_pb_mutable_header->set_state(eCAL::pb::ServiceHeader_eCallState_executed);
     // set method response and return state
@@ -468,6 +512,80 @@ namespace eCAL
     return 0;
   }
 
+  int CServiceServerImpl::RawRequestCallback(const std::string& request_, std::string& response_)
+  {
+    // prepare response information
+    SServiceResponse response_info;
+    response_info.host_name    = eCAL::Process::GetHostName();
+    response_info.service_name = m_service_name;
+    response_info.service_id   = m_service_id;
+
+    // the method callback writes its response directly into the response buffer
+    response_.clear();
+
+    // try to parse request
+    std::string method_name;
+    std::string request;
+    if (!ServiceFrame::ParseRequestFrame(request_, method_name, request))
+    {
+      Logging::Log(log_level_error, m_service_name + "::CServiceServerImpl::RawRequestCallback failed to parse request frame");
+
+      response_info.call_state = call_state_failed;
+      response_info.error_msg  = "Service '" + m_service_name + "' request message could not be parsed.";
+      ServiceFrame::AppendResponseTrailer(response_info, response_);
+      return -1;
+    }
+
+    // execute method
+    response_info.method_name = method_name;
+    if (!ExecuteMethod(method_name, request, response_, response_info.ret_state))
+    {
+      response_info.call_state = call_state_failed;
+      response_info.error_msg  = "Service '" + m_service_name + "' has no method named '" + method_name + "'";
+    }
+    else
+    {
+      response_info.call_state = call_state_executed;
+    }
+
+    // append response information (the response payload is not copied)
+    ServiceFrame::AppendResponseTrailer(response_info, response_);
+    return 0;
+  }
+
+  bool CServiceServerImpl::ExecuteMethod(const std::string& method_name_, const std::string& request_, std::string& response_, int& return_state_)
+  {
+    // get method
+    SMethod method;
+    {
+      std::lock_guard<std::mutex> const lock(m_method_map_sync);
+
+      auto requested_method_iterator = m_method_map.find(method_name_);
+      if (requested_method_iterator == m_method_map.end())
+        return false;
+
+      // increase call count
+      auto call_count = requested_method_iterator->second.method_pb.call_count();
+      requested_method_iterator->second.method_pb.set_call_count(++call_count);
+
+      // store (copy) the method object, so we can release the mutex before calling the function
+      method = requested_method_iterator->second;
+    }
+
+    // execute method (outside lock guard)
+    if (method.serialization_mutex)
+    {
+      // serialized method, calls of other clients wait here
+      std::lock_guard<std::mutex> const serialization_lock(*method.serialization_mutex);
+      return_state_ = method.callback(method.method_pb.mname(), method.method_pb.req_type(), method.method_pb.resp_type(), request_, response_);
+    }
+    else
+    {
+      return_state_ = method.callback(method.method_pb.mname(), method.method_pb.req_type(), method.method_pb.resp_type(), request_, response_);
+    }
+    return true;
+  }
+
   void CServiceServerImpl::EventCallback(eCAL_Server_Event event_, const std::string& /*message_*/)
   {
     bool mode_changed(false);
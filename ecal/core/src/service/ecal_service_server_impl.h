@@ -43,6 +43,8 @@
 
 #include <ecal/service/server.h>
 
+#include "ecal_service_shm_server.h"
+
 namespace eCAL
 {
   /**
@@ -77,6 +79,9 @@ namespace eCAL
     bool AddMethodCallback(const std::string& method_, const std::string& req_type_, const std::string& resp_type_, const MethodCallbackT& callback_);
     bool RemMethodCallback(const std::string& method_);
 
+    // execute calls of a method one after another
+    bool SetMethodSerialization(const std::string& method_, bool serialized_);
+
     // add and remove callback function for server events
     bool AddEventCallback(eCAL_Server_Event type_, ServerEventCallbackT callback_);
     bool RemEventCallback(eCAL_Server_Event type_);
@@ -99,12 +104,17 @@ namespace eCAL
     /**
      * @brief Calls the request callback based on the request and fills the response
      * 
-     * @param[in]  request_   The service request in serialized protobuf form
-     * @param[out] response_  A serialized protobuf response. My not be set at all.
+     * @param[in]  request_   The service request in serialized protobuf form or as raw request frame (see ecal_service_frame.h)
+     * @param[out] response_  A serialized protobuf response (or a raw response frame). My not be set at all.
      * 
      * @return  0 if succeeded, -1 if not.
      */
     int RequestCallback(const std::string& request_, std::string& response_);
+    int RawRequestCallback(const std::string& request_, std::string& response_);
+
+    // executes the method callback, returns false if the method does not exist
+    bool ExecuteMethod(const std::string& method_name_, const std::string& request_, std::string& response_, int& return_state_);
+
     void EventCallback(eCAL_Server_Event event_, const std::string& message_);
 
     bool ApplyServiceToDescGate(const std::string& method_name_
@@ -113,16 +123,18 @@ namespace eCAL
 
     std::shared_ptr<eCAL::service::Server> m_tcp_server_v0;
     std::shared_ptr<eCAL::service::Server> m_tcp_server_v1;
+    std::shared_ptr<CServiceShmServer>     m_shm_server;      //!< serves clients on the same host (experimental)
 
-    static constexpr int  m_server_version = 1;
+    static constexpr int  m_server_version = 2;   // since version 2 clients may pipeline their requests
     
     std::string           m_service_name;
     std::string           m_service_id;
 
     struct SMethod
     {
-      eCAL::pb::Method method_pb;
-      MethodCallbackT  callback;
+      eCAL::pb::Method            method_pb;
+      MethodCallbackT             callback;
+      std::shared_ptr<std::mutex> serialization_mutex;  //!< set for serialized methods, shared by all copies of the method
     };
     std::mutex            m_method_map_sync;
     using MethodMapT = std::map<std::string, SMethod>;
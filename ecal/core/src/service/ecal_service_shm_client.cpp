@@ -0,0 +1,301 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL service client shared memory transport
+**/
+
+#include <ecal/ecal_log.h>
+#include <ecal/ecal_process.h>
+
+#include "ecal_def.h"
+#include "ecal_process.h"
+#include "ecal_service_shm_layout.h"
+#include "ecal_service_shm_client.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace eCAL
+{
+  CServiceShmClient::CServiceShmClient() :
+    m_base_address(nullptr),
+    m_channel_index(0),
+    m_payload_size(0),
+    m_request_seq(0),
+    m_chunk_seq(0),
+    m_closed(false),
+    m_server_lost(false),
+    m_stop(false),
+    m_created(false)
+  {
+  }
+
+  CServiceShmClient::~CServiceShmClient()
+  {
+    Destroy();
+  }
+
+  bool CServiceShmClient::Create(const std::string& memfile_name_)
+  {
+    if (m_created) return false;
+
+    // open the server memory file
+    m_memfile_name = memfile_name_;
+    if (!m_memfile.Create(m_memfile_name.c_str(), false))
+    {
+      return false;
+    }
+
+    // check the layout
+    m_base_address = m_memfile.GetUnsyncedAddress();
+    const auto* header = static_cast<const ServiceShm::SHeader*>(m_base_address);
+    if ((header == nullptr)
+      || (header->hdr_size != sizeof(ServiceShm::SHeader))
+      || (header->version  != ServiceShm::layout_version)
+      || (header->server_state.load(std::memory_order_acquire) != ServiceShm::server_state_running)
+      || (m_memfile.MaxDataSize() < ServiceShm::MemorySize(header->channel_count, static_cast<size_t>(header->payload_size))))
+    {
+      m_memfile.Destroy(false);
+      return false;
+    }
+    m_payload_size = static_cast<size_t>(header->payload_size);
+
+    // claim an idle channel
+    const auto owner = static_cast<std::uint32_t>(Process::GetProcessID());
+    bool claimed(false);
+    for (size_t index = 0; (index < header->channel_count) && !claimed; ++index)
+    {
+      auto* channel = ServiceShm::Channel(m_base_address, index);
+      std::uint32_t free_owner(0);
+      if (!channel->owner.compare_exchange_strong(free_owner, owner, std::memory_order_acq_rel)) continue;
+
+      // a previous owner may have left a call behind, we do not share the channel with it
+      m_request_seq = channel->request_seq.load(std::memory_order_acquire);
+      if (m_request_seq != channel->response_seq.load(std::memory_order_acquire))
+      {
+        channel->owner.store(0, std::memory_order_release);
+        continue;
+      }
+
+      // an unread chunk of the previous owner is skipped
+      m_chunk_seq = channel->chunk_seq.load(std::memory_order_acquire);
+      channel->chunk_ack.store(m_chunk_seq, std::memory_order_release);
+
+      m_channel_index = index;
+      claimed         = true;
+    }
+    if (!claimed)
+    {
+#ifndef NDEBUG
+      Logging::Log(log_level_debug2, std::string("CServiceShmClient::Create : no free channel in ") + m_memfile_name);
+#endif
+      m_memfile.Destroy(false);
+      return false;
+    }
+
+    // open the server events
+    if (!m_request_event.Open(ServiceShm::RequestEventName(m_memfile_name))
+      || !m_response_event.Open(ServiceShm::ResponseEventName(m_memfile_name, m_channel_index)))
+    {
+      m_request_event.Close();
+      m_response_event.Close();
+      ServiceShm::Channel(m_base_address, m_channel_index)->owner.store(0, std::memory_order_release);
+      m_memfile.Destroy(false);
+      return false;
+    }
+
+    // start receiving, the thread keeps this object alive until it is stopped
+    m_response.reset();
+    m_closed      = false;
+    m_server_lost = false;
+    m_stop        = false;
+    m_created = true;
+    m_thread  = std::thread([me = shared_from_this()]() { me->ReceiveResponses(); });
+
+#ifndef NDEBUG
+    Logging::Log(log_level_debug2, std::string("CServiceShmClient::Create SUCCESS : ") + m_memfile_name + " (channel " + std::to_string(m_channel_index) + ")");
+#endif
+
+    return true;
+  }
+
+  bool CServiceShmClient::Destroy()
+  {
+    if (!m_created) return false;
+    m_created = false;
+
+    // stop receiving, pending calls fail
+    m_stop = true;
+    m_response_event.Set();
+    if (m_thread.joinable())
+    {
+      // the last reference may be released by a response callback
+      if (m_thread.get_id() == std::this_thread::get_id()) m_thread.detach();
+      else                                                 m_thread.join();
+    }
+
+    // release the channel (if the server is gone, nobody will ever look at it)
+    ServiceShm::Channel(m_base_address, m_channel_index)->owner.store(0, std::memory_order_release);
+
+    m_response_event.Close();
+    m_request_event.Close();
+
+    m_base_address = nullptr;
+    m_memfile.Destroy(false);
+
+    return true;
+  }
+
+  bool CServiceShmClient::IsConnected() const
+  {
+    if (!m_created)    return false;
+    if (m_server_lost) return false;
+    return static_cast<const ServiceShm::SHeader*>(m_base_address)->server_state.load(std::memory_order_acquire) == ServiceShm::server_state_running;
+  }
+
+  bool CServiceShmClient::AsyncCall(const std::shared_ptr<std::string>& request_, const eCAL::service::ClientResponseCallbackT& response_callback_)
+  {
+    if (!IsConnected())                    return false;
+    if (request_->size() > m_payload_size) return false;
+
+    const std::lock_guard<std::mutex> lock(m_call_sync);
+    if (m_closed) return false;
+
+    SCall call{ request_, response_callback_ };
+    if (m_call_in_flight.callback)
+    {
+      // one call at a time, the next one is sent by the receive thread
+      m_call_queue.push_back(std::move(call));
+    }
+    else
+    {
+      SendRequest(std::move(call));
+    }
+    return true;
+  }
+
+  void CServiceShmClient::SendRequest(SCall&& call_)
+  {
+    // m_call_sync is locked by the caller
+    auto* channel = ServiceShm::Channel(m_base_address, m_channel_index);
+    if (!call_.request->empty()) memcpy(ServiceShm::RequestBuffer(channel), call_.request->data(), call_.request->size());
+    channel->request_size = static_cast<std::uint64_t>(call_.request->size());
+    m_call_in_flight = std::move(call_);
+
+    // publish the request and wake up the server
+    channel->request_seq.store(++m_request_seq, std::memory_order_release);
+    m_request_event.Set();
+  }
+
+  void CServiceShmClient::ReceiveResponses()
+  {
+    auto* channel = ServiceShm::Channel(m_base_address, m_channel_index);
+    auto  last_server_check = std::chrono::steady_clock::now();
+
+    while (!m_stop)
+    {
+      // the timeout only protects against a lost wakeup
+      m_response_event.Wait(CMN_SERVICE_SHM_WAIT_TIMEOUT_MS);
+
+      eCAL::service::ClientResponseCallbackT callback;
+      std::shared_ptr<std::string>           response;
+      {
+        const std::lock_guard<std::mutex> lock(m_call_sync);
+        const std::uint64_t chunk_seq = channel->chunk_seq.load(std::memory_order_acquire);
+        if (!m_call_in_flight.callback || (chunk_seq == m_chunk_seq))
+        {
+          // server gone, the call will never be answered
+          if (!IsServerAlive(last_server_check)) break;
+          continue;
+        }
+
+        // read the chunk and acknowledge it
+        if (!m_response)
+        {
+          m_response = std::make_shared<std::string>();
+          m_response->reserve(static_cast<size_t>(channel->response_size));
+        }
+        const size_t chunk_size = std::min(static_cast<size_t>(channel->chunk_size), m_payload_size);
+        m_response->append(ServiceShm::ResponseBuffer(channel, m_payload_size), chunk_size);
+        m_chunk_seq = chunk_seq;
+        channel->chunk_ack.store(m_chunk_seq, std::memory_order_release);
+
+        // request the next chunk
+        if ((m_response->size() < static_cast<size_t>(channel->response_size)) && (chunk_size > 0))
+        {
+          m_request_event.Set();
+          continue;
+        }
+
+        response = std::move(m_response);
+        m_response.reset();
+        callback = std::move(m_call_in_flight.callback);
+        m_call_in_flight = SCall();
+
+        // send the next queued call
+        if (!m_call_queue.empty())
+        {
+          SCall next_call = std::move(m_call_queue.front());
+          m_call_queue.pop_front();
+          SendRequest(std::move(next_call));
+        }
+      }
+
+      callback(eCAL::service::Error(eCAL::service::Error::OK), response);
+    }
+
+    // fail all pending calls
+    std::vector<eCAL::service::ClientResponseCallbackT> pending_callbacks;
+    {
+      const std::lock_guard<std::mutex> lock(m_call_sync);
+      m_closed = true;
+      if (m_call_in_flight.callback) pending_callbacks.push_back(std::move(m_call_in_flight.callback));
+      for (auto& call : m_call_queue) pending_callbacks.push_back(std::move(call.callback));
+      m_call_in_flight = SCall();
+      m_call_queue.clear();
+      m_response.reset();
+    }
+    const eCAL::service::Error error(eCAL::service::Error::CONNECTION_CLOSED, m_stop ? "Shared memory client stopped" : "Shared memory server closed");
+    for (const auto& callback : pending_callbacks)
+    {
+      callback(error, nullptr);
+    }
+  }
+
+  bool CServiceShmClient::IsServerAlive(std::chrono::steady_clock::time_point& last_check_)
+  {
+    const auto* header = static_cast<const ServiceShm::SHeader*>(m_base_address);
+    if (header->server_state.load(std::memory_order_acquire) != ServiceShm::server_state_running) return false;
+
+    // a crashed server never closes its memory file, so we check its process from time to time
+    const auto now = std::chrono::steady_clock::now();
+    if (now - last_check_ < std::chrono::milliseconds(CMN_SERVICE_SHM_WAIT_TIMEOUT_MS)) return true;
+    last_check_ = now;
+
+    if (Process::internal::IsProcessAlive(static_cast<int>(header->server_pid))) return true;
+
+    m_server_lost = true;
+    return false;
+  }
+}
@@ -0,0 +1,123 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL service client shared memory transport
+**/
+
+#pragma once
+
+#include <ecal/service/client_session_types.h>
+
+#include "io/shm/ecal_memfile.h"
+#include "ecal_service_shm_event.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace eCAL
+{
+  /**
+   * @brief Calls a service server on the same host via its memory file (see ecal_service_shm_layout.h).
+   *
+   * The client claims one channel of the server. Only one call is in flight on
+   * the channel, further calls are queued and sent when the response arrived.
+   * Responses larger than the channel are received in chunks.
+  **/
+  class CServiceShmClient : public std::enable_shared_from_this<CServiceShmClient>
+  {
+  public:
+    CServiceShmClient();
+    ~CServiceShmClient();
+
+    // this object must not be copied and moved
+    CServiceShmClient(const CServiceShmClient&) = delete;
+    CServiceShmClient& operator=(const CServiceShmClient&) = delete;
+    CServiceShmClient(CServiceShmClient&&) = delete;
+    CServiceShmClient& operator=(CServiceShmClient&&) = delete;
+
+    /**
+     * @brief Open the server memory file and claim a free channel.
+     *
+     * @param memfile_name_  Memory file name published by the service registration.
+     *
+     * @return  True if succeeded, false if the server is gone or all channels are in use.
+    **/
+    bool Create(const std::string& memfile_name_);
+
+    /**
+     * @brief Release the channel, pending calls fail.
+    **/
+    bool Destroy();
+
+    // check if the server is still serving (false if it has been closed or crashed)
+    bool IsConnected() const;
+
+    /**
+     * @brief Call the service asynchronously.
+     *
+     * @param request_            Serialized request.
+     * @param response_callback_  Callback receiving the serialized response (executed by the receive thread).
+     *
+     * @return  True if the call has been sent or queued, false if the
+     *          request does not fit into the channel or the server is gone.
+    **/
+    bool AsyncCall(const std::shared_ptr<std::string>& request_, const eCAL::service::ClientResponseCallbackT& response_callback_);
+
+  private:
+    struct SCall
+    {
+      std::shared_ptr<std::string>           request;
+      eCAL::service::ClientResponseCallbackT callback;
+    };
+
+    void SendRequest(SCall&& call_);
+    void ReceiveResponses();
+    bool IsServerAlive(std::chrono::steady_clock::time_point& last_check_);
+
+    std::string                   m_memfile_name;
+    CMemoryFile                   m_memfile;
+    void*                         m_base_address;
+    size_t                        m_channel_index;
+    size_t                        m_payload_size;
+
+    CServiceShmEvent              m_request_event;
+    CServiceShmEvent              m_response_event;
+
+    std::mutex                    m_call_sync;
+    std::deque<SCall>             m_call_queue;
+    SCall                         m_call_in_flight;
+    std::uint64_t                 m_request_seq;
+    std::uint64_t                 m_chunk_seq;        //!< last received response chunk
+    std::shared_ptr<std::string>  m_response;         //!< response of the call in flight (received chunks)
+    bool                          m_closed;
+    std::atomic<bool>             m_server_lost;
+
+    std::thread                   m_thread;
+    std::atomic<bool>             m_stop;
+    bool                          m_created;
+  };
+}
@@ -0,0 +1,161 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL service shared memory transport wakeup event
+**/
+
+#include "ecal_def.h"
+#include "ecal_event_internal.h"
+#include "ecal_service_shm_event.h"
+
+#include <ecal/ecal_event.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#if defined(__linux__)
+#include <time.h>
+#endif
+
+namespace eCAL
+{
+#if defined(__linux__)
+  namespace
+  {
+    // different name than the eCAL named events, the layouts may differ (ECAL_USE_FUTEX_EVENT)
+    std::string FutexEventName(const std::string& event_name_)
+    {
+      const std::string name = event_name_ + "_sevt";
+      return (name[0] != '/') ? "/" + name : name;
+    }
+  }
+
+  CServiceShmEvent::CServiceShmEvent() :
+    m_event(nullptr),
+    m_owner(false)
+  {
+  }
+
+  CServiceShmEvent::~CServiceShmEvent()
+  {
+    Close();
+  }
+
+  bool CServiceShmEvent::Create(const std::string& event_name_)
+  {
+    if (m_event != nullptr) return false;
+
+    m_name  = FutexEventName(event_name_);
+    m_event = futex_event_create(m_name.c_str());
+    // a crashed server may have left its event behind
+    if (m_event == nullptr) m_event = futex_event_open(m_name.c_str());
+    m_owner = true;
+    return m_event != nullptr;
+  }
+
+  bool CServiceShmEvent::Open(const std::string& event_name_)
+  {
+    if (m_event != nullptr) return false;
+
+    m_name  = FutexEventName(event_name_);
+    m_event = futex_event_open(m_name.c_str());
+    m_owner = false;
+    return m_event != nullptr;
+  }
+
+  void CServiceShmEvent::Close()
+  {
+    if (m_event == nullptr) return;
+
+    futex_event_close(m_event);
+    if (m_owner) futex_event_destroy(m_name.c_str());
+    m_event = nullptr;
+  }
+
+  void CServiceShmEvent::Set()
+  {
+    if (m_event == nullptr) return;
+    futex_event_set(m_event);
+  }
+
+  bool CServiceShmEvent::Wait(long timeout_ms_)
+  {
+    if (m_event == nullptr) return false;
+
+    // the other side usually answers within a few microseconds, polling
+    // the futex word is cheaper than sleeping in the kernel for it
+    const auto spin_end = std::chrono::steady_clock::now() + std::chrono::microseconds(CMN_SERVICE_SHM_SPIN_US);
+    do
+    {
+      if (futex_event_trywait(m_event)) return true;
+      // give the other side the cpu on single core machines
+      std::this_thread::yield();
+    } while (std::chrono::steady_clock::now() < spin_end);
+
+    struct timespec abstime;
+    clock_gettime(CLOCK_MONOTONIC, &abstime);
+    abstime.tv_sec  += timeout_ms_ / 1000;
+    abstime.tv_nsec += (timeout_ms_ % 1000) * 1000000;
+    while (abstime.tv_nsec >= 1000000000)
+    {
+      abstime.tv_nsec -= 1000000000;
+      abstime.tv_sec++;
+    }
+    return futex_event_wait(m_event, &abstime);
+  }
+#else
+  CServiceShmEvent::CServiceShmEvent() = default;
+
+  CServiceShmEvent::~CServiceShmEvent()
+  {
+    Close();
+  }
+
+  bool CServiceShmEvent::Create(const std::string& event_name_)
+  {
+    if (gEventIsValid(m_event)) return false;
+    return gOpenNamedEvent(&m_event, event_name_, true);
+  }
+
+  bool CServiceShmEvent::Open(const std::string& event_name_)
+  {
+    if (gEventIsValid(m_event)) return false;
+    return gOpenExistingNamedEvent(&m_event, event_name_);
+  }
+
+  void CServiceShmEvent::Close()
+  {
+    if (!gEventIsValid(m_event)) return;
+    gCloseEvent(m_event);
+    gInvalidateEvent(&m_event);
+  }
+
+  void CServiceShmEvent::Set()
+  {
+    gSetEvent(m_event);
+  }
+
+  bool CServiceShmEvent::Wait(long timeout_ms_)
+  {
+    return gWaitForEvent(m_event, timeout_ms_);
+  }
+#endif
+}
@@ -0,0 +1,76 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL service shared memory transport wakeup event
+**/
+
+#pragma once
+
+#include <ecal/ecal_eventhandle.h>
+
+#include <string>
+
+#if defined(__linux__)
+#include "io/evt/linux/ecal_named_event_futex.h"
+#endif
+
+namespace eCAL
+{
+  /**
+   * @brief Named event waking up the other side of a shared memory service channel.
+   *
+   * On Linux the event is always a futex in shared memory (independent of
+   * ECAL_USE_FUTEX_EVENT), setting it does not enter the kernel as long as
+   * nobody sleeps. Wait polls the event for CMN_SERVICE_SHM_SPIN_US before it
+   * blocks, so a response arriving within a few microseconds does not cost a
+   * sleep / wakeup cycle. Other platforms use the eCAL named events.
+  **/
+  class CServiceShmEvent
+  {
+  public:
+    CServiceShmEvent();
+    ~CServiceShmEvent();
+
+    // this object must not be copied and moved
+    CServiceShmEvent(const CServiceShmEvent&) = delete;
+    CServiceShmEvent& operator=(const CServiceShmEvent&) = delete;
+    CServiceShmEvent(CServiceShmEvent&&) = delete;
+    CServiceShmEvent& operator=(CServiceShmEvent&&) = delete;
+
+    // create the event (owned, removed by Close)
+    bool Create(const std::string& event_name_);
+    // open an event created by the other side
+    bool Open(const std::string& event_name_);
+    void Close();
+
+    void Set();
+    // wait until the event is set or timeout_ms_ elapsed (auto reset)
+    bool Wait(long timeout_ms_);
+
+  private:
+#if defined(__linux__)
+    std::string     m_name;
+    futex_event_t*  m_event;
+    bool            m_owner;
+#else
+    EventHandleT    m_event;
+#endif
+  };
+}
@@ -0,0 +1,135 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL service shared memory transport layout
+**/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace eCAL
+{
+  /**
+   * @brief Layout of the memory file a service server offers to clients on the same host.
+   *
+   * Every client claims one channel and has at most one call in flight on it.
+   * The client writes the request and increments request_seq. The server
+   * executes it and writes the response in chunks of at most payload_size
+   * bytes, every chunk increments chunk_seq. The client reads a chunk and
+   * acknowledges it with chunk_ack, only then the server writes the next one.
+   * The server sets response_seq to request_seq with the last chunk, a channel
+   * can only be claimed if both are equal (no call left behind).
+   *
+   * Both sides are woken up by named events (one for the server, one per
+   * channel for the client, see ecal_service_shm_event.h) and check the process id of the other side
+   * (server_pid, owner) to detect crashed processes.
+   *
+   * Layout : SHeader | channel 0 | channel 1 | ... | channel n-1
+   * Channel: SChannel | request (payload_size bytes) | response (payload_size bytes)
+  **/
+  namespace ServiceShm
+  {
+    constexpr std::uint16_t layout_version = 2;
+
+    enum eServerState : std::uint32_t
+    {
+      server_state_closed  = 0,
+      server_state_running = 1,
+    };
+
+    struct SHeader
+    {
+      std::uint16_t              hdr_size      = sizeof(SHeader);
+      std::uint16_t              version       = layout_version;
+      std::uint32_t              channel_count = 0;
+      std::uint64_t              payload_size  = 0;
+      std::atomic<std::uint32_t> server_state;
+      std::uint32_t              server_pid    = 0;
+    };
+
+    struct SChannel
+    {
+      std::atomic<std::uint32_t> owner;           // process id of the client using the channel (0 = free)
+      std::uint32_t              reserved;
+      std::atomic<std::uint64_t> request_seq;     // written by the client
+      std::atomic<std::uint64_t> response_seq;    // written by the server (with the last chunk)
+      std::atomic<std::uint64_t> chunk_seq;       // written by the server
+      std::atomic<std::uint64_t> chunk_ack;       // written by the client
+      std::uint64_t              request_size;
+      std::uint64_t              response_size;   // complete size of the response
+      std::uint64_t              chunk_size;      // size of the actual chunk
+    };
+
+    // align channels to cache lines to avoid false sharing between clients
+    constexpr std::size_t alignment = 64;
+
+    inline std::size_t AlignUp(std::size_t size_)
+    {
+      return (size_ + alignment - 1) / alignment * alignment;
+    }
+
+    inline std::size_t HeaderStride()
+    {
+      return AlignUp(sizeof(SHeader));
+    }
+
+    inline std::size_t ChannelStride(std::size_t payload_size_)
+    {
+      return AlignUp(sizeof(SChannel) + 2 * payload_size_);
+    }
+
+    inline std::size_t MemorySize(std::size_t channel_count_, std::size_t payload_size_)
+    {
+      return HeaderStride() + channel_count_ * ChannelStride(payload_size_);
+    }
+
+    inline SChannel* Channel(void* base_, std::size_t index_)
+    {
+      const SHeader* header = static_cast<const SHeader*>(base_);
+      return reinterpret_cast<SChannel*>(static_cast<char*>(base_) + HeaderStride() + index_ * ChannelStride(static_cast<std::size_t>(header->payload_size)));
+    }
+
+    inline char* RequestBuffer(SChannel* channel_)
+    {
+      return reinterpret_cast<char*>(channel_) + sizeof(SChannel);
+    }
+
+    inline char* ResponseBuffer(SChannel* channel_, std::size_t payload_size_)
+    {
+      return reinterpret_cast<char*>(channel_) + sizeof(SChannel) + payload_size_;
+    }
+
+    // event set by the clients when a new request is available
+    inline std::string RequestEventName(const std::string& memfile_name_)
+    {
+      return memfile_name_ + "_req";
+    }
+
+    // event set by the server when the response of a channel is available
+    inline std::string ResponseEventName(const std::string& memfile_name_, std::size_t index_)
+    {
+      return memfile_name_ + "_rsp" + std::to_string(index_);
+    }
+  }
+}
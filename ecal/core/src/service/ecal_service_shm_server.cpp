@@ -0,0 +1,341 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL service server shared memory transport
+**/
+
+#include <ecal/ecal_log.h>
+#include <ecal/ecal_process.h>
+
+#include "ecal_def.h"
+#include "ecal_process.h"
+#include "io/shm/ecal_memfile_naming.h"
+#include "ecal_service_shm_layout.h"
+#include "ecal_service_shm_server.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <memory>
+#include <string>
+
+namespace eCAL
+{
+  CServiceShmServer::CServiceShmServer() :
+    m_base_address(nullptr),
+    m_channel_count(0),
+    m_payload_size(0),
+    m_stop(false),
+    m_created(false)
+  {
+  }
+
+  CServiceShmServer::~CServiceShmServer()
+  {
+    Destroy();
+  }
+
+  bool CServiceShmServer::Create(const RequestCallbackT& request_callback_, const std::shared_ptr<asio::io_context>& callback_context_, size_t channel_count_, size_t payload_size_)
+  {
+    if (m_created)           return false;
+    if (channel_count_ == 0) return false;
+    if (payload_size_  == 0) return false;
+
+    m_request_callback = request_callback_;
+    m_callback_context = callback_context_;
+    m_channel_count    = channel_count_;
+    m_payload_size     = payload_size_;
+
+    // create the memory file, its content is zero initialized
+    m_memfile_name = memfile::BuildRandomMemFileName("ecal_srv_");
+    const size_t memfile_size = ServiceShm::MemorySize(m_channel_count, m_payload_size);
+    if (!m_memfile.Create(m_memfile_name.c_str(), true, memfile_size))
+    {
+      Logging::Log(log_level_error, std::string("CServiceShmServer::Create FAILED : ") + m_memfile_name);
+      return false;
+    }
+
+    m_base_address = m_memfile.GetUnsyncedAddress();
+    if (m_base_address == nullptr)
+    {
+      Logging::Log(log_level_error, std::string("CServiceShmServer::Create FAILED (mapping) : ") + m_memfile_name);
+      m_memfile.Destroy(true);
+      return false;
+    }
+
+    // create the events before the clients are able to see the layout
+    m_request_event.Create(ServiceShm::RequestEventName(m_memfile_name));
+    m_response_events.clear();
+    for (size_t index = 0; index < m_channel_count; ++index)
+    {
+      m_response_events.emplace_back(new CServiceShmEvent());
+      m_response_events.back()->Create(ServiceShm::ResponseEventName(m_memfile_name, index));
+    }
+    m_channel_states.assign(m_channel_count, SChannelState());
+    m_inline_requests.clear();
+
+    // initialize the layout and publish it
+    auto* header = new (m_base_address) ServiceShm::SHeader();
+    header->channel_count = static_cast<std::uint32_t>(m_channel_count);
+    header->payload_size  = static_cast<std::uint64_t>(m_payload_size);
+    header->server_pid    = static_cast<std::uint32_t>(Process::GetProcessID());
+    for (size_t index = 0; index < m_channel_count; ++index)
+    {
+      auto* channel = ServiceShm::Channel(m_base_address, index);
+      channel->owner.store(0, std::memory_order_relaxed);
+      channel->request_seq.store(0, std::memory_order_relaxed);
+      channel->response_seq.store(0, std::memory_order_relaxed);
+      channel->chunk_seq.store(0, std::memory_order_relaxed);
+      channel->chunk_ack.store(0, std::memory_order_relaxed);
+    }
+    header->server_state.store(ServiceShm::server_state_running, std::memory_order_release);
+
+    // start serving, the thread keeps this object alive until it is stopped
+    m_stop    = false;
+    m_created = true;
+    m_thread  = std::thread([me = shared_from_this()]() { me->ServeChannels(); });
+
+#ifndef NDEBUG
+    Logging::Log(log_level_debug2, std::string("CServiceShmServer::Create SUCCESS : ") + m_memfile_name);
+#endif
+
+    return true;
+  }
+
+  bool CServiceShmServer::Destroy()
+  {
+    if (!m_created) return false;
+    m_created = false;
+
+    // tell the clients that we are gone, requests executed right now drop their response
+    {
+      const std::lock_guard<std::mutex> lock(m_sync);
+      m_stop = true;
+      static_cast<ServiceShm::SHeader*>(m_base_address)->server_state.store(ServiceShm::server_state_closed, std::memory_order_release);
+    }
+
+    // stop serving
+    m_request_event.Set();
+    if (m_thread.joinable())
+    {
+      // the last reference may be released by the serving thread itself
+      if (m_thread.get_id() == std::this_thread::get_id()) m_thread.detach();
+      else                                                 m_thread.join();
+    }
+
+    // wake up all waiting clients, they will see the closed state
+    for (auto& event : m_response_events)
+    {
+      event->Set();
+      event->Close();
+    }
+    m_response_events.clear();
+    m_request_event.Close();
+
+    // remove the memory file, clients keep their mapping until they detach
+    {
+      const std::lock_guard<std::mutex> lock(m_sync);
+      m_channel_states.clear();
+      m_inline_requests.clear();
+      m_base_address = nullptr;
+      m_memfile.Destroy(true);
+    }
+
+#ifndef NDEBUG
+    Logging::Log(log_level_debug2, std::string("CServiceShmServer::Destroy : ") + m_memfile_name);
+#endif
+
+    return true;
+  }
+
+  void CServiceShmServer::ServeChannels()
+  {
+    auto last_client_check = std::chrono::steady_clock::now();
+    while (!m_stop)
+    {
+      // the event is set by every client request and acknowledge,
+      // the timeout only protects against a lost wakeup
+      m_request_event.Wait(CMN_SERVICE_SHM_WAIT_TIMEOUT_MS);
+
+      std::vector<SRequest> inline_requests;
+      {
+        const std::lock_guard<std::mutex> lock(m_sync);
+        if (m_stop) break;
+
+        // requests arriving while we scan set the event again
+        for (size_t index = 0; index < m_channel_count; ++index)
+        {
+          ServeChannel(index);
+        }
+
+        // crashed clients would block their channels forever
+        const auto now = std::chrono::steady_clock::now();
+        if (now - last_client_check >= std::chrono::milliseconds(CMN_SERVICE_SHM_WAIT_TIMEOUT_MS))
+        {
+          ReleaseCrashedClients();
+          last_client_check = now;
+        }
+
+        inline_requests.swap(m_inline_requests);
+      }
+
+      // no callback context, execute the requests right here (unlocked, the callback may take a while)
+      for (const auto& request : inline_requests)
+      {
+        // the server may have been destroyed by a previous callback
+        if (m_stop) break;
+        ExecuteRequest(request.index, request.request_seq, request.request);
+      }
+    }
+  }
+
+  void CServiceShmServer::ServeChannel(size_t index_)
+  {
+    // m_sync is locked by the caller
+    auto* channel = ServiceShm::Channel(m_base_address, index_);
+    auto& state   = m_channel_states[index_];
+
+    switch (state.state)
+    {
+    case SChannelState::state_idle:
+    {
+      // new request available ?
+      const std::uint64_t request_seq = channel->request_seq.load(std::memory_order_acquire);
+      if (request_seq == channel->response_seq.load(std::memory_order_relaxed)) return;
+
+      // execute it by the callback context or by the serving thread after the scan
+      const size_t request_size = std::min(static_cast<size_t>(channel->request_size), m_payload_size);
+      auto request = std::make_shared<std::string>(ServiceShm::RequestBuffer(channel), request_size);
+      state.state       = SChannelState::state_executing;
+      state.request_seq = request_seq;
+      if (m_callback_context)
+      {
+        asio::post(*m_callback_context, [me = shared_from_this(), index_, request_seq, request]() { me->ExecuteRequest(index_, request_seq, request); });
+      }
+      else
+      {
+        m_inline_requests.push_back(SRequest{ index_, request_seq, request });
+      }
+      break;
+    }
+    case SChannelState::state_executing:
+      break;
+    case SChannelState::state_streaming:
+      // the client has released the channel, nobody reads the rest of the response
+      if (channel->owner.load(std::memory_order_acquire) == 0)
+      {
+        FinishCall(index_);
+      }
+      // the client has read the last chunk
+      else if (channel->chunk_ack.load(std::memory_order_acquire) == channel->chunk_seq.load(std::memory_order_relaxed))
+      {
+        WriteChunk(index_);
+      }
+      break;
+    }
+  }
+
+  void CServiceShmServer::ExecuteRequest(size_t index_, std::uint64_t request_seq_, const std::shared_ptr<std::string>& request_)
+  {
+    auto response = std::make_shared<std::string>();
+    m_request_callback(*request_, *response);
+
+    const std::lock_guard<std::mutex> lock(m_sync);
+
+    // the server may have been destroyed by the callback (the memory file is gone then)
+    if (m_stop) return;
+
+    // the channel of a crashed client may have been released meanwhile
+    auto& state = m_channel_states[index_];
+    if ((state.state != SChannelState::state_executing) || (state.request_seq != request_seq_)) return;
+
+    // the client has released the channel
+    auto* channel = ServiceShm::Channel(m_base_address, index_);
+    if (channel->owner.load(std::memory_order_acquire) == 0)
+    {
+      FinishCall(index_);
+      return;
+    }
+
+    // write the first chunk, the serving thread writes the others
+    state.state            = SChannelState::state_streaming;
+    state.response         = response;
+    state.response_offset  = 0;
+    channel->response_size = static_cast<std::uint64_t>(response->size());
+    WriteChunk(index_);
+  }
+
+  void CServiceShmServer::WriteChunk(size_t index_)
+  {
+    // m_sync is locked by the caller
+    auto* channel = ServiceShm::Channel(m_base_address, index_);
+    auto& state   = m_channel_states[index_];
+
+    const size_t chunk_size = std::min(state.response->size() - state.response_offset, m_payload_size);
+    if (chunk_size > 0) memcpy(ServiceShm::ResponseBuffer(channel, m_payload_size), state.response->data() + state.response_offset, chunk_size);
+    channel->chunk_size    = static_cast<std::uint64_t>(chunk_size);
+    state.response_offset += chunk_size;
+
+    // publish it, the last chunk completes the call
+    channel->chunk_seq.store(channel->chunk_seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    if (state.response_offset == state.response->size())
+    {
+      FinishCall(index_);
+    }
+
+    // wake up the client
+    m_response_events[index_]->Set();
+  }
+
+  void CServiceShmServer::FinishCall(size_t index_)
+  {
+    // m_sync is locked by the caller
+    auto& state = m_channel_states[index_];
+    state.state           = SChannelState::state_idle;
+    state.response.reset();
+    state.response_offset = 0;
+
+    ServiceShm::Channel(m_base_address, index_)->response_seq.store(state.request_seq, std::memory_order_release);
+  }
+
+  void CServiceShmServer::ReleaseCrashedClients()
+  {
+    // m_sync is locked by the caller
+    for (size_t index = 0; index < m_channel_count; ++index)
+    {
+      auto* channel = ServiceShm::Channel(m_base_address, index);
+      const std::uint32_t owner = channel->owner.load(std::memory_order_acquire);
+      if ((owner == 0) || Process::internal::IsProcessAlive(static_cast<int>(owner))) continue;
+
+      // forget the call of the crashed client (the response of an executed request is dropped)
+      auto& state = m_channel_states[index];
+      state.state           = SChannelState::state_idle;
+      state.response.reset();
+      state.response_offset = 0;
+      channel->response_seq.store(channel->request_seq.load(std::memory_order_acquire), std::memory_order_release);
+      channel->owner.store(0, std::memory_order_release);
+
+#ifndef NDEBUG
+      Logging::Log(log_level_debug2, std::string("CServiceShmServer : released channel ") + std::to_string(index) + " of crashed process " + std::to_string(owner) + " in " + m_memfile_name);
+#endif
+    }
+  }
+}
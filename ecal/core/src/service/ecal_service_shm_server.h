@@ -0,0 +1,137 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL service server shared memory transport
+**/
+
+#pragma once
+
+#include "io/shm/ecal_memfile.h"
+#include "ecal_service_shm_event.h"
+
+#include <asio.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace eCAL
+{
+  /**
+   * @brief Serves the calls of clients on the same host via a memory file (see ecal_service_shm_layout.h).
+   *
+   * A single thread watches all channels and streams the responses. The requests
+   * are executed by the callback context (worker threads), every channel has
+   * only one call in flight, so the calls of different clients are executed in
+   * parallel (like the calls of different tcp sessions). Without a callback
+   * context the requests are executed inline by the serving thread, that saves
+   * two thread hops per call but serializes the calls of all clients.
+  **/
+  class CServiceShmServer : public std::enable_shared_from_this<CServiceShmServer>
+  {
+  public:
+    using RequestCallbackT = std::function<int(const std::string&, std::string&)>;
+
+    CServiceShmServer();
+    ~CServiceShmServer();
+
+    // this object must not be copied and moved
+    CServiceShmServer(const CServiceShmServer&) = delete;
+    CServiceShmServer& operator=(const CServiceShmServer&) = delete;
+    CServiceShmServer(CServiceShmServer&&) = delete;
+    CServiceShmServer& operator=(CServiceShmServer&&) = delete;
+
+    /**
+     * @brief Create the memory file and start serving.
+     *
+     * @param request_callback_  Callback executing a serialized request.
+     * @param callback_context_  Context executing the request callbacks (nullptr = serving thread).
+     * @param channel_count_     Number of clients that can be served at the same time.
+     * @param payload_size_      Maximum request size and response chunk size [Bytes].
+     *
+     * @return  True if succeeded.
+    **/
+    bool Create(const RequestCallbackT& request_callback_, const std::shared_ptr<asio::io_context>& callback_context_, size_t channel_count_, size_t payload_size_);
+
+    /**
+     * @brief Stop serving and remove the memory file (pending client calls fail).
+    **/
+    bool Destroy();
+
+    // memory file name to be published by the service registration
+    const std::string& GetName() const { return m_memfile_name; };
+
+  private:
+    struct SRequest
+    {
+      size_t                        index;
+      std::uint64_t                 request_seq;
+      std::shared_ptr<std::string>  request;
+    };
+
+    struct SChannelState
+    {
+      enum eState
+      {
+        state_idle,
+        state_executing,
+        state_streaming,
+      };
+
+      eState                        state           = state_idle;
+      std::uint64_t                 request_seq     = 0;
+      std::shared_ptr<std::string>  response;
+      size_t                        response_offset = 0;
+    };
+
+    void ServeChannels();
+    void ServeChannel(size_t index_);
+    void ExecuteRequest(size_t index_, std::uint64_t request_seq_, const std::shared_ptr<std::string>& request_);
+    void WriteChunk(size_t index_);
+    void FinishCall(size_t index_);
+    void ReleaseCrashedClients();
+
+    RequestCallbackT                  m_request_callback;
+    std::shared_ptr<asio::io_context> m_callback_context;
+
+    std::string                   m_memfile_name;
+    CMemoryFile                   m_memfile;
+    void*                         m_base_address;
+    size_t                        m_channel_count;
+    size_t                        m_payload_size;
+
+    CServiceShmEvent                                m_request_event;
+    std::vector<std::unique_ptr<CServiceShmEvent>>  m_response_events;
+
+    std::mutex                    m_sync;             //!< guards the channel states and the memory file
+    std::vector<SChannelState>    m_channel_states;
+    std::vector<SRequest>         m_inline_requests;  //!< requests executed by the serving thread (no callback context)
+
+    std::thread                   m_thread;
+    std::atomic<bool>             m_stop;
+    bool                          m_created;
+  };
+}
@@ -20,6 +20,7 @@
 #include "ecal_service_singleton_manager.h"
 
 #include <cstddef>
+#include <ecal/ecal_config.h>
 #include <ecal/ecal_log.h>
 #include <memory>
 #include <mutex>
@@ -159,6 +160,88 @@ namespace eCAL
       return nullptr;
     }
 
+    std::shared_ptr<asio::io_context> ServiceManager::get_io_context()
+    {
+      // Quickly check the atomic stopped boolean before actually locking the
+      // mutex. It can theoretically change before we got mutex access, so we
+      // will have to check it again.
+      if (stopped)
+        return nullptr;
+
+      // The io_context is run by the io threads, as soon as a client or
+      // server manager has been created
+      const std::lock_guard<std::mutex> singleton_lock(singleton_mutex);
+      if (!stopped && !io_threads.empty())
+        return io_context;
+
+      return nullptr;
+    }
+
+    std::shared_ptr<asio::io_context> ServiceManager::get_server_worker_context()
+    {
+      // Quickly check the atomic stopped boolean before actually locking the
+      // mutex. It can theoretically change before we got mutex access, so we
+      // will have to check it again.
+      if (stopped)
+        return nullptr;
+
+      // No worker threads configured, the service callbacks are executed by
+      // the io threads
+      const size_t num_worker_threads = Config::Experimental::GetServiceServerWorkerThreadCount();
+      if (num_worker_threads == 0)
+        return nullptr;
+
+      // Lock the mutex to actually make it thread safe
+      const std::lock_guard<std::mutex> singleton_lock(singleton_mutex);
+      if (!stopped)
+      {
+        // Create the worker io_context and keep it alive with a work object,
+        // until the service manager is stopped
+        if (!server_worker_context)
+        {
+          server_worker_context = std::make_shared<asio::io_context>();
+          server_worker_work    = std::make_unique<asio::io_context::work>(*server_worker_context);
+        }
+
+        // Start worker threads, if necessary
+        if (server_worker_threads.empty())
+        {
+          for (size_t i = 0; i < num_worker_threads; i++)
+          {
+            server_worker_threads.emplace_back(std::make_unique<std::thread>([this]() { server_worker_context->run(); }));
+          }
+        }
+
+        return server_worker_context;
+      }
+      return nullptr;
+    }
+
+    std::shared_ptr<asio::io_context> ServiceManager::get_client_timer_context()
+    {
+      // Quickly check the atomic stopped boolean before actually locking the
+      // mutex. It can theoretically change before we got mutex access, so we
+      // will have to check it again.
+      if (stopped)
+        return nullptr;
+
+      // Lock the mutex to actually make it thread safe
+      const std::lock_guard<std::mutex> singleton_lock(singleton_mutex);
+      if (!stopped)
+      {
+        // One thread runs the timeout timers of all asynchronous client calls
+        if (!client_timer_context)
+        {
+          client_timer_context = std::make_shared<asio::io_context>();
+          client_timer_work    = std::make_unique<asio::io_context::work>(*client_timer_context);
+          client_timer_thread  = std::make_unique<std::thread>([context = client_timer_context]() { context->run(); });
+        }
+
+        return client_timer_context;
+      }
+      return nullptr;
+    }
+
     void ServiceManager::stop()
     {
       const std::lock_guard<std::mutex> singleton_lock(singleton_mutex);
@@ -171,13 +254,36 @@ namespace eCAL
       if (client_manager)
         client_manager->stop();
 
+      // The worker io_context runs out of work, when all pending service
+      // callbacks have been executed
+      server_worker_work.reset();
+
       for (const auto& thread : io_threads)
         thread->join();
 
+      for (const auto& thread : server_worker_threads)
+        thread->join();
+
+      // Pending call timers must not delay the shutdown, their handlers are
+      // dropped (the client sessions are stopped already, so the calls have
+      // been failed anyway)
+      client_timer_work.reset();
+      if (client_timer_context)
+        client_timer_context->stop();
+      if (client_timer_thread)
+        client_timer_thread->join();
+
       server_manager.reset();
       client_manager.reset();
       io_threads.clear();
+      server_worker_threads.clear();
+      client_timer_thread.reset();
+
+      // The sessions (destroyed with the io_context) use strands of the
+      // worker io_context, so the worker io_context has to be destroyed last
       io_context.reset();
+      server_worker_context.reset();
+      client_timer_context.reset();
     }
 
     void ServiceManager::reset()
@@ -61,6 +61,9 @@ namespace eCAL
 	public:
 	  std::shared_ptr<eCAL::service::ClientManager> get_client_manager();
 	  std::shared_ptr<eCAL::service::ServerManager> get_server_manager();
+	  std::shared_ptr<asio::io_context>             get_io_context();
+	  std::shared_ptr<asio::io_context>             get_server_worker_context();
+	  std::shared_ptr<asio::io_context>             get_client_timer_context();
 
 	  void stop();
 	  void reset();
@@ -79,6 +82,14 @@ namespace eCAL
 
 	  std::shared_ptr<eCAL::service::ClientManager> client_manager;
       std::shared_ptr<eCAL::service::ServerManager> server_manager;
+
+      std::shared_ptr<asio::io_context>             server_worker_context;
+      std::unique_ptr<asio::io_context::work>       server_worker_work;
+      std::vector<std::unique_ptr<std::thread>>     server_worker_threads;
+
+      std::shared_ptr<asio::io_context>             client_timer_context;
+      std::unique_ptr<asio::io_context::work>       client_timer_work;
+      std::unique_ptr<std::thread>                  client_timer_thread;
 	};
 
   }
@@ -0,0 +1,149 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL bounded lock-free multi producer / multi consumer queue
+**/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace eCAL
+{
+  namespace Util
+  {
+    /**
+    * @brief Bounded MPMC queue (D. Vyukov), the capacity is fixed on construction.
+    *
+    * Every cell carries a sequence number telling producers and consumers
+    * if it is free (2 * pos) or filled (2 * pos + 1) for their position,
+    * so Push / Pop never lock. The doubled sequence keeps both states
+    * apart for a capacity of one element as well.
+    * Elements are swapped in and out, so buffers inside the elements are
+    * recycled instead of reallocated for every sample.
+    **/
+    template<class T>
+    class CBoundedQueue
+    {
+    public:
+      explicit CBoundedQueue(size_t capacity_) :
+        m_capacity(capacity_ > 0 ? capacity_ : 1),
+        m_cells(new SCell[m_capacity]),
+        m_push_pos(0),
+        m_pop_pos(0)
+      {
+        for (size_t idx = 0; idx < m_capacity; ++idx)
+        {
+          m_cells[idx].sequence.store(2 * idx, std::memory_order_relaxed);
+        }
+      }
+
+      CBoundedQueue(const CBoundedQueue&) = delete;
+      CBoundedQueue& operator=(const CBoundedQueue&) = delete;
+
+      size_t Capacity() const { return m_capacity; }
+
+      // swap item_ into the queue, false if the queue is full
+      bool Push(T& item_)
+      {
+        size_t pos = m_push_pos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+          SCell& cell = m_cells[pos % m_capacity];
+          const size_t seq = cell.sequence.load(std::memory_order_acquire);
+          const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(2 * pos);
+          if (diff == 0)
+          {
+            if (m_push_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+              std::swap(cell.item, item_);
+              cell.sequence.store(2 * pos + 1, std::memory_order_release);
+              return true;
+            }
+          }
+          else if (diff < 0)
+          {
+            // cell still filled from the last round
+            return false;
+          }
+          else
+          {
+            pos = m_push_pos.load(std::memory_order_relaxed);
+          }
+        }
+      }
+
+      // swap the oldest element out into item_, false if the queue is empty
+      bool Pop(T& item_)
+      {
+        size_t pos = m_pop_pos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+          SCell& cell = m_cells[pos % m_capacity];
+          const size_t seq = cell.sequence.load(std::memory_order_acquire);
+          const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(2 * pos + 1);
+          if (diff == 0)
+          {
+            if (m_pop_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+              std::swap(cell.item, item_);
+              cell.sequence.store(2 * (pos + m_capacity), std::memory_order_release);
+              return true;
+            }
+          }
+          else if (diff < 0)
+          {
+            // cell not filled yet
+            return false;
+          }
+          else
+          {
+            pos = m_pop_pos.load(std::memory_order_relaxed);
+          }
+        }
+      }
+
+      // approximate number of queued elements
+      size_t Size() const
+      {
+        const size_t push_pos = m_push_pos.load(std::memory_order_relaxed);
+        const size_t pop_pos  = m_pop_pos.load(std::memory_order_relaxed);
+        return (push_pos > pop_pos) ? push_pos - pop_pos : 0;
+      }
+
+    private:
+      struct SCell
+      {
+        std::atomic<size_t> sequence;
+        T                   item;
+      };
+
+      const size_t              m_capacity;
+      std::unique_ptr<SCell[]>  m_cells;
+
+      // keep producer and consumer position on separate cache lines
+      alignas(64) std::atomic<size_t> m_push_pos;
+      alignas(64) std::atomic<size_t> m_pop_pos;
+    };
+  }
+}
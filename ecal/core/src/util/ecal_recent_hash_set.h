@@ -0,0 +1,148 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL fixed size set of the most recently inserted hash values
+**/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace eCAL
+{
+  namespace Util
+  {
+    /**
+    * @brief Remembers the last Capacity inserted hash values (oldest are evicted first).
+    *
+    * Open addressing (linear probing) table with a load factor <= 0.5, so lookup
+    * and insertion are O(1) and do not allocate. A ring of the inserted values
+    * defines the eviction order.
+    **/
+    template<size_t Capacity>
+    class CRecentHashSet
+    {
+      static_assert(Capacity > 0, "CRecentHashSet capacity must not be zero");
+
+    public:
+      CRecentHashSet()
+      {
+        Clear();
+      }
+
+      void Clear()
+      {
+        for (auto& slot : m_table) slot.used = false;
+        m_ring_pos = 0;
+        m_count    = 0;
+      }
+
+      bool Contains(uint64_t hash_) const
+      {
+        for (size_t idx = Index(hash_); m_table[idx].used; idx = (idx + 1) & table_mask)
+        {
+          if (m_table[idx].hash == hash_) return true;
+        }
+        return false;
+      }
+
+      // insert hash_, false if it is contained already
+      bool Insert(uint64_t hash_)
+      {
+        if (Contains(hash_)) return false;
+
+        // evict the oldest entry
+        if (m_count == Capacity)
+        {
+          Erase(m_ring[m_ring_pos]);
+          m_count--;
+        }
+
+        size_t idx = Index(hash_);
+        while (m_table[idx].used) idx = (idx + 1) & table_mask;
+        m_table[idx].hash = hash_;
+        m_table[idx].used = true;
+
+        m_ring[m_ring_pos] = hash_;
+        m_ring_pos = (m_ring_pos + 1) % Capacity;
+        m_count++;
+
+        return true;
+      }
+
+      size_t Size() const { return m_count; }
+
+    private:
+      static constexpr size_t TableSize()
+      {
+        size_t size = 1;
+        while (size < 2 * Capacity) size *= 2;
+        return size;
+      }
+      static constexpr size_t table_size = TableSize();
+      static constexpr size_t table_mask = table_size - 1;
+
+      struct SSlot
+      {
+        uint64_t hash = 0;
+        bool     used = false;
+      };
+
+      static size_t Index(uint64_t hash_)
+      {
+        // fibonacci hashing, input hashes may have weak low bits
+        return static_cast<size_t>((hash_ * 11400714819323198485ull) >> 32) & table_mask;
+      }
+
+      void Erase(uint64_t hash_)
+      {
+        size_t idx = Index(hash_);
+        for (;;)
+        {
+          if (!m_table[idx].used)          return;
+          if (m_table[idx].hash == hash_)  break;
+          idx = (idx + 1) & table_mask;
+        }
+
+        // backward shift deletion keeps the probe sequences intact without tombstones
+        size_t next = (idx + 1) & table_mask;
+        while (m_table[next].used)
+        {
+          const size_t home = Index(m_table[next].hash);
+          // move the entry if its home slot is not in (idx, next]
+          if (((next - home) & table_mask) >= ((next - idx) & table_mask))
+          {
+            m_table[idx] = m_table[next];
+            idx = next;
+          }
+          next = (next + 1) & table_mask;
+        }
+        m_table[idx].used = false;
+      }
+
+      std::array<SSlot, table_size>  m_table;
+      std::array<uint64_t, Capacity> m_ring{};
+      size_t                         m_ring_pos = 0;
+      size_t                         m_count    = 0;
+    };
+  }
+}
@@ -0,0 +1,153 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL read mostly topic name index (copy on write snapshots)
+**/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace eCAL
+{
+  namespace Util
+  {
+    /**
+    * @brief Topic name -> entities index for the receive hot path.
+    *
+    * Lookups work on an immutable snapshot and never wait for a modification.
+    * Loading the snapshot pointer (std::atomic_load on a shared_ptr) is not
+    * lock free on common standard libraries, it briefly takes a lock of a
+    * global lock pool for the reference count update. Modifications (rare,
+    * entity creation / destruction) copy the snapshot and publish the new one.
+    * With a SLookupCache the map lookup and the snapshot load are done once
+    * per topic and only repeated after the index changed, a cache hit is a
+    * single atomic load of the version.
+    **/
+    template<class T>
+    class CTopicIndex
+    {
+    public:
+      using EntityListT     = std::vector<std::shared_ptr<T>>;
+      using EntityListPtrT  = std::shared_ptr<const EntityListT>;
+      using SnapshotT       = std::unordered_map<std::string, EntityListPtrT>;
+      using SnapshotPtrT    = std::shared_ptr<const SnapshotT>;
+
+      // lookup result of one topic, valid as long as the index version did not change
+      struct SLookupCache
+      {
+        uint64_t       version = 0;
+        EntityListPtrT entities;
+      };
+
+      CTopicIndex() : m_snapshot(std::make_shared<const SnapshotT>()), m_version(1) {}
+
+      void Add(const std::string& topic_name_, const std::shared_ptr<T>& entity_)
+      {
+        const std::lock_guard<std::mutex> lock(m_modify_sync);
+        auto snapshot = std::make_shared<SnapshotT>(*std::atomic_load(&m_snapshot));
+
+        auto entities = std::make_shared<EntityListT>();
+        auto iter = snapshot->find(topic_name_);
+        if (iter != snapshot->end()) *entities = *iter->second;
+        entities->push_back(entity_);
+        (*snapshot)[topic_name_] = entities;
+
+        Publish(snapshot);
+      }
+
+      bool Remove(const std::string& topic_name_, const std::shared_ptr<T>& entity_)
+      {
+        const std::lock_guard<std::mutex> lock(m_modify_sync);
+        const SnapshotPtrT current = std::atomic_load(&m_snapshot);
+
+        auto current_iter = current->find(topic_name_);
+        if (current_iter == current->end()) return false;
+        const EntityListT& current_entities = *current_iter->second;
+        auto entity_iter = std::find(current_entities.begin(), current_entities.end(), entity_);
+        if (entity_iter == current_entities.end()) return false;
+
+        auto snapshot = std::make_shared<SnapshotT>(*current);
+        if (current_entities.size() == 1)
+        {
+          snapshot->erase(topic_name_);
+        }
+        else
+        {
+          auto entities = std::make_shared<EntityListT>(current_entities);
+          entities->erase(entities->begin() + (entity_iter - current_entities.begin()));
+          (*snapshot)[topic_name_] = entities;
+        }
+
+        Publish(snapshot);
+        return true;
+      }
+
+      // entities of a topic (nullptr if there are none), loads the current snapshot
+      EntityListPtrT Find(const std::string& topic_name_) const
+      {
+        const SnapshotPtrT snapshot = std::atomic_load(&m_snapshot);
+        auto iter = snapshot->find(topic_name_);
+        if (iter == snapshot->end()) return nullptr;
+        return iter->second;
+      }
+
+      // entities of a topic, looked up again only if the index changed since the last call
+      // (a cache belongs to one thread)
+      const EntityListPtrT& Find(const std::string& topic_name_, SLookupCache& cache_) const
+      {
+        const uint64_t version = m_version.load(std::memory_order_acquire);
+        if (cache_.version != version)
+        {
+          cache_.entities = Find(topic_name_);
+          cache_.version  = version;
+        }
+        return cache_.entities;
+      }
+
+      // complete index for iterating all entities
+      SnapshotPtrT GetSnapshot() const
+      {
+        return std::atomic_load(&m_snapshot);
+      }
+
+    protected:
+      void Publish(const SnapshotPtrT& snapshot_)
+      {
+        // called with locked m_modify_sync
+        // the version is incremented after the snapshot is published,
+        // so a cache never stores an outdated snapshot with the current version
+        std::atomic_store(&m_snapshot, snapshot_);
+        m_version.fetch_add(1, std::memory_order_acq_rel);
+      }
+
+      std::mutex            m_modify_sync;
+      SnapshotPtrT          m_snapshot;
+      std::atomic<uint64_t> m_version;
+    };
+  }
+}
@@ -132,7 +132,7 @@ namespace eCAL
        * =========================================================================
        * 
        * @param io_context        The io_context to use for the session and all callbacks.
-       * @param protocol_version  The protocol version to use for the session. When this is 0, the legacy buggy protocol is used.
+       * @param protocol_version  The protocol version to use for the session. When this is 0, the legacy buggy protocol is used. Otherwise, this is the highest protocol version the session will negotiate with the server. Since protocol version 2, multiple service calls are sent to the server without waiting for the previous responses.
        * @param address           The address of the server to connect to. May be an IP or a Hostname, IPv6 is supported.
        * @param port              The port of the server to connect to.
        * @param event_callback    The callback to be called when the session's state changes, i.e. when the session successfully connected to a server or disconnected from it.
@@ -106,10 +106,10 @@ namespace eCAL
        * =========================================================================
        * 
        * @param io_context                      The io_context to use for the server and all callbacks
-       * @param protocol_version                The protocol version to use. When this is 0, the buggy protocol version 0 will be used.
+       * @param protocol_version                The protocol version to use. When this is 0, the buggy protocol version 0 will be used. Otherwise, this is the highest protocol version the server will negotiate with a client. Since protocol version 2, a client may send multiple requests without waiting for the previous responses.
        * @param port                            The port to listen on. When this is 0, the OS will chose a free port.
        * @param service_callback                The callback to use for service calls. Will be executed in the context of the io_context.
-       * @param parallel_service_calls_enabled  When true, service calls will be executed in parallel. When false, service calls will be executed sequentially.
+       * @param parallel_service_calls_enabled  When true, service calls will be executed in parallel. When false, service calls will be executed sequentially. With protocol version 2, parallel calls may also come from the same client and be answered out of order.
        * @param event_callback                  The callback to use for events (clients connect or clients disconnect). Will be executed in the context of the io_context.
        * @param logger                          A function used for logging.
        * @param delete_callback                 A callback that will be executed when the server is deleted.
@@ -125,6 +125,31 @@ namespace eCAL
                                           , const LoggerT&                           logger
                                           , const DeleteCallbackT&                   delete_callback);
 
+      /**
+       * @brief Creates a new Server instance, that executes the service callbacks in a separate io_context.
+       * 
+       * The network communication is still handled by io_context. The service
+       * callbacks are executed by the threads running service_callback_io_context,
+       * so long running service calls do not block the network communication of
+       * other servers and clients sharing io_context. Calls of the same client
+       * are always executed sequentially.
+       * 
+       * @param service_callback_io_context  The io_context executing the service callbacks. Must outlive the server and all of its sessions. If nullptr, the io_context is used.
+       * 
+       * See the create() function above for all other parameters.
+       * 
+       * @return The new server instance.
+       */
+      static std::shared_ptr<Server> create(const std::shared_ptr<asio::io_context>& io_context
+                                          , std::uint8_t                             protocol_version
+                                          , std::uint16_t                            port
+                                          , const ServiceCallbackT&                  service_callback
+                                          , bool                                     parallel_service_calls_enabled
+                                          , const std::shared_ptr<asio::io_context>& service_callback_io_context
+                                          , const EventCallbackT&                    event_callback
+                                          , const LoggerT&                           logger
+                                          , const DeleteCallbackT&                   delete_callback);
+
       static std::shared_ptr<Server> create(const std::shared_ptr<asio::io_context>& io_context
                                           , std::uint8_t                             protocol_version
                                           , std::uint16_t                            port
@@ -146,6 +171,7 @@ namespace eCAL
             , std::uint16_t                           port
             , const ServiceCallbackT&                 service_callback
             , bool                                    parallel_service_calls_enabled
+            , const std::shared_ptr<asio::io_context>& service_callback_io_context
             , const EventCallbackT&                   event_callback
             , const LoggerT&                          logger);
 
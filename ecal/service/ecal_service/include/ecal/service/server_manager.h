@@ -143,6 +143,25 @@ namespace eCAL
                                           , bool                            parallel_service_calls_enabled
                                           , const Server::EventCallbackT&   event_callback);
 
+      /**
+       * @brief Create a new server instance, that executes its service callbacks in a separate io_context.
+       * 
+       * Same as the create_server() function above, but the service callbacks
+       * are executed by the threads running service_callback_io_context instead
+       * of the io_context of this manager. The network communication is still
+       * handled by the io_context of this manager.
+       * 
+       * @param service_callback_io_context  The io_context executing the service callbacks. Must outlive the server and all of its sessions. If nullptr, the io_context is used.
+       * 
+       * @return a shared pointer to the created server
+       */
+      std::shared_ptr<Server> create_server(std::uint8_t                             protocol_version
+                                          , std::uint16_t                            port
+                                          , const Server::ServiceCallbackT&          service_callback
+                                          , bool                                     parallel_service_calls_enabled
+                                          , const std::shared_ptr<asio::io_context>& service_callback_io_context
+                                          , const Server::EventCallbackT&            event_callback);
+
       /**
        * @brief Get the number of servers, that are currently managed by this server manager
        * @return The number of servers
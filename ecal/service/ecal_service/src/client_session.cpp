@@ -82,7 +82,7 @@ namespace eCAL
       }
       else
       {
-        impl_ = ClientSessionV1::create(io_context, address, port, event_callback, logger);
+        impl_ = ClientSessionV1::create(io_context, protocol_version, address, port, event_callback, logger);
       }
     }
 
@@ -23,6 +23,7 @@
 #include "log_helpers.h"
 #include "log_defs.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
@@ -43,12 +44,13 @@ namespace eCAL
     // Constructor, Destructor, Create
     /////////////////////////////////////
     std::shared_ptr<ClientSessionV1> ClientSessionV1::create(const std::shared_ptr<asio::io_context>& io_context
+                                                            , std::uint8_t                            max_protocol_version
                                                             , const std::string&                      address
                                                             , std::uint16_t                           port
                                                             , const EventCallbackT&                   event_callback
                                                             , const LoggerT&                          logger)
     {
-      std::shared_ptr<ClientSessionV1> instance(new ClientSessionV1(io_context, address, port, event_callback, logger));
+      std::shared_ptr<ClientSessionV1> instance(new ClientSessionV1(io_context, max_protocol_version, address, port, event_callback, logger));
 
       instance->resolve_endpoint();
 
@@ -56,6 +58,7 @@ namespace eCAL
     }
 
     ClientSessionV1::ClientSessionV1(const std::shared_ptr<asio::io_context>& io_context
+                                    , std::uint8_t                            max_protocol_version
                                     , const std::string&                      address
                                     , std::uint16_t                           port
                                     , const EventCallbackT&                   event_callback
@@ -63,6 +66,7 @@ namespace eCAL
       : ClientSessionBase(io_context, event_callback)
       , address_                  (address)
       , port_                     (port)
+      , max_protocol_version_     (std::min(std::max(max_protocol_version, MIN_SUPPORTED_PROTOCOL_VERSION), MAX_SUPPORTED_PROTOCOL_VERSION))
       , service_call_queue_strand_(*io_context)
       , resolver_                 (*io_context)
       , logger_                   (logger)
@@ -70,6 +74,9 @@ namespace eCAL
       , state_                    (State::NOT_CONNECTED)
       , stopped_by_user_          (false)
       , service_call_in_progress_ (false)
+      , next_request_id_          (0)
+      , max_pending_requests_     (0)
+      , send_in_progress_         (false)
     {
       ECAL_SERVICE_LOG_DEBUG_VERBOSE(logger_, "Created");
     }
@@ -185,7 +192,7 @@ namespace eCAL
       payload_buffer->resize(sizeof(ProtocolHandshakeRequestMessage), '\0');
       ProtocolHandshakeRequestMessage* handshake_request_message = reinterpret_cast<ProtocolHandshakeRequestMessage*>(const_cast<char*>(payload_buffer->data()));
       handshake_request_message->min_supported_protocol_version = MIN_SUPPORTED_PROTOCOL_VERSION;
-      handshake_request_message->max_supported_protocol_version = MAX_SUPPORTED_PROTOCOL_VERSION;
+      handshake_request_message->max_supported_protocol_version = max_protocol_version_;
 
       // Fill TCP Header
       header_buffer->package_size_n = htonl(sizeof(ProtocolHandshakeRequestMessage));
@@ -245,11 +252,12 @@ namespace eCAL
                                   const ProtocolHandshakeResponseMessage* handshake_response = reinterpret_cast<const ProtocolHandshakeResponseMessage*>(payload_buffer->data());
 
                                   if ((handshake_response->accepted_protocol_version >= MIN_SUPPORTED_PROTOCOL_VERSION)
-                                    && (handshake_response->accepted_protocol_version <= MIN_SUPPORTED_PROTOCOL_VERSION))
+                                    && (handshake_response->accepted_protocol_version <= me->max_protocol_version_))
                                   {
                                     {
                                       const std::lock_guard<std::mutex> lock(me->service_state_mutex_);
                                       me->accepted_protocol_version_ = handshake_response->accepted_protocol_version;
+                                      me->max_pending_requests_      = ntohs(handshake_response->max_pending_requests_n);
                                       me->state_ = State::CONNECTED;
                                     }
 
@@ -262,7 +270,16 @@ namespace eCAL
                                     // Start sending service requests, if there are any
                                     {
                                       const std::lock_guard<std::mutex> lock(me->service_state_mutex_);
-                                      if (!me->service_call_queue_.empty())
+                                      if (me->accepted_protocol_version_ >= 2)
+                                      {
+                                        // Since protocol version 2 we send as many queued
+                                        // requests as the server accepts at once. The receive
+                                        // loop also notifies us, when the server closes the
+                                        // connection, so there is no need for error-peeking.
+                                        me->send_queued_pipelined_service_requests();
+                                        me->receive_pipelined_service_responses();
+                                      }
+                                      else if (!me->service_call_queue_.empty())
                                       {
                                         // If there are service calls in the queue, we send the next one.
                                         me->service_call_in_progress_ = true;
@@ -323,7 +340,15 @@ namespace eCAL
                                     // If we are  not in failed state, let's check
                                     // whether we directly invoke the call of if we add it to the queue
 
-                                    if (!me->service_call_in_progress_ && (me->state_ == State::CONNECTED))
+                                    if ((me->state_ == State::CONNECTED) && (me->accepted_protocol_version_ >= 2))
+                                    {
+                                      // Since protocol version 2 we only have to wait, if
+                                      // the server already has too many of our requests.
+                                      // The queue keeps the requests in order.
+                                      me->service_call_queue_.push_back(ServiceCall{request, response_callback});
+                                      me->send_queued_pipelined_service_requests();
+                                    }
+                                    else if (!me->service_call_in_progress_ && (me->state_ == State::CONNECTED))
                                     {
                                       // Directly call the the service, iff
                                       // 
@@ -473,6 +498,136 @@ namespace eCAL
 
     }
 
+    void ClientSessionV1::send_pipelined_service_request(const std::shared_ptr<const std::string>& request, const ResponseCallbackT& response_cb)
+    {
+      // The service_state_mutex_ must be locked when calling this function
+
+      const std::uint64_t request_id = next_request_id_++;
+      pending_service_calls_.emplace(request_id, response_cb);
+
+      // Create header_buffer
+      const std::shared_ptr<TcpHeaderV1>  header_buffer  = std::make_shared<TcpHeaderV1>();
+      header_buffer->package_size_n = htonl(static_cast<std::uint32_t>(request->size()));
+      header_buffer->version        = accepted_protocol_version_;
+      header_buffer->message_type   = MessageType::ServiceRequest;
+      header_buffer->header_size_n  = htons(sizeof(TcpHeaderV1));
+      header_buffer->request_id     = request_id;
+
+      send_queue_.emplace_back(header_buffer, request);
+
+      if (!send_in_progress_)
+      {
+        send_in_progress_ = true;
+        send_next_queued_service_request();
+      }
+    }
+
+    void ClientSessionV1::send_next_queued_service_request()
+    {
+      // The service_state_mutex_ must be locked when calling this function
+
+      ECAL_SERVICE_LOG_DEBUG(logger_, "[" + get_connection_info_string(socket_) + "] " + "Sending service request " + std::to_string(send_queue_.front().first->request_id) + "...");
+
+      eCAL::service::ProtocolV1::async_send_payload(socket_, socket_mutex_, send_queue_.front().first, send_queue_.front().second
+                              , service_call_queue_strand_.wrap([me = shared_from_this()](asio::error_code ec)
+                                {
+                                  const std::string message = "Failed sending service request: " + ec.message();
+                                  me->logger_(LogLevel::Error, "[" + get_connection_info_string(me->socket_) + "] " + message);
+
+                                  // Unwind all pending service calls and call the event callback
+                                  me->handle_connection_loss_error(message);
+                                })
+                              , service_call_queue_strand_.wrap([me = shared_from_this()]()
+                                {
+                                  ECAL_SERVICE_LOG_DEBUG_VERBOSE(me->logger_, "[" + get_connection_info_string(me->socket_) + "] " + "Successfully sent service request.");
+
+                                  const std::lock_guard<std::mutex> lock(me->service_state_mutex_);
+
+                                  // The send queue has already been cleared, if the connection was lost
+                                  if (me->state_ == State::FAILED)
+                                    return;
+
+                                  me->send_queue_.pop_front();
+
+                                  if (me->send_queue_.empty())
+                                    me->send_in_progress_ = false;
+                                  else
+                                    me->send_next_queued_service_request();
+                                }));
+    }
+
+    void ClientSessionV1::send_queued_pipelined_service_requests()
+    {
+      // The service_state_mutex_ must be locked when calling this function
+      while (!service_call_queue_.empty()
+            && ((max_pending_requests_ == 0) || (pending_service_calls_.size() < max_pending_requests_)))
+      {
+        send_pipelined_service_request(service_call_queue_.front().request, service_call_queue_.front().response_cb);
+        service_call_queue_.pop_front();
+      }
+    }
+
+    void ClientSessionV1::receive_pipelined_service_responses()
+    {
+      ECAL_SERVICE_LOG_DEBUG_VERBOSE(logger_, "[" + get_connection_info_string(socket_) + "] " + "Waiting for service response...");
+
+      eCAL::service::ProtocolV1::async_receive_payload(socket_, socket_mutex_
+                            , service_call_queue_strand_.wrap([me = shared_from_this()](asio::error_code ec)
+                              {
+                                const std::string message = "Failed receiving service response: " + ec.message();
+                                me->logger_(LogLevel::Info, "[" + get_connection_info_string(me->socket_) + "] " + message);
+
+                                // Unwind all pending service calls and call the event callback
+                                me->handle_connection_loss_error(message);
+                              })
+                            , service_call_queue_strand_.wrap([me = shared_from_this()](const std::shared_ptr<std::vector<char>>& header_buffer, const std::shared_ptr<std::string>& payload_buffer)
+                              {
+                                const TcpHeaderV1* header = reinterpret_cast<const TcpHeaderV1*>(header_buffer->data());
+                                if (header->message_type != eCAL::service::MessageType::ServiceResponse)
+                                {
+                                  const std::string message = "Received invalid service response from server. Expected message type " 
+                                                              + std::to_string(static_cast<std::uint8_t>(eCAL::service::MessageType::ServiceResponse)) 
+                                                              + ", but received " + std::to_string(static_cast<std::uint8_t>(header->message_type));
+                                  me->logger_(LogLevel::Fatal, "[" + get_connection_info_string(me->socket_) + "] " + message);
+                                  me->handle_connection_loss_error(message);
+                                  return;
+                                }
+
+                                const std::uint64_t request_id = header->request_id;
+
+                                // Find the callback that belongs to the response
+                                ResponseCallbackT response_cb;
+                                {
+                                  const std::lock_guard<std::mutex> lock(me->service_state_mutex_);
+                                  auto pending_service_call = me->pending_service_calls_.find(request_id);
+                                  if (pending_service_call != me->pending_service_calls_.end())
+                                  {
+                                    response_cb = std::move(pending_service_call->second);
+                                    me->pending_service_calls_.erase(pending_service_call);
+
+                                    // The server accepts another request now
+                                    me->send_queued_pipelined_service_requests();
+                                  }
+                                }
+
+                                if (!response_cb)
+                                {
+                                  const std::string message = "Received service response for unknown request id " + std::to_string(request_id);
+                                  me->logger_(LogLevel::Fatal, "[" + get_connection_info_string(me->socket_) + "] " + message);
+                                  me->handle_connection_loss_error(message);
+                                  return;
+                                }
+
+                                ECAL_SERVICE_LOG_DEBUG(me->logger_, "[" + get_connection_info_string(me->socket_) + "] " + "Successfully received service response " + std::to_string(request_id) + " of " + std::to_string(payload_buffer->size()) + " bytes");
+
+                                // Call the user's callback
+                                response_cb(Error::OK, payload_buffer);
+
+                                // Wait for the next response
+                                me->receive_pipelined_service_responses();
+                              }));
+    }
+
     //////////////////////////////////////
     // Status API
     //////////////////////////////////////
@@ -501,7 +656,7 @@ namespace eCAL
     int ClientSessionV1::get_queue_size() const
     {
       const std::lock_guard<std::mutex> lock(service_state_mutex_);
-      return static_cast<int>(service_call_queue_.size());
+      return static_cast<int>(service_call_queue_.size() + pending_service_calls_.size());
     }
 
     //////////////////////////////////////
@@ -553,6 +708,15 @@ namespace eCAL
         // Set the state to FAILED
         state_ = State::FAILED;
 
+        // Pipelined service calls (protocol version 2) that are still waiting
+        // for their response are failed just like the queued ones
+        for (auto& pending_service_call : pending_service_calls_)
+        {
+          service_call_queue_.push_back(ServiceCall{nullptr, std::move(pending_service_call.second)});
+        }
+        pending_service_calls_.clear();
+        send_queue_.clear();
+
         // call all callbacks from the queue with an error
         if (!service_call_queue_.empty())
         {
@@ -20,14 +20,17 @@
 #pragma once
 
 #include "client_session_impl_base.h"
+#include "protocol_layout.h"
 #include <atomic>
 #include <cstdint>
 #include <ecal/service/logger.h>
 
 #include <deque>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 
 namespace eCAL
 {
@@ -52,6 +55,7 @@ namespace eCAL
     /////////////////////////////////////
     public:
       static std::shared_ptr<ClientSessionV1> create(const std::shared_ptr<asio::io_context>& io_context
+                                                    , std::uint8_t                            max_protocol_version
                                                     , const std::string&                      address
                                                     , std::uint16_t                           port
                                                     , const EventCallbackT&                   event_callback
@@ -59,6 +63,7 @@ namespace eCAL
 
     protected:
       ClientSessionV1(const std::shared_ptr<asio::io_context>& io_context
+                    , std::uint8_t                             max_protocol_version
                     , const std::string&                       address
                     , std::uint16_t                            port
                     , const EventCallbackT&                    event_callback
@@ -93,6 +98,23 @@ namespace eCAL
     private:
       void send_next_service_request(const std::shared_ptr<const std::string>& request, const ResponseCallbackT& response_cb);
       void receive_service_response(const ResponseCallbackT& response_cb);
+
+      /**
+       * @brief Service calls for protocol version 2 and newer.
+       *
+       * Each request gets a request id and is sent right away, without
+       * waiting for the response of the previous request. All responses are
+       * received by a single receive loop and are matched to their callback
+       * by the request id, so they may arrive in any order.
+       *
+       * The server announces in the handshake how many requests may be in
+       * flight. Further requests stay in the service_call_queue_ until a
+       * response has been received.
+       */
+      void send_pipelined_service_request(const std::shared_ptr<const std::string>& request, const ResponseCallbackT& response_cb);
+      void send_queued_pipelined_service_requests();
+      void send_next_queued_service_request();
+      void receive_pipelined_service_responses();
     
     //////////////////////////////////////
     // Status API
@@ -142,10 +164,11 @@ namespace eCAL
     //////////////////////////////////////
     private:
       static constexpr std::uint8_t MIN_SUPPORTED_PROTOCOL_VERSION = 1;
-      static constexpr std::uint8_t MAX_SUPPORTED_PROTOCOL_VERSION = 1;
+      static constexpr std::uint8_t MAX_SUPPORTED_PROTOCOL_VERSION = 2;
 
       const std::string         address_;                                       //!< The original address that this client was created with.
       const std::uint16_t       port_;                                          //!< The original port that this client was created with.
+      const std::uint8_t        max_protocol_version_;                          //!< The highest protocol version this client negotiates. Never larger than MAX_SUPPORTED_PROTOCOL_VERSION.
 
       asio::io_context::strand  service_call_queue_strand_;
       asio::ip::tcp::resolver   resolver_;
@@ -159,6 +182,13 @@ namespace eCAL
 
       std::deque<ServiceCall>   service_call_queue_;
       bool                      service_call_in_progress_;
+
+      // Protocol version 2 and newer. Protected by service_state_mutex_.
+      std::uint64_t                                                                           next_request_id_;
+      std::uint16_t                                                                           max_pending_requests_;    //!< Announced by the server in the handshake. 0 means unlimited.
+      std::map<std::uint64_t, ResponseCallbackT>                                              pending_service_calls_;   //!< Requests that have been sent (or are about to be sent), but have not been answered, yet.
+      std::deque<std::pair<std::shared_ptr<TcpHeaderV1>, std::shared_ptr<const std::string>>> send_queue_;              //!< Only one request is written at a time, so they don't interleave.
+      bool                                                                                    send_in_progress_;
     };
   }
 }
@@ -46,13 +46,17 @@ namespace eCAL
     // TCP Header
     //   - Used for service request since protocol version 1
     //   - Used for response since protocol version 0
+    //   - The request_id is used since protocol version 2. It is chosen by the
+    //     client and copied into the matching response by the server, so its
+    //     byte order is up to the client. Until protocol version 1 the field is
+    //     reserved and always 0.
     struct TcpHeaderV1
     {
       std::uint32_t package_size_n = 0;                        // package size in network byte order
       std::uint8_t  version        = 0;                        // protocol version                    (since protocol V1 / eCAL 5.12)
       MessageType   message_type   = MessageType::Undefined;   // message type                        (since protocol V1 / eCAL 5.12)
       std::uint16_t header_size_n  = 0;                        // header size in network byte order   (since protocol V1 / eCAL 5.12)
-      std::uint64_t reserved       = 0;                        // reserved
+      std::uint64_t request_id     = 0;                        // request id                          (since protocol V2, reserved before)
     };
 
     // Handshake Request Message, since protocol v1
@@ -63,9 +67,14 @@ namespace eCAL
     };
 
     // Handshake Response Message, since protocol v1
+    //   - max_pending_requests_n is used since protocol V2. It is the number of
+    //     requests the client may have in flight before it has to wait for a
+    //     response. 0 means unlimited. Clients of protocol V1 only read the
+    //     first byte of the message.
     struct ProtocolHandshakeResponseMessage
     {
-      std::uint8_t accepted_protocol_version = 0;
+      std::uint8_t  accepted_protocol_version = 0;
+      std::uint16_t max_pending_requests_n    = 0;             // max. requests in flight in network byte order (since protocol V2)
     };
 #pragma pack(pop)
 
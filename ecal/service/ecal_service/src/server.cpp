@@ -40,6 +40,19 @@ namespace eCAL
                                           , const EventCallbackT&                   event_callback
                                           , const LoggerT&                          logger
                                           , const DeleteCallbackT&                  delete_callback)
+    {
+      return Server::create(io_context, protocol_version, port, service_callback, parallel_service_calls_enabled, io_context, event_callback, logger, delete_callback);
+    }
+
+    std::shared_ptr<Server> Server::create(const std::shared_ptr<asio::io_context>& io_context
+                                          , std::uint8_t                            protocol_version
+                                          , std::uint16_t                           port
+                                          , const ServiceCallbackT&                 service_callback
+                                          , bool                                    parallel_service_calls_enabled
+                                          , const std::shared_ptr<asio::io_context>& service_callback_io_context
+                                          , const EventCallbackT&                   event_callback
+                                          , const LoggerT&                          logger
+                                          , const DeleteCallbackT&                  delete_callback)
     {
       auto deleter = [delete_callback](Server* server)
       {
@@ -47,7 +60,7 @@ namespace eCAL
         delete server; // NOLINT(cppcoreguidelines-owning-memory)
       };
 
-      return std::shared_ptr<Server>(new Server(io_context, protocol_version, port, service_callback, parallel_service_calls_enabled, event_callback, logger), deleter);
+      return std::shared_ptr<Server>(new Server(io_context, protocol_version, port, service_callback, parallel_service_calls_enabled, service_callback_io_context, event_callback, logger), deleter);
     }
 
     std::shared_ptr<Server> Server::create(const std::shared_ptr<asio::io_context>& io_context
@@ -58,7 +71,7 @@ namespace eCAL
                                           , const EventCallbackT&                   event_callback
                                           , const LoggerT&                          logger)
     {
-      return std::shared_ptr<Server>(new Server(io_context, protocol_version, port, service_callback, parallel_service_calls_enabled, event_callback, logger));
+      return std::shared_ptr<Server>(new Server(io_context, protocol_version, port, service_callback, parallel_service_calls_enabled, io_context, event_callback, logger));
     }
 
     std::shared_ptr<Server> Server::create(const std::shared_ptr<asio::io_context>& io_context
@@ -77,10 +90,11 @@ namespace eCAL
                   , std::uint16_t                           port
                   , const ServiceCallbackT&                 service_callback
                   , bool                                    parallel_service_calls_enabled
+                  , const std::shared_ptr<asio::io_context>& service_callback_io_context
                   , const EventCallbackT&                   event_callback
                   , const LoggerT&                          logger)
     {
-      impl_ = ServerImpl::create(io_context, protocol_version, port, service_callback, parallel_service_calls_enabled, event_callback, logger);
+      impl_ = ServerImpl::create(io_context, protocol_version, port, service_callback, parallel_service_calls_enabled, service_callback_io_context, event_callback, logger);
     }
 
     ///////////////////////////////////////////
@@ -42,12 +42,13 @@ namespace eCAL
                                                   , std::uint16_t                           port
                                                   , const ServerServiceCallbackT&           service_callback // TODO: The service callback may block a long time. This may cause the entire network stack to wait for long running service callbacks. Maybe it is a good idea to have some kind of "future" object, that the user can hand to some differen io_context or to a custom thread. That thread will then work on the object and call some function / let it go out of scope, which will then trigger sending the response to the client.
                                                   , bool                                    parallel_service_calls_enabled
+                                                  , const std::shared_ptr<asio::io_context>& service_callback_io_context
                                                   , const ServerEventCallbackT&             event_callback
                                                   , const LoggerT&                          logger)
     {
       // Create a new instance with the protected constructor
       // Note: make_shared not possible, because constructor is protected
-      auto instance = std::shared_ptr<ServerImpl>(new ServerImpl(io_context, service_callback, parallel_service_calls_enabled, event_callback, logger));
+      auto instance = std::shared_ptr<ServerImpl>(new ServerImpl(io_context, service_callback, parallel_service_calls_enabled, service_callback_io_context, event_callback, logger));
 
       // Directly Start accepting new connections
       instance->start_accept(protocol_version, port);
@@ -59,12 +60,14 @@ namespace eCAL
     ServerImpl::ServerImpl(const std::shared_ptr<asio::io_context>& io_context
                           , const ServerServiceCallbackT&           service_callback
                           , bool                                    parallel_service_calls_enabled
+                          , const std::shared_ptr<asio::io_context>& service_callback_io_context
                           , const ServerEventCallbackT&             event_callback
                           , const LoggerT&                          logger)
       : io_context_                    (io_context)
       , acceptor_                      (*io_context)
       , parallel_service_calls_enabled_(parallel_service_calls_enabled)
-      , service_callback_common_strand_(std::make_shared<asio::io_context::strand>(*io_context))
+      , service_callback_io_context_   (service_callback_io_context ? service_callback_io_context : io_context)
+      , service_callback_common_strand_(std::make_shared<asio::io_context::strand>(*service_callback_io_context_))
       , service_callback_              (service_callback)
       , event_callback_                (event_callback)
       , logger_                        (logger)
@@ -222,10 +225,13 @@ namespace eCAL
 
       std::shared_ptr<eCAL::service::ServerSessionBase> new_session;
 
+      // The strand decides where the service callback is executed. Handlers
+      // wrapped by a strand of a different io_context are posted to that
+      // io_context, so the callback does not block the network io threads.
       std::shared_ptr<asio::io_context::strand>         service_callback_strand;
       if (parallel_service_calls_enabled_)
       {
-        service_callback_strand = std::make_shared<asio::io_context::strand>(*io_context_);
+        service_callback_strand = std::make_shared<asio::io_context::strand>(*service_callback_io_context_);
       }
       else
       {
@@ -238,7 +244,7 @@ namespace eCAL
       }
       else
       {
-        new_session = eCAL::service::ServerSessionV1::create(io_context_, service_callback_, service_callback_strand, event_callback_, shutdown_callback, logger_);
+        new_session = eCAL::service::ServerSessionV1::create(io_context_, protocol_version, service_callback_, service_callback_strand, parallel_service_calls_enabled_, event_callback_, shutdown_callback, logger_);
       }
 
       // Accept new session.
@@ -58,6 +58,7 @@ namespace eCAL
                                               , std::uint16_t                            port
                                               , const ServerServiceCallbackT&            service_callback
                                               , bool                                     parallel_service_calls_enabled
+                                              , const std::shared_ptr<asio::io_context>& service_callback_io_context
                                               , const ServerEventCallbackT&              event_callback
                                               , const LoggerT&                           logger = default_logger("Service Server"));
 
@@ -65,6 +66,7 @@ namespace eCAL
       ServerImpl(const std::shared_ptr<asio::io_context>& io_context
                 , const ServerServiceCallbackT&           service_callback
                 , bool                                    parallel_service_calls_enabled
+                , const std::shared_ptr<asio::io_context>& service_callback_io_context
                 , const ServerEventCallbackT&             event_callback
                 , const LoggerT&                          logger);
 
@@ -102,6 +104,7 @@ namespace eCAL
       mutable std::mutex                              acceptor_mutex_;                                //!< Mutex for stopping the server. The stop() function is both used externally (via API) and from within the server itself. Closing the acceptor is not thread-safe, so we need to protect it.
 
       const bool                                      parallel_service_calls_enabled_;
+      const std::shared_ptr<asio::io_context>         service_callback_io_context_;                  //!< The io_context executing the service callbacks. May be the same as io_context_.
       const std::shared_ptr<asio::io_context::strand> service_callback_common_strand_;
       const ServerServiceCallbackT                    service_callback_;
       const ServerEventCallbackT                      event_callback_;
@@ -56,6 +56,16 @@ namespace eCAL
                                                         , const Server::ServiceCallbackT& service_callback
                                                         , bool                            parallel_service_calls_enabled
                                                         , const Server::EventCallbackT&   event_callback)
+    {
+      return create_server(protocol_version, port, service_callback, parallel_service_calls_enabled, io_context_, event_callback);
+    }
+
+    std::shared_ptr<Server> ServerManager::create_server(std::uint8_t                              protocol_version
+                                                        , std::uint16_t                            port
+                                                        , const Server::ServiceCallbackT&          service_callback
+                                                        , bool                                     parallel_service_calls_enabled
+                                                        , const std::shared_ptr<asio::io_context>& service_callback_io_context
+                                                        , const Server::EventCallbackT&            event_callback)
     {
       const std::lock_guard<std::mutex> lock(server_manager_mutex_);
       if (stopped_)
@@ -73,7 +83,7 @@ namespace eCAL
                                   me->sessions_.erase(server);
                                 }
                               };
-      auto server = Server::create(io_context_, protocol_version, port, service_callback, parallel_service_calls_enabled, event_callback, logger_, delete_callback);
+      auto server = Server::create(io_context_, protocol_version, port, service_callback, parallel_service_calls_enabled, service_callback_io_context, event_callback, logger_, delete_callback);
       sessions_.emplace(server.get(), server);
       return server;
     }
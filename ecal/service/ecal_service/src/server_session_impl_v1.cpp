@@ -40,28 +40,38 @@ namespace eCAL
   {
     constexpr std::uint8_t ServerSessionV1::MIN_SUPPORTED_PROTOCOL_VERSION;
     constexpr std::uint8_t ServerSessionV1::MAX_SUPPORTED_PROTOCOL_VERSION;
+    constexpr std::uint16_t ServerSessionV1::MAX_PENDING_REQUESTS;
 
     std::shared_ptr<ServerSessionV1> ServerSessionV1::create(const std::shared_ptr<asio::io_context>&          io_context
+                                                            , std::uint8_t                                     max_protocol_version
                                                             , const ServerServiceCallbackT&                    service_callback
                                                             , const std::shared_ptr<asio::io_context::strand>& service_callback_strand
+                                                            , bool                                             parallel_service_calls_enabled
                                                             , const ServerEventCallbackT&                      event_callback
                                                             , const ShutdownCallbackT&                         shutdown_callback
                                                             , const LoggerT&                                   logger)
     {
-      std::shared_ptr<ServerSessionV1> instance = std::shared_ptr<ServerSessionV1>(new ServerSessionV1(io_context, service_callback, service_callback_strand, event_callback, shutdown_callback, logger));
+      std::shared_ptr<ServerSessionV1> instance = std::shared_ptr<ServerSessionV1>(new ServerSessionV1(io_context, max_protocol_version, service_callback, service_callback_strand, parallel_service_calls_enabled, event_callback, shutdown_callback, logger));
       return instance;
     }
 
     ServerSessionV1::ServerSessionV1(const std::shared_ptr<asio::io_context>&          io_context
+                                    , std::uint8_t                                     max_protocol_version
                                     , const ServerServiceCallbackT&                    service_callback
                                     , const std::shared_ptr<asio::io_context::strand>& service_callback_strand
+                                    , bool                                             parallel_service_calls_enabled
                                     , const ServerEventCallbackT&                      event_callback
                                     , const ShutdownCallbackT&                         shutdown_callback
                                     , const LoggerT&                                   logger)
       : ServerSessionBase(io_context, service_callback, service_callback_strand, event_callback, shutdown_callback)
-      , state_                    (State::NOT_CONNECTED)
-      , accepted_protocol_version_(0)
-      , logger_                   (logger)
+      , max_protocol_version_          (std::min(std::max(max_protocol_version, MIN_SUPPORTED_PROTOCOL_VERSION), MAX_SUPPORTED_PROTOCOL_VERSION))
+      , parallel_service_calls_enabled_(parallel_service_calls_enabled)
+      , state_                         (State::NOT_CONNECTED)
+      , accepted_protocol_version_     (0)
+      , send_in_progress_              (false)
+      , pending_requests_              (0)
+      , receive_paused_                (false)
+      , logger_                        (logger)
     {
       ECAL_SERVICE_LOG_DEBUG_VERBOSE(logger_, "Server Session Created");
     }
@@ -165,7 +175,7 @@ namespace eCAL
                                   const ProtocolHandshakeRequestMessage* handshake_request = reinterpret_cast<const ProtocolHandshakeRequestMessage*>(payload_buffer->data());
 
                                   // Compute the maximum supported protocol version by this server and the remote client
-                                  const std::uint8_t both_supported_max_protocol_version = std::min(handshake_request->max_supported_protocol_version, MAX_SUPPORTED_PROTOCOL_VERSION);
+                                  const std::uint8_t both_supported_max_protocol_version = std::min(handshake_request->max_supported_protocol_version, me->max_protocol_version_);
                                   const std::uint8_t both_supported_min_protocol_version = std::max(handshake_request->min_supported_protocol_version, MIN_SUPPORTED_PROTOCOL_VERSION);
 
                                   if (both_supported_max_protocol_version >= both_supported_min_protocol_version)
@@ -181,7 +191,7 @@ namespace eCAL
                                   {
                                     const std::string message = std::string("Error while accepting connection from client. No common protocol version is found. ")
                                                               + "Client supports [min: " + std::to_string(handshake_request->min_supported_protocol_version) + ", max: " + std::to_string(handshake_request->max_supported_protocol_version) + "]. "
-                                                              + "Server supports [min: " + std::to_string(MIN_SUPPORTED_PROTOCOL_VERSION) + ", max: " + std::to_string(MAX_SUPPORTED_PROTOCOL_VERSION) + "].";
+                                                              + "Server supports [min: " + std::to_string(MIN_SUPPORTED_PROTOCOL_VERSION) + ", max: " + std::to_string(me->max_protocol_version_) + "].";
                                     me->logger_(LogLevel::Error, "[" + get_connection_info_string(me->socket_) + "] " + message);
 
                                     //const auto message = get_log_string("ERROR", "Error connecting to server. Server reported an un-supported protocol version: " + std::to_string(handshake_response->accepted_protocol_version));
@@ -211,6 +221,8 @@ namespace eCAL
       payload_buffer->resize(sizeof(ProtocolHandshakeResponseMessage), '\0');
       ProtocolHandshakeResponseMessage* handshake_response_message = reinterpret_cast<ProtocolHandshakeResponseMessage*>(const_cast<char*>(payload_buffer->data()));
       handshake_response_message->accepted_protocol_version = accepted_protocol_version_;
+      if (accepted_protocol_version_ >= 2)
+        handshake_response_message->max_pending_requests_n  = htons(MAX_PENDING_REQUESTS);
 
       // Fill TCP Header
       header_buffer->package_size_n = htonl(static_cast<std::uint32_t>(payload_buffer->size()));
@@ -238,7 +250,12 @@ namespace eCAL
                               // call event callback
                               me->event_callback_(eCAL::service::ServerEventType::Connected, message);
 
-                              me->receive_service_request();
+                              // Since protocol version 2 requests carry a
+                              // request id and may be pipelined by the client
+                              if (me->accepted_protocol_version_ >= 2)
+                                me->receive_pipelined_service_request();
+                              else
+                                me->receive_service_request();
                             });
     }
 
@@ -326,5 +343,137 @@ namespace eCAL
                               });
     }
 
+    void ServerSessionV1::receive_pipelined_service_request()
+    {
+      ECAL_SERVICE_LOG_DEBUG(logger_, "[" + get_connection_info_string(socket_) + "] " + "Waiting for service request...");
+
+      eCAL::service::ProtocolV1::async_receive_payload(socket_, socket_mutex_
+                            , [me = shared_from_this()](asio::error_code ec)
+                              {
+                                const std::string message = "Server session disconnected while waiting for request: " + ec.message();
+                                me->logger_(LogLevel::Info, "[" + get_connection_info_string(me->socket_) + "] " + message);
+                                me->handle_pipelined_error(message);
+                              }
+                            , [me = shared_from_this()](const std::shared_ptr<std::vector<char>>& header_buffer, const std::shared_ptr<std::string>& payload_buffer)
+                              {
+                                const TcpHeaderV1* header = reinterpret_cast<const TcpHeaderV1*>(header_buffer->data());
+                                if (header->message_type != eCAL::service::MessageType::ServiceRequest)
+                                {
+                                  const std::string message = "Received invalid service request from client. Expected message type " 
+                                                              + std::to_string(static_cast<std::uint8_t>(eCAL::service::MessageType::ServiceRequest)) 
+                                                              + ", but received " + std::to_string(static_cast<std::uint8_t>(header->message_type));
+                                  me->logger_(LogLevel::Fatal, "[" + get_connection_info_string(me->socket_) + "] " + message);
+                                  me->handle_pipelined_error(message);
+                                  return;
+                                }
+
+                                const std::uint64_t request_id = header->request_id;
+
+                                ECAL_SERVICE_LOG_DEBUG(me->logger_, "[" + get_connection_info_string(me->socket_) + "] " + "Received service request " + std::to_string(request_id) + " of " + std::to_string(payload_buffer->size()) + " bytes");
+
+                                // Execute the service callback. The response is
+                                // sent whenever the callback has finished.
+                                const auto execute_service_callback = [me, payload_buffer, request_id]()
+                                                                      {
+                                                                        const std::shared_ptr<std::string> response_buffer = std::make_shared<std::string>();
+                                                                        me->service_callback_(payload_buffer, response_buffer);
+                                                                        me->enqueue_service_response(response_buffer, request_id);
+                                                                      };
+
+                                if (me->parallel_service_calls_enabled_)
+                                  asio::post(me->service_callback_strand_->context(), execute_service_callback);
+                                else
+                                  me->service_callback_strand_->post(execute_service_callback);
+
+                                // Directly wait for the next request, unless the
+                                // client already has too many requests in flight.
+                                // Receiving is resumed when a response was sent.
+                                bool receive_next_request(false);
+                                {
+                                  const std::lock_guard<std::mutex> send_queue_lock(me->send_queue_mutex_);
+                                  me->pending_requests_++;
+                                  receive_next_request = (me->pending_requests_ < MAX_PENDING_REQUESTS);
+                                  me->receive_paused_  = !receive_next_request;
+                                }
+
+                                if (receive_next_request)
+                                  me->receive_pipelined_service_request();
+                                else
+                                  ECAL_SERVICE_LOG_DEBUG(me->logger_, "[" + get_connection_info_string(me->socket_) + "] " + "Reached " + std::to_string(MAX_PENDING_REQUESTS) + " pending requests. Pausing receiving.");
+                              });
+    }
+
+    void ServerSessionV1::enqueue_service_response(const std::shared_ptr<std::string>& response_buffer, std::uint64_t request_id)
+    {
+      // Create header_buffer
+      const std::shared_ptr<TcpHeaderV1>  header_buffer  = std::make_shared<TcpHeaderV1>();
+      header_buffer->package_size_n = htonl(static_cast<std::uint32_t>(response_buffer->size()));
+      header_buffer->version        = accepted_protocol_version_;
+      header_buffer->message_type   = MessageType::ServiceResponse;
+      header_buffer->header_size_n  = htons(sizeof(TcpHeaderV1));
+      header_buffer->request_id     = request_id;
+
+      const std::lock_guard<std::mutex> send_queue_lock(send_queue_mutex_);
+      send_queue_.emplace_back(header_buffer, response_buffer);
+
+      if (!send_in_progress_)
+      {
+        send_in_progress_ = true;
+        send_next_queued_service_response();
+      }
+    }
+
+    void ServerSessionV1::send_next_queued_service_response()
+    {
+      // The send_queue_mutex_ must be locked when calling this function
+
+      ECAL_SERVICE_LOG_DEBUG(logger_, "[" + get_connection_info_string(socket_) + "] " + "Sending service response " + std::to_string(send_queue_.front().first->request_id) + "...");
+
+      eCAL::service::ProtocolV1::async_send_payload(socket_, socket_mutex_, send_queue_.front().first, send_queue_.front().second
+                            , [me = shared_from_this()](asio::error_code ec)
+                              {
+                                const std::string message = "Failed sending service response: " + ec.message();
+                                me->logger_(LogLevel::Error, "[" + get_connection_info_string(me->socket_) + "] " + message);
+                                me->handle_pipelined_error(message);
+                              }
+                            , [me = shared_from_this()]()
+                              {
+                                ECAL_SERVICE_LOG_DEBUG_VERBOSE(me->logger_, "[" + get_connection_info_string(me->socket_) + "] " + "Successfully sent service response.");
+
+                                bool resume_receiving(false);
+                                {
+                                  const std::lock_guard<std::mutex> send_queue_lock(me->send_queue_mutex_);
+                                  me->send_queue_.pop_front();
+                                  me->pending_requests_--;
+
+                                  if (me->receive_paused_ && (me->pending_requests_ < MAX_PENDING_REQUESTS))
+                                  {
+                                    me->receive_paused_ = false;
+                                    resume_receiving    = true;
+                                  }
+
+                                  if (me->send_queue_.empty())
+                                    me->send_in_progress_ = false;
+                                  else
+                                    me->send_next_queued_service_response();
+                                }
+
+                                if (resume_receiving)
+                                  me->receive_pipelined_service_request();
+                              });
+    }
+
+    void ServerSessionV1::handle_pipelined_error(const std::string& message)
+    {
+      // Receiving and sending fail independently of each other, but the
+      // session must only be reported as disconnected once.
+      if (state_.exchange(State::FAILED) == State::FAILED)
+        return;
+
+      // call event callback
+      event_callback_(eCAL::service::ServerEventType::Disconnected, message);
+      shutdown_callback_(shared_from_this());
+    }
+
   } // namespace service
 } // namespace eCAL
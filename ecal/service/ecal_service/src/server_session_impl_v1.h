@@ -20,14 +20,18 @@
 #pragma once
 
 #include "server_session_impl_base.h"
+#include "protocol_layout.h"
 #include <atomic>
 #include <cstdint>
 #include <ecal/service/logger.h>
 #include <ecal/service/server_session_types.h>
 
 #include <ecal/service/state.h>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 
 namespace eCAL
 {
@@ -44,16 +48,20 @@ namespace eCAL
 
     public:
       static std::shared_ptr<ServerSessionV1> create(const std::shared_ptr<asio::io_context>&          io_context
+                                                    , std::uint8_t                                     max_protocol_version
                                                     , const ServerServiceCallbackT&                    service_callback
                                                     , const std::shared_ptr<asio::io_context::strand>& service_callback_strand
+                                                    , bool                                             parallel_service_calls_enabled
                                                     , const ServerEventCallbackT&                      event_callback
                                                     , const ShutdownCallbackT&                         shutdown_callback
                                                     , const LoggerT&                                   logger);
 
     protected:
       ServerSessionV1(const std::shared_ptr<asio::io_context>&         io_context
+                    , std::uint8_t                                     max_protocol_version
                     , const ServerServiceCallbackT&                    service_callback
                     , const std::shared_ptr<asio::io_context::strand>& service_callback_strand
+                    , bool                                             parallel_service_calls_enabled
                     , const ServerEventCallbackT&                      event_callback
                     , const ShutdownCallbackT&                         shutdown_callback
                     , const LoggerT&                                   logger);
@@ -86,16 +94,48 @@ namespace eCAL
       void receive_service_request();
       void send_service_response(const std::shared_ptr<std::string>& response_buffer);
 
+      /**
+       * @brief Receive loop for protocol version 2 and newer.
+       *
+       * The next request is received right after the previous one, without
+       * waiting for the service callback. The callback is executed by the
+       * service_callback_strand_ (or, if parallel service calls are enabled,
+       * directly by its io_context, so requests of the same client may
+       * overtake each other). The response is tagged with the request id of
+       * the request, so the client can match it.
+       *
+       * At most MAX_PENDING_REQUESTS requests are executed or waiting for
+       * their response to be sent. When that limit is reached, reading is
+       * paused until a response has been sent. The limit is also announced to
+       * the client in the handshake response.
+       */
+      void receive_pipelined_service_request();
+      void enqueue_service_response(const std::shared_ptr<std::string>& response_buffer, std::uint64_t request_id);
+      void send_next_queued_service_response();
+      void handle_pipelined_error(const std::string& message);
+
     /////////////////////////////////////
     // Member variables
     /////////////////////////////////////
     private:
       static constexpr std::uint8_t MIN_SUPPORTED_PROTOCOL_VERSION = 1;
-      static constexpr std::uint8_t MAX_SUPPORTED_PROTOCOL_VERSION = 1;
+      static constexpr std::uint8_t MAX_SUPPORTED_PROTOCOL_VERSION = 2;
+      static constexpr std::uint16_t MAX_PENDING_REQUESTS          = 64;
+
+      const std::uint8_t      max_protocol_version_;                          //!< The highest protocol version this session negotiates. Never larger than MAX_SUPPORTED_PROTOCOL_VERSION.
+      const bool              parallel_service_calls_enabled_;
 
       std::atomic<State>      state_;
       std::uint8_t            accepted_protocol_version_;
 
+      // Responses waiting to be sent (protocol version 2 and newer). Only
+      // one response is written at a time, so they don't interleave.
+      std::mutex                                                                         send_queue_mutex_;
+      std::deque<std::pair<std::shared_ptr<TcpHeaderV1>, std::shared_ptr<std::string>>> send_queue_;
+      bool                                                                               send_in_progress_;
+      std::size_t                                                                        pending_requests_;   //!< Received requests whose response has not been sent, yet
+      bool                                                                               receive_paused_;     //!< Receiving is paused, because MAX_PENDING_REQUESTS was reached
+
       const LoggerT logger_;
     };
   }
@@ -23,10 +23,13 @@
 
 #include <asio.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <future>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 
@@ -61,7 +64,7 @@ eCAL::service::LoggerT critical_logger(const std::string& node_name)
 }
 
 constexpr std::uint8_t min_protocol_version = 0;
-constexpr std::uint8_t max_protocol_version = 1;
+constexpr std::uint8_t max_protocol_version = 2;
 
 
 
@@ -1609,6 +1612,330 @@ TEST(Callback, SerializedServiceCallbacks) // NOLINT
 }
 #endif
 
+#if 1
+TEST(Callback, WorkerContextServiceCallbacks) // NOLINT
+{
+  for (std::uint8_t protocol_version = min_protocol_version; protocol_version <= max_protocol_version; protocol_version++)
+  {
+    constexpr std::chrono::milliseconds server_callback_wait_time(50);
+    constexpr int num_clients        = 5;
+    constexpr int num_worker_threads = 5;
+
+    // A single io thread for the network communication
+    const auto io_context = std::make_shared<asio::io_context>();
+    auto server_manager = eCAL::service::ServerManager::create(io_context);
+    auto client_manager = eCAL::service::ClientManager::create(io_context);
+    std::thread io_thread([&io_context]() { io_context->run(); });
+
+    // Multiple worker threads for the service callbacks
+    const auto worker_context = std::make_shared<asio::io_context>();
+    auto worker_work = std::make_unique<asio::io_context::work>(*worker_context);
+    std::vector<std::thread> worker_threads;
+    worker_threads.reserve(num_worker_threads);
+    for (int i = 0; i < num_worker_threads; i++)
+    {
+      worker_threads.emplace_back([&worker_context]() { worker_context->run(); });
+    }
+
+    atomic_signalable<int> num_server_service_callback_called  (0);
+    atomic_signalable<int> num_client_response_callback_called (0);
+    atomic_signalable<int> num_client_event_callback_called    (0);
+    std::atomic<int>       num_callbacks_in_io_thread          (0);
+
+    const std::thread::id io_thread_id = io_thread.get_id();
+
+    const eCAL::service::Server::ServiceCallbackT server_service_callback
+            = [&num_server_service_callback_called, &num_callbacks_in_io_thread, io_thread_id, server_callback_wait_time]
+              (const std::shared_ptr<const std::string>& request, const std::shared_ptr<std::string>& response) -> void
+              {
+                if (std::this_thread::get_id() == io_thread_id)
+                  num_callbacks_in_io_thread++;
+
+                std::this_thread::sleep_for(server_callback_wait_time);
+                *response = "Response on \"" + *request + "\"";
+                num_server_service_callback_called++;
+              };
+
+    const eCAL::service::Server::EventCallbackT server_event_callback
+            = []
+              (eCAL::service::ServerEventType /*event*/, const std::string& /*message*/) -> void
+              {};
+
+    const eCAL::service::ClientSession::EventCallbackT client_event_callback
+            = [&num_client_event_callback_called]
+              (eCAL::service::ClientEventType /*event*/, const std::string& /*message*/) -> void
+              {
+                num_client_event_callback_called++;
+              };
+
+    auto server = server_manager->create_server(protocol_version, 0, server_service_callback, true, worker_context, server_event_callback);
+    std::vector<std::shared_ptr<eCAL::service::ClientSession>> clients;
+    clients.reserve(num_clients);
+    for (int i = 0; i < num_clients; i++)
+    {
+      clients.push_back(client_manager->create_client(protocol_version, "127.0.0.1", server->get_port(), client_event_callback));
+    }
+
+    num_client_event_callback_called.wait_for([&num_clients](int value) -> bool { return value >= num_clients; }, std::chrono::milliseconds(500));
+
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& client : clients)
+    {
+      const auto request = std::make_shared<std::string>("Request");
+
+      auto client_response_callback = [&num_client_response_callback_called]
+                                      (const eCAL::service::Error& error, const std::shared_ptr<std::string>& response) -> void
+                                      {
+                                        EXPECT_FALSE(bool(error));
+                                        EXPECT_EQ(*response, "Response on \"Request\"");
+                                        num_client_response_callback_called++;
+                                      };
+
+      client->async_call_service(request, client_response_callback);
+    }
+
+    num_client_response_callback_called.wait_for([num_clients](int v) {return v >= num_clients;}, num_clients * server_callback_wait_time * 2);
+
+    auto end = std::chrono::steady_clock::now();
+    auto duration = end - start;
+
+    // The callbacks are executed in parallel by the worker threads, not by the io thread
+    EXPECT_EQ(num_client_response_callback_called, num_clients);
+    EXPECT_EQ(num_server_service_callback_called,   num_clients);
+    EXPECT_EQ(num_callbacks_in_io_thread,           0);
+    EXPECT_LT(duration, num_clients * server_callback_wait_time);
+
+    server_manager->stop();
+    client_manager->stop();
+
+    // join the io thread, before the worker context gets out of work
+    io_thread.join();
+
+    worker_work.reset();
+    for (auto& thread : worker_threads)
+    {
+      thread.join();
+    }
+  }
+}
+#endif
+
+#if 1
+TEST(Pipelining, OutOfOrderResponses) // NOLINT
+{
+  // Pipelining is available since protocol version 2
+  for (std::uint8_t protocol_version = 2; protocol_version <= max_protocol_version; protocol_version++)
+  {
+    constexpr std::chrono::milliseconds slow_callback_wait_time(200);
+    constexpr int num_fast_calls     = 10;
+    constexpr int num_worker_threads = 4;
+
+    const auto io_context = std::make_shared<asio::io_context>();
+    auto server_manager = eCAL::service::ServerManager::create(io_context);
+    auto client_manager = eCAL::service::ClientManager::create(io_context);
+    std::thread io_thread([&io_context]() { io_context->run(); });
+
+    const auto worker_context = std::make_shared<asio::io_context>();
+    auto worker_work = std::make_unique<asio::io_context::work>(*worker_context);
+    std::vector<std::thread> worker_threads;
+    worker_threads.reserve(num_worker_threads);
+    for (int i = 0; i < num_worker_threads; i++)
+    {
+      worker_threads.emplace_back([&worker_context]() { worker_context->run(); });
+    }
+
+    atomic_signalable<int>   num_client_response_callback_called (0);
+    atomic_signalable<int>   num_client_event_callback_called    (0);
+    std::mutex               response_order_mutex;
+    std::vector<std::string> response_order;
+
+    // The first request is slow, all following requests are answered immediately
+    const eCAL::service::Server::ServiceCallbackT server_service_callback
+            = [slow_callback_wait_time]
+              (const std::shared_ptr<const std::string>& request, const std::shared_ptr<std::string>& response) -> void
+              {
+                if (*request == "slow")
+                  std::this_thread::sleep_for(slow_callback_wait_time);
+                *response = "Response on \"" + *request + "\"";
+              };
+
+    const eCAL::service::Server::EventCallbackT server_event_callback
+            = []
+              (eCAL::service::ServerEventType /*event*/, const std::string& /*message*/) -> void
+              {};
+
+    const eCAL::service::ClientSession::EventCallbackT client_event_callback
+            = [&num_client_event_callback_called]
+              (eCAL::service::ClientEventType /*event*/, const std::string& /*message*/) -> void
+              {
+                num_client_event_callback_called++;
+              };
+
+    auto server = server_manager->create_server(protocol_version, 0, server_service_callback, true, worker_context, server_event_callback);
+    auto client = client_manager->create_client(protocol_version, "127.0.0.1", server->get_port(), client_event_callback);
+
+    num_client_event_callback_called.wait_for([](int value) -> bool { return value >= 1; }, std::chrono::milliseconds(500));
+    EXPECT_EQ(client->get_accepted_protocol_version(), protocol_version);
+
+    std::vector<std::string> requests{ "slow" };
+    for (int i = 0; i < num_fast_calls; i++)
+    {
+      requests.push_back("fast " + std::to_string(i));
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto& request : requests)
+    {
+      auto client_response_callback = [&num_client_response_callback_called, &response_order_mutex, &response_order, request]
+                                      (const eCAL::service::Error& error, const std::shared_ptr<std::string>& response) -> void
+                                      {
+                                        EXPECT_FALSE(bool(error));
+                                        EXPECT_EQ(*response, "Response on \"" + request + "\"");
+                                        {
+                                          const std::lock_guard<std::mutex> lock(response_order_mutex);
+                                          response_order.push_back(request);
+                                        }
+                                        num_client_response_callback_called++;
+                                      };
+
+      client->async_call_service(std::make_shared<std::string>(request), client_response_callback);
+    }
+
+    // All fast calls overtake the slow one, as they don't have to wait for its response
+    num_client_response_callback_called.wait_for([](int v) { return v >= num_fast_calls; }, slow_callback_wait_time / 2);
+    EXPECT_EQ(num_client_response_callback_called, num_fast_calls);
+
+    num_client_response_callback_called.wait_for([](int v) { return v >= num_fast_calls + 1; }, slow_callback_wait_time * 2);
+    const auto duration = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(num_client_response_callback_called, num_fast_calls + 1);
+    EXPECT_LT(duration, slow_callback_wait_time * 2);
+    EXPECT_EQ(client->get_queue_size(), 0);
+    {
+      const std::lock_guard<std::mutex> lock(response_order_mutex);
+      ASSERT_EQ(response_order.size(), requests.size());
+      EXPECT_EQ(response_order.back(), "slow");
+    }
+
+    server_manager->stop();
+    client_manager->stop();
+
+    // join the io thread, before the worker context gets out of work
+    io_thread.join();
+
+    worker_work.reset();
+    for (auto& thread : worker_threads)
+    {
+      thread.join();
+    }
+  }
+}
+#endif
+
+#if 1
+TEST(Pipelining, MaxPendingRequests) // NOLINT
+{
+  // The server announces how many requests a client may have in flight. The
+  // remaining requests are kept in the client's queue.
+  for (std::uint8_t protocol_version = 2; protocol_version <= max_protocol_version; protocol_version++)
+  {
+    constexpr int max_pending_requests = 64;  // ServerSessionV1::MAX_PENDING_REQUESTS
+    constexpr int num_calls            = max_pending_requests + 36;
+    constexpr int num_worker_threads   = max_pending_requests + 8;
+
+    const auto io_context = std::make_shared<asio::io_context>();
+    auto server_manager = eCAL::service::ServerManager::create(io_context);
+    auto client_manager = eCAL::service::ClientManager::create(io_context);
+    std::thread io_thread([&io_context]() { io_context->run(); });
+
+    const auto worker_context = std::make_shared<asio::io_context>();
+    auto worker_work = std::make_unique<asio::io_context::work>(*worker_context);
+    std::vector<std::thread> worker_threads;
+    worker_threads.reserve(num_worker_threads);
+    for (int i = 0; i < num_worker_threads; i++)
+    {
+      worker_threads.emplace_back([&worker_context]() { worker_context->run(); });
+    }
+
+    atomic_signalable<int>   num_server_service_callback_called  (0);
+    atomic_signalable<int>   num_client_response_callback_called (0);
+    atomic_signalable<int>   num_client_event_callback_called    (0);
+
+    // All service callbacks block until the gate is opened
+    std::promise<void>       gate;
+    const std::shared_future<void> gate_opened = gate.get_future().share();
+
+    const eCAL::service::Server::ServiceCallbackT server_service_callback
+            = [&num_server_service_callback_called, gate_opened]
+              (const std::shared_ptr<const std::string>& request, const std::shared_ptr<std::string>& response) -> void
+              {
+                num_server_service_callback_called++;
+                gate_opened.wait();
+                *response = "Response on \"" + *request + "\"";
+              };
+
+    const eCAL::service::Server::EventCallbackT server_event_callback
+            = []
+              (eCAL::service::ServerEventType /*event*/, const std::string& /*message*/) -> void
+              {};
+
+    const eCAL::service::ClientSession::EventCallbackT client_event_callback
+            = [&num_client_event_callback_called]
+              (eCAL::service::ClientEventType /*event*/, const std::string& /*message*/) -> void
+              {
+                num_client_event_callback_called++;
+              };
+
+    auto server = server_manager->create_server(protocol_version, 0, server_service_callback, true, worker_context, server_event_callback);
+    auto client = client_manager->create_client(protocol_version, "127.0.0.1", server->get_port(), client_event_callback);
+
+    num_client_event_callback_called.wait_for([](int value) -> bool { return value >= 1; }, std::chrono::milliseconds(500));
+    EXPECT_EQ(client->get_accepted_protocol_version(), protocol_version);
+
+    for (int i = 0; i < num_calls; i++)
+    {
+      const std::string request = "Request " + std::to_string(i);
+      auto client_response_callback = [&num_client_response_callback_called, request]
+                                      (const eCAL::service::Error& error, const std::shared_ptr<std::string>& response) -> void
+                                      {
+                                        EXPECT_FALSE(bool(error));
+                                        EXPECT_EQ(*response, "Response on \"" + request + "\"");
+                                        num_client_response_callback_called++;
+                                      };
+
+      client->async_call_service(std::make_shared<std::string>(request), client_response_callback);
+    }
+
+    // The server only executes as many requests as it accepts in flight
+    num_server_service_callback_called.wait_for([](int v) { return v >= max_pending_requests; }, std::chrono::milliseconds(500));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(num_server_service_callback_called, max_pending_requests);
+    EXPECT_EQ(num_client_response_callback_called, 0);
+    EXPECT_EQ(client->get_queue_size(), num_calls);
+
+    // Once responses are sent, the remaining requests follow
+    gate.set_value();
+    num_client_response_callback_called.wait_for([](int v) { return v >= num_calls; }, std::chrono::milliseconds(1000));
+
+    EXPECT_EQ(num_server_service_callback_called, num_calls);
+    EXPECT_EQ(num_client_response_callback_called, num_calls);
+    EXPECT_EQ(client->get_queue_size(), 0);
+
+    server_manager->stop();
+    client_manager->stop();
+
+    // join the io thread, before the worker context gets out of work
+    io_thread.join();
+
+    worker_work.reset();
+    for (auto& thread : worker_threads)
+    {
+      thread.join();
+    }
+  }
+}
+#endif
+
 #if 1
 // Call different eCAL Service API functions from within the callbacks
 TEST(ecal_service, Callback_ApiCallsFromCallbacks)
@@ -1976,7 +2303,9 @@ TEST(ErrorCallback, ErrorCallbackServerHasDisconnected) // NOLINT
 #if 1
 TEST(ErrorCallback, ErrorCallbackClientDisconnects) // NOLINT
 {
-  for (std::uint8_t protocol_version = min_protocol_version; protocol_version <= max_protocol_version; protocol_version++)
+  // Since protocol version 2 all requests are sent to the server right away,
+  // so the server also executes the calls that this test expects to fail.
+  for (std::uint8_t protocol_version = min_protocol_version; protocol_version <= std::min(max_protocol_version, std::uint8_t(1)); protocol_version++)
   {
     const auto io_context = std::make_shared<asio::io_context>();
     const asio::io_context::work dummy_work(*io_context);
@@ -0,0 +1,111 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+
+const auto g_snd_size (256);
+const auto g_snd_loops(100000);
+
+// measures the subscriber receive path if every sample arrives on more than one layer,
+// all but the first arrival have to be detected as duplicates and discarded
+void multilayer_test(int snd_size, int snd_loops, bool shm, bool udp)
+{
+  // create payload
+  const std::string payload(snd_size, 42);
+
+  // create publisher
+  eCAL::CPublisher pub("multilayer");
+  // set transport layer
+  pub.SetLayerMode(eCAL::TLayer::tlayer_all, eCAL::TLayer::smode_off);
+  if (shm) pub.SetLayerMode(eCAL::TLayer::tlayer_shm,    eCAL::TLayer::smode_on);
+  if (udp) pub.SetLayerMode(eCAL::TLayer::tlayer_udp_mc, eCAL::TLayer::smode_on);
+
+  // create subscriber
+  eCAL::CSubscriber sub("multilayer");
+  // add callback
+  std::atomic<size_t> received_samples(0);
+  auto on_receive = [&](const struct eCAL::SReceiveCallbackData* /*data_*/) {
+    received_samples++;
+  };
+  sub.AddReceiveCallback(std::bind(on_receive, std::placeholders::_2));
+
+  // let's match them
+  eCAL::Process::SleepMS(2000);
+
+  // initial call to allocate memory file
+  pub.Send(payload);
+  eCAL::Process::SleepMS(100);
+
+  // reset received samples counter
+  received_samples = 0;
+
+  // start time
+  auto start = std::chrono::high_resolution_clock::now();
+
+  // do some work
+  for (auto i = 0; i < snd_loops; ++i)
+  {
+    pub.Send(payload);
+  }
+
+  // end time
+  auto finish = std::chrono::high_resolution_clock::now();
+  const std::chrono::duration<double> elapsed = finish - start;
+
+  // give the receive threads time to process the pending samples
+  eCAL::Process::SleepMS(500);
+
+  std::cout << "Elapsed time : " << elapsed.count() << " s" << std::endl;
+  std::cout << "Sent         : " << snd_loops << " samples" << std::endl;
+  std::cout << "Received     : " << received_samples << " samples" << std::endl;
+  std::cout << "Rate         : " << int(snd_loops / elapsed.count()) << " samples/s" << std::endl;
+  std::cout << "Per sample   : " << elapsed.count() * 1e9 / snd_loops << " ns" << std::endl;
+}
+
+// main entry
+int main(int argc, char **argv)
+{
+  // initialize eCAL API
+  eCAL::Initialize(argc, argv, "multilayer_rec_cb");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  std::cout << "---------------------------" << std::endl;
+  std::cout << "LAYER: SHM"                  << std::endl;
+  std::cout << "---------------------------" << std::endl;
+  multilayer_test(g_snd_size, g_snd_loops, true, false);
+  std::cout << std::endl << std::endl;
+
+  std::cout << "---------------------------" << std::endl;
+  std::cout << "LAYER: SHM + UDP"            << std::endl;
+  std::cout << "---------------------------" << std::endl;
+  multilayer_test(g_snd_size, g_snd_loops, true, true);
+  std::cout << std::endl << std::endl;
+
+  // finalize eCAL API
+  eCAL::Finalize();
+
+  return(0);
+}
@@ -0,0 +1,81 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+// measures the named events eCAL uses to signal shared memory updates,
+// build eCAL with ECAL_USE_FUTEX_EVENT ON / OFF to compare the linux backends
+
+#include <ecal/ecal.h>
+#include <ecal/ecal_event.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+const auto g_set_loops     (1000000);
+const auto g_pingpong_loops(20000);
+
+int main(int /*argc*/, char** /*argv*/)
+{
+  const std::string ping_name = "named_event_latency_ping_" + std::to_string(eCAL::Process::GetProcessID());
+  const std::string pong_name = "named_event_latency_pong_" + std::to_string(eCAL::Process::GetProcessID());
+
+  eCAL::EventHandleT ping;
+  eCAL::EventHandleT pong;
+  if (!eCAL::gOpenEvent(&ping, ping_name) || !eCAL::gOpenEvent(&pong, pong_name))
+  {
+    std::cout << "Could not create named events." << std::endl;
+    return 1;
+  }
+
+  // uncontended set / check, nobody is waiting
+  auto start = std::chrono::high_resolution_clock::now();
+  for (auto i = 0; i < g_set_loops; ++i)
+  {
+    eCAL::gSetEvent(ping);
+    eCAL::gWaitForEvent(ping, 0);
+  }
+  std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+  std::cout << "Set + check (uncontended) : " << elapsed.count() * 1e9 / g_set_loops << " ns" << std::endl;
+
+  // round trip between two threads, every set wakes up a waiting thread
+  std::thread partner([&]()
+    {
+      for (auto i = 0; i < g_pingpong_loops; ++i)
+      {
+        eCAL::gWaitForEvent(ping, -1);
+        eCAL::gSetEvent(pong);
+      }
+    });
+
+  start = std::chrono::high_resolution_clock::now();
+  for (auto i = 0; i < g_pingpong_loops; ++i)
+  {
+    eCAL::gSetEvent(ping);
+    eCAL::gWaitForEvent(pong, -1);
+  }
+  elapsed = std::chrono::high_resolution_clock::now() - start;
+  partner.join();
+  std::cout << "Ping pong round trip      : " << elapsed.count() * 1e6 / g_pingpong_loops << " us" << std::endl;
+
+  eCAL::gCloseEvent(ping);
+  eCAL::gCloseEvent(pong);
+
+  return(0);
+}
@@ -0,0 +1,147 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+#include <ecal/msg/protobuf/publisher.h>
+#include <ecal/msg/protobuf/subscriber.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+#include "point_cloud.pb.h"
+
+const auto g_point_count(10000);
+const auto g_snd_loops  (1000);
+
+// count heap allocations per thread
+thread_local size_t g_thread_allocations(0);
+
+void* operator new(std::size_t size_)
+{
+  g_thread_allocations++;
+  void* ptr = std::malloc(size_ > 0 ? size_ : 1);
+  if (ptr == nullptr) throw std::bad_alloc();
+  return ptr;
+}
+
+void operator delete(void* ptr_) noexcept
+{
+  std::free(ptr_);
+}
+
+void operator delete(void* ptr_, std::size_t /*size_*/) noexcept
+{
+  std::free(ptr_);
+}
+
+// measures the heap allocations of the receive thread per sample with and without message reuse
+void reuse_test(int point_count, int snd_loops, bool reuse)
+{
+  // create the message
+  pb::Benchmark::PointCloud cloud;
+  for (auto i = 0; i < point_count; ++i)
+  {
+    auto* point = cloud.add_points();
+    point->set_x(static_cast<float>(i));
+    point->set_y(static_cast<float>(i));
+    point->set_z(static_cast<float>(i));
+    point->set_label("point label " + std::to_string(i));
+  }
+  cloud.set_raw(std::string(1024, 42));
+
+  // create publisher
+  eCAL::protobuf::CPublisher<pb::Benchmark::PointCloud> pub("point_cloud");
+  pub.SetLayerMode(eCAL::TLayer::tlayer_all, eCAL::TLayer::smode_off);
+  pub.SetLayerMode(eCAL::TLayer::tlayer_shm, eCAL::TLayer::smode_on);
+  pub.ShmSetAcknowledgeTimeout(100);
+
+  // create subscriber
+  eCAL::protobuf::CSubscriber<pb::Benchmark::PointCloud> sub("point_cloud");
+  sub.SetMessageReuse(reuse);
+
+  // add callback, counting the allocations of the receive thread since the last sample
+  std::atomic<size_t> received_samples(0);
+  std::atomic<size_t> received_allocations(0);
+  auto on_receive = [&](const char* /*topic_name_*/, const pb::Benchmark::PointCloud& /*msg_*/, long long /*time_*/, long long /*clock_*/, long long /*id_*/) {
+    thread_local size_t last_allocations(0);
+    if (received_samples++ > 0) received_allocations += g_thread_allocations - last_allocations;
+    last_allocations = g_thread_allocations;
+  };
+  sub.AddReceiveCallback(on_receive);
+
+  // let's match them
+  eCAL::Process::SleepMS(2000);
+
+  // start time
+  auto start = std::chrono::high_resolution_clock::now();
+
+  // do some work
+  for (auto i = 0; i < snd_loops; ++i)
+  {
+    cloud.set_id(i);
+    pub.Send(cloud);
+  }
+
+  // end time
+  auto finish = std::chrono::high_resolution_clock::now();
+  const std::chrono::duration<double> elapsed = finish - start;
+
+  // give the receive thread time to process the pending samples
+  eCAL::Process::SleepMS(500);
+
+  const size_t samples = received_samples;
+  std::cout << "Elapsed time : " << elapsed.count() << " s" << std::endl;
+  std::cout << "Sent         : " << snd_loops << " samples" << std::endl;
+  std::cout << "Received     : " << samples << " samples" << std::endl;
+  if (samples > 1)
+  {
+    std::cout << "Allocations  : " << received_allocations / (samples - 1) << " per sample (receive thread)" << std::endl;
+  }
+}
+
+// main entry
+int main(int argc, char **argv)
+{
+  // initialize eCAL API
+  eCAL::Initialize(argc, argv, "proto_rec_reuse");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  std::cout << "---------------------------" << std::endl;
+  std::cout << "NEW MESSAGE PER SAMPLE"      << std::endl;
+  std::cout << "---------------------------" << std::endl;
+  reuse_test(g_point_count, g_snd_loops, false);
+  std::cout << std::endl << std::endl;
+
+  std::cout << "---------------------------" << std::endl;
+  std::cout << "REUSED MESSAGE"              << std::endl;
+  std::cout << "---------------------------" << std::endl;
+  reuse_test(g_point_count, g_snd_loops, true);
+  std::cout << std::endl << std::endl;
+
+  // finalize eCAL API
+  eCAL::Finalize();
+
+  return(0);
+}
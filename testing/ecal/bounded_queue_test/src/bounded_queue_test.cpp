@@ -0,0 +1,199 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "util/ecal_bounded_queue.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(BoundedQueue, PushPop)
+{
+  eCAL::Util::CBoundedQueue<int> queue(3);
+  EXPECT_EQ(3, queue.Capacity());
+  EXPECT_EQ(0, queue.Size());
+
+  // fill the queue
+  for (int value = 1; value <= 3; ++value)
+  {
+    int item = value;
+    EXPECT_TRUE(queue.Push(item));
+  }
+  EXPECT_EQ(3, queue.Size());
+
+  // full
+  int item = 4;
+  EXPECT_FALSE(queue.Push(item));
+  EXPECT_EQ(4, item);
+
+  // elements come out in order
+  for (int value = 1; value <= 3; ++value)
+  {
+    EXPECT_TRUE(queue.Pop(item));
+    EXPECT_EQ(value, item);
+  }
+  EXPECT_EQ(0, queue.Size());
+
+  // empty
+  EXPECT_FALSE(queue.Pop(item));
+}
+
+TEST(BoundedQueue, ZeroCapacity)
+{
+  // the queue holds one element at least
+  eCAL::Util::CBoundedQueue<int> queue(0);
+  EXPECT_EQ(1, queue.Capacity());
+
+  int item = 1;
+  EXPECT_TRUE(queue.Push(item));
+  item = 2;
+  EXPECT_FALSE(queue.Push(item));
+  EXPECT_TRUE(queue.Pop(item));
+  EXPECT_EQ(1, item);
+  EXPECT_FALSE(queue.Pop(item));
+
+  // and keeps working over many rounds
+  for (int value = 0; value < 100; ++value)
+  {
+    item = value;
+    EXPECT_TRUE(queue.Push(item));
+    EXPECT_TRUE(queue.Pop(item));
+    EXPECT_EQ(value, item);
+  }
+}
+
+TEST(BoundedQueue, WrapAround)
+{
+  eCAL::Util::CBoundedQueue<int> queue(4);
+
+  // push and pop many rounds with a changing fill level
+  int next_push(0);
+  int next_pop(0);
+  for (int round = 0; round < 1000; ++round)
+  {
+    for (int count = 0; count < (round % 4) + 1; ++count)
+    {
+      int item = next_push;
+      if (queue.Push(item)) next_push++;
+    }
+    for (int count = 0; count < (round % 3) + 1; ++count)
+    {
+      int item = -1;
+      if (!queue.Pop(item)) break;
+      EXPECT_EQ(next_pop, item);
+      next_pop++;
+    }
+    EXPECT_EQ(static_cast<size_t>(next_push - next_pop), queue.Size());
+  }
+}
+
+TEST(BoundedQueue, SwapRecyclesBuffers)
+{
+  eCAL::Util::CBoundedQueue<std::vector<char>> queue(2);
+
+  // the pushed buffer is swapped into the queue and comes out again on pop
+  std::vector<char> item(1024, 'a');
+  const char* buffer = item.data();
+  EXPECT_TRUE(queue.Push(item));
+  EXPECT_TRUE(item.empty());
+
+  std::vector<char> popped;
+  EXPECT_TRUE(queue.Pop(popped));
+  EXPECT_EQ(buffer, popped.data());
+  EXPECT_EQ(std::vector<char>(1024, 'a'), popped);
+
+  // the popped element leaves the previous content of popped_ in the queue cell,
+  // so pushing the popped element again hands its buffer back
+  popped.assign(16, 'b');
+  EXPECT_TRUE(queue.Push(popped));
+  std::vector<char> item2;
+  EXPECT_TRUE(queue.Pop(item2));
+  EXPECT_EQ(buffer, item2.data());
+}
+
+TEST(BoundedQueue, MultiProducerMultiConsumer)
+{
+  constexpr int producer_count = 2;
+  constexpr int consumer_count = 2;
+  constexpr int items_per_producer = 2000;
+
+  eCAL::Util::CBoundedQueue<int> queue(8);
+
+  std::atomic<int> consumed(0);
+  std::vector<std::vector<int>> received(consumer_count);
+
+  std::vector<std::thread> threads;
+  for (int producer = 0; producer < producer_count; ++producer)
+  {
+    threads.emplace_back([&queue, producer]()
+      {
+        for (int idx = 0; idx < items_per_producer; ++idx)
+        {
+          int item = producer * items_per_producer + idx;
+          while (!queue.Push(item)) std::this_thread::yield();
+        }
+      });
+  }
+  for (int consumer = 0; consumer < consumer_count; ++consumer)
+  {
+    threads.emplace_back([&queue, &consumed, &received, consumer]()
+      {
+        while (consumed < producer_count * items_per_producer)
+        {
+          int item = -1;
+          if (queue.Pop(item))
+          {
+            received[consumer].push_back(item);
+            consumed++;
+          }
+          else
+          {
+            std::this_thread::yield();
+          }
+        }
+      });
+  }
+  for (auto& thread : threads) thread.join();
+
+  // every element was received exactly once and in order per producer
+  std::vector<int> all;
+  for (const auto& items : received)
+  {
+    std::vector<int> last(producer_count, -1);
+    for (const int item : items)
+    {
+      const int producer = item / items_per_producer;
+      EXPECT_LT(last[producer], item);
+      last[producer] = item;
+    }
+    all.insert(all.end(), items.begin(), items.end());
+  }
+  std::sort(all.begin(), all.end());
+  ASSERT_EQ(static_cast<size_t>(producer_count * items_per_producer), all.size());
+  for (int idx = 0; idx < producer_count * items_per_producer; ++idx)
+  {
+    EXPECT_EQ(idx, all[idx]);
+  }
+  EXPECT_EQ(0, queue.Size());
+}
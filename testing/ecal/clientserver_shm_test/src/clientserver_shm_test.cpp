@@ -0,0 +1,244 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  // small channels, so that larger responses are transferred in chunks and larger requests use tcp
+  const size_t channel_size(1024);
+
+  // all tests of this process run with the shared memory service transport
+  void InitializeShm(const char* unit_name_, size_t worker_threads_ = 4)
+  {
+    std::vector<std::string> args =
+    {
+      "clientserver_shm_test",
+      "--ecal-set-config-key", "experimental/service_shm_transport:true",
+      "--ecal-set-config-key", "experimental/service_shm_channels:2",
+      "--ecal-set-config-key", "experimental/service_shm_channel_size:" + std::to_string(channel_size),
+      "--ecal-set-config-key", "experimental/service_server_worker_threads:" + std::to_string(worker_threads_),
+    };
+    std::vector<char*> argv;
+    for (auto& arg : args) argv.push_back(&arg[0]);
+
+    eCAL::Initialize(static_cast<int>(argv.size()), argv.data(), unit_name_);
+  }
+
+  std::string Content(size_t size_)
+  {
+    std::string content(size_, '\0');
+    for (size_t i = 0; i < size_; ++i) content[i] = static_cast<char>(i * 7);
+    return content;
+  }
+}
+
+TEST(ClientServerShm, RequestResponseSizes)
+{
+  InitializeShm("clientserver shm sizes");
+
+  // server answers with the requested number of bytes (followed by the request)
+  eCAL::CServiceServer server("service");
+  auto method_callback = [](const std::string& /*method_*/, const std::string& /*req_type_*/, const std::string& /*resp_type_*/, const std::string& request_, std::string& response_) -> int
+  {
+    response_ = Content(std::stoul(request_.substr(0, request_.find(' ')))) + request_;
+    return 42;
+  };
+  server.AddMethodCallback("size", "", "", method_callback);
+
+  eCAL::CServiceClient client("service");
+
+  // let's match them -> wait REGISTRATION_REFRESH_CYCLE (ecal_def.h)
+  eCAL::Process::SleepMS(2000);
+
+  // empty, small, chunk aligned, chunked and large responses, small and large (tcp) requests
+  const std::vector<size_t> response_sizes = { 0, 1, channel_size - 2, channel_size, channel_size + 1, 10 * channel_size, 4 * 1024 * 1024 };
+  for (const auto response_size : response_sizes)
+  {
+    for (const auto request_padding : { size_t(0), 2 * channel_size })
+    {
+      const std::string request = std::to_string(response_size) + " " + std::string(request_padding, 'x');
+      eCAL::ServiceResponseVecT service_response_vec;
+      EXPECT_TRUE(client.Call("size", request, -1, &service_response_vec));
+      ASSERT_EQ(1, service_response_vec.size());
+
+      const auto& service_response = service_response_vec[0];
+      EXPECT_EQ(call_state_executed, service_response.call_state);
+      EXPECT_EQ(42, service_response.ret_state);
+      EXPECT_EQ(Content(response_size) + request, service_response.response);
+    }
+  }
+
+  eCAL::Finalize();
+}
+
+TEST(ClientServerShm, ParallelClients)
+{
+  InitializeShm("clientserver shm parallel clients");
+
+  // a slow method must not block the calls of other clients
+  eCAL::CServiceServer server("service");
+  auto slow_callback = [](const std::string& /*method_*/, const std::string& /*req_type_*/, const std::string& /*resp_type_*/, const std::string& /*request_*/, std::string& response_) -> int
+  {
+    eCAL::Process::SleepMS(1000);
+    response_ = "slow";
+    return 0;
+  };
+  auto fast_callback = [](const std::string& /*method_*/, const std::string& /*req_type_*/, const std::string& /*resp_type_*/, const std::string& /*request_*/, std::string& response_) -> int
+  {
+    response_ = "fast";
+    return 0;
+  };
+  server.AddMethodCallback("slow", "", "", slow_callback);
+  server.AddMethodCallback("fast", "", "", fast_callback);
+
+  eCAL::CServiceClient slow_client("service");
+  eCAL::CServiceClient fast_client("service");
+
+  // let's match them -> wait REGISTRATION_REFRESH_CYCLE (ecal_def.h)
+  eCAL::Process::SleepMS(2000);
+
+  std::atomic<int> slow_responses(0);
+  slow_client.AddResponseCallback([&slow_responses](const struct eCAL::SServiceResponse& /*service_response_*/) { slow_responses++; });
+  EXPECT_TRUE(slow_client.CallAsync("slow", ""));
+  eCAL::Process::SleepMS(100);
+
+  const auto start = std::chrono::steady_clock::now();
+  eCAL::ServiceResponseVecT service_response_vec;
+  EXPECT_TRUE(fast_client.Call("fast", "", 500, &service_response_vec));
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(500));
+  ASSERT_EQ(1, service_response_vec.size());
+  EXPECT_EQ("fast", service_response_vec[0].response);
+
+  // the slow call is answered as well
+  eCAL::Process::SleepMS(1500);
+  EXPECT_EQ(1, slow_responses);
+
+  eCAL::Finalize();
+}
+
+TEST(ClientServerShm, ServerRestart)
+{
+  InitializeShm("clientserver shm server restart");
+
+  auto method_callback = [](const std::string& /*method_*/, const std::string& /*req_type_*/, const std::string& /*resp_type_*/, const std::string& request_, std::string& response_) -> int
+  {
+    response_ = request_;
+    return 0;
+  };
+
+  eCAL::CServiceClient client("service");
+
+  // the client forgets the memory file of the first server and claims a channel of the second one
+  for (int run = 0; run < 2; ++run)
+  {
+    eCAL::CServiceServer server("service");
+    server.AddMethodCallback("echo", "", "", method_callback);
+
+    // let's match them -> wait REGISTRATION_REFRESH_CYCLE (ecal_def.h)
+    eCAL::Process::SleepMS(2000);
+
+    const std::string request = "run " + std::to_string(run);
+    eCAL::ServiceResponseVecT service_response_vec;
+    EXPECT_TRUE(client.Call("echo", request, -1, &service_response_vec));
+    ASSERT_EQ(1, service_response_vec.size());
+    EXPECT_EQ(request, service_response_vec[0].response);
+  }
+
+  eCAL::Finalize();
+}
+
+TEST(ClientServerShm, ChannelRetry)
+{
+  InitializeShm("clientserver shm channel retry");
+
+  auto method_callback = [](const std::string& /*method_*/, const std::string& /*req_type_*/, const std::string& /*resp_type_*/, const std::string& request_, std::string& response_) -> int
+  {
+    response_ = request_;
+    return 0;
+  };
+
+  eCAL::CServiceServer server("service");
+  server.AddMethodCallback("echo", "", "", method_callback);
+
+  // more clients than channels, the last one is served via tcp until a channel gets free
+  std::vector<std::unique_ptr<eCAL::CServiceClient>> clients;
+  for (int i = 0; i < 3; ++i) clients.emplace_back(new eCAL::CServiceClient("service"));
+
+  // let's match them -> wait REGISTRATION_REFRESH_CYCLE (ecal_def.h)
+  eCAL::Process::SleepMS(2000);
+
+  for (int loop = 0; loop < 2; ++loop)
+  {
+    for (auto& client : clients)
+    {
+      eCAL::ServiceResponseVecT service_response_vec;
+      EXPECT_TRUE(client->Call("echo", "hello", -1, &service_response_vec));
+      ASSERT_EQ(1, service_response_vec.size());
+      EXPECT_EQ("hello", service_response_vec[0].response);
+    }
+
+    // free a channel and let the other clients retry
+    clients.erase(clients.begin());
+    clients.emplace_back(new eCAL::CServiceClient("service"));
+    eCAL::Process::SleepMS(2000);
+  }
+
+  eCAL::Finalize();
+}
+
+TEST(ClientServerShm, InlineExecution)
+{
+  // no worker threads, the requests are executed by the serving thread of the server
+  InitializeShm("clientserver shm inline execution", 0);
+
+  eCAL::CServiceServer server("service");
+  auto method_callback = [](const std::string& /*method_*/, const std::string& /*req_type_*/, const std::string& /*resp_type_*/, const std::string& request_, std::string& response_) -> int
+  {
+    response_ = Content(std::stoul(request_));
+    return 0;
+  };
+  server.AddMethodCallback("size", "", "", method_callback);
+
+  eCAL::CServiceClient client("service");
+
+  // let's match them -> wait REGISTRATION_REFRESH_CYCLE (ecal_def.h)
+  eCAL::Process::SleepMS(2000);
+
+  // single chunk and chunked responses
+  for (int loop = 0; loop < 100; ++loop)
+  {
+    const size_t response_size = (loop % 2 == 0) ? 16 : 3 * channel_size;
+    eCAL::ServiceResponseVecT service_response_vec;
+    EXPECT_TRUE(client.Call("size", std::to_string(response_size), -1, &service_response_vec));
+    ASSERT_EQ(1, service_response_vec.size());
+    EXPECT_EQ(call_state_executed, service_response_vec[0].call_state);
+    EXPECT_EQ(Content(response_size), service_response_vec[0].response);
+  }
+
+  eCAL::Finalize();
+}
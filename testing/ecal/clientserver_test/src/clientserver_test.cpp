@@ -21,6 +21,7 @@
 #include <ecal/msg/protobuf/client.h>
 #include <ecal/msg/protobuf/server.h>
 
+#include <chrono>
 #include <cmath>
 #include <iostream>
 
@@ -47,6 +48,10 @@
 
 #define NestedRPCCallTest                         1
 
+#define ClientServerLargeResponseTest             1
+
+#define ClientServerFutureTest                    1
+
 namespace
 {
   typedef std::vector<std::shared_ptr<eCAL::CServiceServer>> ServiceVecT;
@@ -1045,3 +1050,126 @@ TEST(ClientServer, NestedRPCCall)
 }
 
 #endif /* NestedRPCCallTest */
+
+#if ClientServerLargeResponseTest
+
+TEST(ClientServer, ClientServerLargeResponse)
+{
+  const size_t response_size(8 * 1024 * 1024);
+
+  // initialize eCAL API
+  eCAL::Initialize(0, nullptr, "clientserver large response test");
+
+  // create service server
+  eCAL::CServiceServer server("service");
+
+  // method callback function, answers with a large response (binary content, including zero bytes)
+  auto method_callback = [&](const std::string& /*method_*/, const std::string& /*req_type_*/, const std::string& /*resp_type_*/, const std::string& request_, std::string& response_) -> int
+  {
+    response_.assign(response_size, '\0');
+    for (size_t i = 0; i < response_size; i += 4096) response_[i] = static_cast<char>(i / 4096);
+    response_ += request_;
+    return 42;
+  };
+  server.AddMethodCallback("foo::method1", "foo::req_type1", "foo::resp_type1", method_callback);
+
+  // create service client
+  eCAL::CServiceClient client("service");
+
+  // let's match them -> wait REGISTRATION_REFRESH_CYCLE (ecal_def.h)
+  eCAL::Process::SleepMS(2000);
+
+  // call method (the request contains zero bytes as well)
+  const std::string request("large\0request", 13);
+  eCAL::ServiceResponseVecT service_response_vec;
+  EXPECT_TRUE(client.Call("foo::method1", request, -1, &service_response_vec));
+  ASSERT_EQ(1, service_response_vec.size());
+
+  const auto& service_response = service_response_vec[0];
+  EXPECT_EQ(call_state_executed, service_response.call_state);
+  EXPECT_EQ(42, service_response.ret_state);
+  EXPECT_EQ("service", service_response.service_name);
+  EXPECT_EQ("foo::method1", service_response.method_name);
+  ASSERT_EQ(response_size + request.size(), service_response.response.size());
+  EXPECT_EQ(static_cast<char>(1), service_response.response[4096]);
+  EXPECT_EQ(request, service_response.response.substr(response_size));
+
+  // unknown method
+  EXPECT_FALSE(client.Call("foo::unknown", request, -1, &service_response_vec));
+  ASSERT_EQ(1, service_response_vec.size());
+  EXPECT_EQ(call_state_failed, service_response_vec[0].call_state);
+  EXPECT_FALSE(service_response_vec[0].error_msg.empty());
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+#endif /* ClientServerLargeResponseTest */
+
+#if ClientServerFutureTest
+
+TEST(ClientServer, ClientServerFuture)
+{
+  // initialize eCAL API
+  eCAL::Initialize(0, nullptr, "clientserver future test");
+
+  // create service server
+  eCAL::CServiceServer server("service");
+
+  // method callback function, answers after the requested time (in ms)
+  auto method_callback = [&](const std::string& /*method_*/, const std::string& /*req_type_*/, const std::string& /*resp_type_*/, const std::string& request_, std::string& response_) -> int
+  {
+    eCAL::Process::SleepMS(std::stoi(request_));
+    response_ = request_;
+    return 42;
+  };
+  server.AddMethodCallback("foo::method1", "foo::req_type1", "foo::resp_type1", method_callback);
+
+  // create service client
+  eCAL::CServiceClient client("service");
+
+  // let's match them -> wait REGISTRATION_REFRESH_CYCLE (ecal_def.h)
+  eCAL::Process::SleepMS(2000);
+
+  // response in time
+  {
+    auto futures = client.CallFuture("foo::method1", "10", 1000);
+    ASSERT_EQ(1, futures.size());
+    const auto service_response = futures[0].get();
+    EXPECT_EQ(call_state_executed, service_response.call_state);
+    EXPECT_EQ(42, service_response.ret_state);
+    EXPECT_EQ("10", service_response.response);
+  }
+
+  // timeout
+  {
+    auto futures = client.CallFuture("foo::method1", "500", 100);
+    ASSERT_EQ(1, futures.size());
+    EXPECT_EQ(std::future_status::ready, futures[0].wait_for(std::chrono::milliseconds(400)));
+    const auto service_response = futures[0].get();
+    EXPECT_EQ(call_state_failed, service_response.call_state);
+    EXPECT_EQ("Timeout", service_response.error_msg);
+    EXPECT_EQ("foo::method1", service_response.method_name);
+  }
+
+  // let the server finish the timed out call
+  eCAL::Process::SleepMS(500);
+
+  // cancellation
+  {
+    eCAL::ServiceCallIdT call_id(0);
+    auto futures = client.CallFuture("foo::method1", "500", -1, &call_id);
+    ASSERT_EQ(1, futures.size());
+    EXPECT_TRUE(client.CancelCall(call_id));
+    EXPECT_FALSE(client.CancelCall(call_id));
+    EXPECT_EQ(std::future_status::ready, futures[0].wait_for(std::chrono::milliseconds(0)));
+    const auto service_response = futures[0].get();
+    EXPECT_EQ(call_state_failed, service_response.call_state);
+    EXPECT_EQ("Cancelled", service_response.error_msg);
+  }
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+#endif /* ClientServerFutureTest */
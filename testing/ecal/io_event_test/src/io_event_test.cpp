@@ -0,0 +1,202 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "io/evt/linux/ecal_named_event_futex.h"
+#include "io/evt/linux/ecal_named_event_pthread.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include <time.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  struct SPthreadEvent
+  {
+    typedef named_event_t event_t;
+    static const char* Name()                                     { return "pthread"; }
+    static event_t* Create(const char* name_)                     { return eCAL::named_event_create(name_); }
+    static int      Destroy(const char* name_)                    { return eCAL::named_event_destroy(name_); }
+    static event_t* Open(const char* name_)                       { return eCAL::named_event_open(name_); }
+    static void     Close(event_t* evt_)                          { eCAL::named_event_close(evt_); }
+    static void     Set(event_t* evt_)                            { eCAL::named_event_set(evt_); }
+    static bool     Wait(event_t* evt_, struct timespec* ts_)     { return eCAL::named_event_wait(evt_, ts_); }
+    static bool     TryWait(event_t* evt_)                        { return eCAL::named_event_trywait(evt_); }
+  };
+
+  struct SFutexEvent
+  {
+    typedef futex_event_t event_t;
+    static const char* Name()                                     { return "futex"; }
+    static event_t* Create(const char* name_)                     { return eCAL::futex_event_create(name_); }
+    static int      Destroy(const char* name_)                    { return eCAL::futex_event_destroy(name_); }
+    static event_t* Open(const char* name_)                       { return eCAL::futex_event_open(name_); }
+    static void     Close(event_t* evt_)                          { eCAL::futex_event_close(evt_); }
+    static void     Set(event_t* evt_)                            { eCAL::futex_event_set(evt_); }
+    static bool     Wait(event_t* evt_, struct timespec* ts_)     { return eCAL::futex_event_wait(evt_, ts_); }
+    static bool     TryWait(event_t* evt_)                        { return eCAL::futex_event_trywait(evt_); }
+  };
+
+  std::string EventName(const char* backend_, const char* test_)
+  {
+    return std::string("/ecal_io_event_test_") + backend_ + "_" + test_ + "_" + std::to_string(getpid());
+  }
+
+  struct timespec AbsTime(long timeout_ms_)
+  {
+    struct timespec abstime;
+    clock_gettime(CLOCK_MONOTONIC, &abstime);
+    abstime.tv_sec  += timeout_ms_ / 1000;
+    abstime.tv_nsec += (timeout_ms_ % 1000) * 1000000;
+    while (abstime.tv_nsec >= 1000000000)
+    {
+      abstime.tv_nsec -= 1000000000;
+      abstime.tv_sec++;
+    }
+    return abstime;
+  }
+}
+
+template <typename T>
+class NamedEvent : public ::testing::Test
+{
+};
+
+typedef ::testing::Types<SPthreadEvent, SFutexEvent> EventBackends;
+TYPED_TEST_CASE(NamedEvent, EventBackends);
+
+TYPED_TEST(NamedEvent, SetTryWait)
+{
+  const std::string name = EventName(TypeParam::Name(), "settrywait");
+  auto* evt = TypeParam::Create(name.c_str());
+  ASSERT_NE(nullptr, evt);
+
+  // creating twice fails, opening works
+  EXPECT_EQ(nullptr, TypeParam::Create(name.c_str()));
+  auto* evt_open = TypeParam::Open(name.c_str());
+  ASSERT_NE(nullptr, evt_open);
+
+  // initially unset
+  EXPECT_FALSE(TypeParam::TryWait(evt));
+
+  // set on one handle, consume on the other one (auto reset)
+  TypeParam::Set(evt);
+  EXPECT_TRUE(TypeParam::TryWait(evt_open));
+  EXPECT_FALSE(TypeParam::TryWait(evt_open));
+
+  // multiple sets collapse into one
+  TypeParam::Set(evt);
+  TypeParam::Set(evt);
+  EXPECT_TRUE(TypeParam::TryWait(evt));
+  EXPECT_FALSE(TypeParam::TryWait(evt));
+
+  TypeParam::Close(evt_open);
+  TypeParam::Close(evt);
+  EXPECT_EQ(0, TypeParam::Destroy(name.c_str()));
+  EXPECT_EQ(nullptr, TypeParam::Open(name.c_str()));
+}
+
+TYPED_TEST(NamedEvent, WaitTimeout)
+{
+  const std::string name = EventName(TypeParam::Name(), "timeout");
+  auto* evt = TypeParam::Create(name.c_str());
+  ASSERT_NE(nullptr, evt);
+
+  // not set -> timeout
+  auto start = std::chrono::steady_clock::now();
+  struct timespec abstime = AbsTime(50);
+  EXPECT_FALSE(TypeParam::Wait(evt, &abstime));
+  EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(45));
+
+  // set -> returns immediately
+  TypeParam::Set(evt);
+  abstime = AbsTime(1000);
+  EXPECT_TRUE(TypeParam::Wait(evt, &abstime));
+
+  TypeParam::Close(evt);
+  TypeParam::Destroy(name.c_str());
+}
+
+TYPED_TEST(NamedEvent, WaitWakeup)
+{
+  const std::string name = EventName(TypeParam::Name(), "wakeup");
+  auto* evt = TypeParam::Create(name.c_str());
+  ASSERT_NE(nullptr, evt);
+
+  std::atomic<bool> woken(false);
+  std::thread waiter([&]()
+    {
+      auto* evt_open = TypeParam::Open(name.c_str());
+      woken = TypeParam::Wait(evt_open, nullptr);
+      TypeParam::Close(evt_open);
+    });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(woken);
+  TypeParam::Set(evt);
+  waiter.join();
+  EXPECT_TRUE(woken);
+
+  TypeParam::Close(evt);
+  TypeParam::Destroy(name.c_str());
+}
+
+TYPED_TEST(NamedEvent, PingPong)
+{
+  const std::string ping_name = EventName(TypeParam::Name(), "ping");
+  const std::string pong_name = EventName(TypeParam::Name(), "pong");
+  auto* ping = TypeParam::Create(ping_name.c_str());
+  auto* pong = TypeParam::Create(pong_name.c_str());
+  ASSERT_NE(nullptr, ping);
+  ASSERT_NE(nullptr, pong);
+
+  const int loops(10000);
+  std::atomic<int> missed(0);
+  std::thread partner([&]()
+    {
+      for (int i = 0; i < loops; ++i)
+      {
+        struct timespec abstime = AbsTime(1000);
+        if (!TypeParam::Wait(ping, &abstime)) missed++;
+        TypeParam::Set(pong);
+      }
+    });
+
+  for (int i = 0; i < loops; ++i)
+  {
+    TypeParam::Set(ping);
+    struct timespec abstime = AbsTime(1000);
+    if (!TypeParam::Wait(pong, &abstime)) missed++;
+  }
+  partner.join();
+
+  // every set has to wake up the other side, nothing gets lost
+  EXPECT_EQ(0, missed);
+
+  TypeParam::Close(ping);
+  TypeParam::Close(pong);
+  TypeParam::Destroy(ping_name.c_str());
+  TypeParam::Destroy(pong_name.c_str());
+}
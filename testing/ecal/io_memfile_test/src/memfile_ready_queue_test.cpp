@@ -0,0 +1,184 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "io/shm/ecal_memfile_ready_queue.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  const std::string queue_name = "ready_queue_test";
+}
+
+TEST(MemFileReadyQueue, PushPopAll)
+{
+  // subscriber side creates the queue, publisher side opens it
+  eCAL::CMemFileReadyQueue reader;
+  eCAL::CMemFileReadyQueue writer;
+  ASSERT_TRUE(reader.Create(queue_name, true, 8));
+  ASSERT_TRUE(writer.Create(queue_name, false, 8));
+
+  std::vector<std::uint64_t> file_ids;
+  EXPECT_TRUE(reader.PopAll(file_ids));
+  EXPECT_TRUE(file_ids.empty());
+
+  // ids are returned in push order
+  for (std::uint64_t id = 1; id <= 5; ++id) EXPECT_TRUE(writer.Push(id));
+  EXPECT_TRUE(reader.PopAll(file_ids));
+  EXPECT_EQ(std::vector<std::uint64_t>({ 1, 2, 3, 4, 5 }), file_ids);
+
+  // the queue is empty again
+  EXPECT_TRUE(reader.PopAll(file_ids));
+  EXPECT_TRUE(file_ids.empty());
+
+  writer.Destroy();
+  reader.Destroy();
+}
+
+TEST(MemFileReadyQueue, Overflow)
+{
+  eCAL::CMemFileReadyQueue reader;
+  eCAL::CMemFileReadyQueue writer;
+  ASSERT_TRUE(reader.Create(queue_name, true, 4));
+  ASSERT_TRUE(writer.Create(queue_name, false, 4));
+
+  // the publisher never waits, new ids are dropped and the reader is told so
+  for (std::uint64_t id = 1; id <= 4; ++id) EXPECT_TRUE(writer.Push(id));
+  EXPECT_FALSE(writer.Push(5));
+  EXPECT_FALSE(writer.Push(6));
+  std::vector<std::uint64_t> file_ids;
+  EXPECT_FALSE(reader.PopAll(file_ids));
+  EXPECT_EQ(std::vector<std::uint64_t>({ 1, 2, 3, 4 }), file_ids);
+
+  // overflow is reported only once
+  EXPECT_TRUE(writer.Push(7));
+  EXPECT_TRUE(reader.PopAll(file_ids));
+  EXPECT_EQ(std::vector<std::uint64_t>({ 7 }), file_ids);
+
+  writer.Destroy();
+  reader.Destroy();
+}
+
+TEST(MemFileReadyQueue, WrapAround)
+{
+  eCAL::CMemFileReadyQueue reader;
+  eCAL::CMemFileReadyQueue writer;
+  ASSERT_TRUE(reader.Create(queue_name, true, 3));
+  ASSERT_TRUE(writer.Create(queue_name, false, 3));
+
+  // push and pop many rounds with a changing fill level
+  std::uint64_t next_push(0);
+  std::uint64_t next_pop(0);
+  std::vector<std::uint64_t> file_ids;
+  for (int round = 0; round < 1000; ++round)
+  {
+    for (int count = 0; count < (round % 3) + 1; ++count)
+    {
+      EXPECT_TRUE(writer.Push(next_push++));
+    }
+    EXPECT_TRUE(reader.PopAll(file_ids));
+    for (const auto id : file_ids) EXPECT_EQ(next_pop++, id);
+  }
+  EXPECT_EQ(next_push, next_pop);
+
+  writer.Destroy();
+  reader.Destroy();
+}
+
+TEST(MemFileReadyQueue, MultiWriter)
+{
+  const int writer_count(4);
+  const std::uint64_t ids_per_writer(5000);
+
+  eCAL::CMemFileReadyQueue reader;
+  ASSERT_TRUE(reader.Create(queue_name, true, 16));
+
+  // every writer thread opens the queue (like a publisher process) and pushes its ids
+  std::vector<std::thread> writers;
+  for (int writer_idx = 0; writer_idx < writer_count; ++writer_idx)
+  {
+    writers.emplace_back([writer_idx, ids_per_writer]()
+      {
+        eCAL::CMemFileReadyQueue writer;
+        if (!writer.Create(queue_name, false, 16)) return;
+        for (std::uint64_t id = 0; id < ids_per_writer; ++id)
+        {
+          while (!writer.Push(writer_idx * ids_per_writer + id)) std::this_thread::yield();
+        }
+        writer.Destroy();
+      });
+  }
+
+  // every id arrives once and in order per writer
+  std::vector<std::uint64_t> next_id(writer_count, 0);
+  std::uint64_t received(0);
+  std::vector<std::uint64_t> file_ids;
+  const auto start = std::chrono::steady_clock::now();
+  while ((received < writer_count * ids_per_writer) && (std::chrono::steady_clock::now() - start < std::chrono::seconds(30)))
+  {
+    reader.PopAll(file_ids);
+    for (const auto id : file_ids)
+    {
+      const auto writer_idx = static_cast<size_t>(id / ids_per_writer);
+      ASSERT_LT(writer_idx, next_id.size());
+      EXPECT_EQ(next_id[writer_idx]++, id % ids_per_writer);
+    }
+    received += file_ids.size();
+    if (file_ids.empty()) std::this_thread::yield();
+  }
+  for (auto& writer : writers) writer.join();
+
+  EXPECT_EQ(writer_count * ids_per_writer, received);
+
+  reader.Destroy();
+}
+
+TEST(MemFileReadyQueue, NoReader)
+{
+  // a publisher can not open the queue of a process without pooled observers
+  eCAL::CMemFileReadyQueue writer;
+  EXPECT_FALSE(writer.Create(queue_name, false, 8));
+  EXPECT_FALSE(writer.IsCreated());
+  EXPECT_FALSE(writer.Push(1));
+
+  // and it does not leave a queue behind
+  eCAL::CMemFileReadyQueue reader;
+  ASSERT_TRUE(reader.Create(queue_name, true, 8));
+  ASSERT_TRUE(writer.Create(queue_name, false, 8));
+  std::vector<std::uint64_t> file_ids;
+  EXPECT_TRUE(reader.PopAll(file_ids));
+  EXPECT_TRUE(file_ids.empty());
+
+  writer.Destroy();
+  reader.Destroy();
+}
+
+TEST(MemFileReadyQueue, FileId)
+{
+  // ids are stable over processes and builds
+  EXPECT_EQ(eCAL::CMemFileReadyQueue::BuildFileId("ecal_1a2b3c4d"), eCAL::CMemFileReadyQueue::BuildFileId("ecal_1a2b3c4d"));
+  EXPECT_NE(eCAL::CMemFileReadyQueue::BuildFileId("ecal_1a2b3c4d"), eCAL::CMemFileReadyQueue::BuildFileId("ecal_1a2b3c4e"));
+  EXPECT_EQ(UINT64_C(14695981039346656037), eCAL::CMemFileReadyQueue::BuildFileId(""));
+}
@@ -0,0 +1,215 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "io/shm/ecal_memfile_ring.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  class CStringPayload : public eCAL::CPayloadWriter
+  {
+  public:
+    explicit CStringPayload(const std::string& content_) : m_content(content_) {}
+
+    bool WriteFull(void* buffer_, size_t size_) override
+    {
+      if (size_ < m_content.size()) return false;
+      memcpy(buffer_, m_content.data(), m_content.size());
+      return true;
+    }
+
+    size_t GetSize() override { return m_content.size(); }
+
+  private:
+    std::string m_content;
+  };
+
+  bool WriteString(eCAL::CMemoryFileRing& ring_, const std::string& content_, uint64_t clock_)
+  {
+    CStringPayload payload(content_);
+    eCAL::SMemFileHeader memfile_hdr;
+    memfile_hdr.data_size = content_.size();
+    memfile_hdr.clock     = clock_;
+    return ring_.Write(payload, memfile_hdr);
+  }
+}
+
+TEST(MemFileRing, RingReadWrite)
+{
+  const size_t slot_count(4);
+  const size_t slot_size(64);
+
+  std::vector<uint64_t> memory(eCAL::CMemoryFileRing::PresumablyOccupiedMemorySize(slot_count, slot_size) / sizeof(uint64_t) + 1);
+  eCAL::CMemoryFileRing ring;
+  ring.SetBaseAddress(memory.data());
+  ring.Reset(slot_count, slot_size);
+
+  EXPECT_TRUE(ring.IsValid());
+  EXPECT_EQ(slot_count, ring.SlotCount());
+  EXPECT_EQ(slot_size,  ring.SlotSize());
+  EXPECT_EQ(0, ring.WriteCount());
+
+  // payload too large for a slot
+  EXPECT_FALSE(WriteString(ring, std::string(slot_size + 1, 'x'), 1));
+  EXPECT_EQ(0, ring.WriteCount());
+
+  // write and read back
+  EXPECT_TRUE(WriteString(ring, "Hello World", 1));
+  EXPECT_EQ(1, ring.WriteCount());
+
+  eCAL::SMemFileHeader memfile_hdr;
+  std::vector<char> buffer;
+  EXPECT_TRUE(ring.Read(0, memfile_hdr, buffer));
+  EXPECT_EQ(1, memfile_hdr.clock);
+  EXPECT_EQ(std::string("Hello World"), std::string(buffer.begin(), buffer.end()));
+
+  // not written yet
+  EXPECT_FALSE(ring.Read(1, memfile_hdr, buffer));
+}
+
+TEST(MemFileRing, RingOverwrite)
+{
+  const size_t slot_count(4);
+  const size_t slot_size(64);
+
+  std::vector<uint64_t> memory(eCAL::CMemoryFileRing::PresumablyOccupiedMemorySize(slot_count, slot_size) / sizeof(uint64_t) + 1);
+  eCAL::CMemoryFileRing ring;
+  ring.SetBaseAddress(memory.data());
+  ring.Reset(slot_count, slot_size);
+
+  // writer laps the ring, it never waits
+  for (uint64_t clock = 1; clock <= 2 * slot_count; ++clock)
+  {
+    EXPECT_TRUE(WriteString(ring, std::to_string(clock), clock));
+  }
+  EXPECT_EQ(2 * slot_count, ring.WriteCount());
+
+  eCAL::SMemFileHeader memfile_hdr;
+  std::vector<char> buffer;
+
+  // oldest samples are overwritten
+  for (uint64_t index = 0; index < slot_count; ++index)
+  {
+    EXPECT_FALSE(ring.Read(index, memfile_hdr, buffer));
+  }
+
+  // latest samples are available
+  for (uint64_t index = slot_count; index < 2 * slot_count; ++index)
+  {
+    EXPECT_TRUE(ring.Read(index, memfile_hdr, buffer));
+    EXPECT_EQ(index + 1, memfile_hdr.clock);
+    EXPECT_EQ(std::to_string(index + 1), std::string(buffer.begin(), buffer.end()));
+  }
+}
+
+TEST(MemFileRing, RingConcurrency)
+{
+  const size_t   slot_count(8);
+  const size_t   slot_size(256);
+  const uint64_t write_loops(100000);
+
+  std::vector<uint64_t> memory(eCAL::CMemoryFileRing::PresumablyOccupiedMemorySize(slot_count, slot_size) / sizeof(uint64_t) + 1);
+  eCAL::CMemoryFileRing ring;
+  ring.SetBaseAddress(memory.data());
+  ring.Reset(slot_count, slot_size);
+
+  std::atomic<bool> done(false);
+  std::atomic<uint64_t> corrupted(0);
+
+  // reader checks that every sample it accepts is consistent
+  std::thread reader([&]()
+    {
+      eCAL::SMemFileHeader memfile_hdr;
+      std::vector<char> buffer;
+      uint64_t read_count(0);
+      while (!done || read_count < ring.WriteCount())
+      {
+        const uint64_t write_count = ring.WriteCount();
+        if (write_count - read_count > slot_count) read_count = write_count - slot_count;
+        for (; read_count < write_count; ++read_count)
+        {
+          if (!ring.Read(read_count, memfile_hdr, buffer)) continue;
+          const std::string expected(static_cast<size_t>(memfile_hdr.clock % slot_size) + 1, static_cast<char>('a' + memfile_hdr.clock % 26));
+          if ((memfile_hdr.clock != read_count) || (std::string(buffer.begin(), buffer.end()) != expected)) corrupted++;
+        }
+      }
+    });
+
+  for (uint64_t clock = 0; clock < write_loops; ++clock)
+  {
+    const std::string content(static_cast<size_t>(clock % slot_size) + 1, static_cast<char>('a' + clock % 26));
+    WriteString(ring, content, clock);
+  }
+  done = true;
+  reader.join();
+
+  EXPECT_EQ(write_loops, ring.WriteCount());
+  EXPECT_EQ(0, corrupted);
+}
+
+TEST(MemFileRing, RingLoanCommit)
+{
+  const size_t slot_count(4);
+  const size_t slot_size(64);
+
+  std::vector<uint64_t> memory(eCAL::CMemoryFileRing::PresumablyOccupiedMemorySize(slot_count, slot_size) / sizeof(uint64_t) + 1);
+  eCAL::CMemoryFileRing ring;
+  ring.SetBaseAddress(memory.data());
+  ring.Reset(slot_count, slot_size);
+
+  // loan larger than a slot
+  EXPECT_EQ(nullptr, ring.Loan(slot_size + 1));
+
+  // fill the loaned slot and commit the actual length
+  const std::string content("Hello World");
+  void* buf = ring.Loan(slot_size);
+  ASSERT_NE(nullptr, buf);
+  memcpy(buf, content.data(), content.size());
+
+  eCAL::SMemFileHeader memfile_hdr;
+  std::vector<char> buffer;
+  EXPECT_FALSE(ring.Read(0, memfile_hdr, buffer));
+
+  memfile_hdr.data_size = content.size();
+  memfile_hdr.clock     = 1;
+  EXPECT_TRUE(ring.Commit(memfile_hdr));
+  EXPECT_EQ(1, ring.WriteCount());
+
+  EXPECT_TRUE(ring.Read(0, memfile_hdr, buffer));
+  EXPECT_EQ(content, std::string(buffer.begin(), buffer.end()));
+
+  // lap the ring and discard a loan, the overwritten slot must not be readable anymore
+  for (uint64_t clock = 2; clock <= slot_count; ++clock)
+  {
+    EXPECT_TRUE(WriteString(ring, std::to_string(clock), clock));
+  }
+  ASSERT_NE(nullptr, ring.Loan(slot_size));
+  ring.Discard();
+  EXPECT_EQ(slot_count, ring.WriteCount());
+  EXPECT_FALSE(ring.Read(0, memfile_hdr, buffer));
+  EXPECT_TRUE(ring.Read(1, memfile_hdr, buffer));
+}
@@ -18,11 +18,13 @@
 */
 
 #include <ecal/ecal.h>
+#include <ecal/ecal_payload_writer.h>
 #include "io/shm/ecal_memfile.h"
 #include "io/shm/ecal_memfile_db.h"
 
 #include <atomic>
 #include <chrono>
+#include <cstring>
 #include <memory>
 #include <iostream>
 #include <thread>
@@ -243,23 +245,29 @@ TEST(MemFile, MemfileConcurrency)
   auto num_reads1(0);
   std::thread consumer1([&]()
     {
+      // every consumer has its own access object, read access is shared between them
+      eCAL::CMemoryFile reader;
+      EXPECT_EQ(true, reader.Create(memfile_name.c_str(), false));
+
       std::vector<int> read_buf;
       read_buf.resize(buflen);
 
       for (int i = 0; i != runs; ++i)
       {
-        EXPECT_EQ(true, mem_file.GetReadAccess(100));
-        if (mem_file.HasReadAccess())
+        EXPECT_EQ(true, reader.GetReadAccess(100));
+        if (reader.HasReadAccess())
         {
-          auto read = mem_file.Read((void*)read_buf.data(), read_buf.size(), 0);
+          auto read = reader.Read((void*)read_buf.data(), read_buf.size(), 0);
           EXPECT_EQ(buflen, read);
           std::cout << "consumer 1 read access : " << num_reads1 << " with " << read_buf[0] << std::endl;
-          EXPECT_EQ(true, mem_file.ReleaseReadAccess());
+          EXPECT_EQ(true, reader.ReleaseReadAccess());
           std::this_thread::sleep_for(std::chrono::milliseconds(1));
           //EXPECT_EQ(read_buf[0], num_reads1);
           num_reads1++;
         }
       }
+
+      EXPECT_EQ(true, reader.Destroy(false));
     });
   std::this_thread::sleep_for(std::chrono::milliseconds(1));
 
@@ -267,23 +275,29 @@ TEST(MemFile, MemfileConcurrency)
   auto num_reads2(0);
   std::thread consumer2([&]()
     {
+      // every consumer has its own access object, read access is shared between them
+      eCAL::CMemoryFile reader;
+      EXPECT_EQ(true, reader.Create(memfile_name.c_str(), false));
+
       std::vector<int> read_buf;
       read_buf.resize(buflen);
 
       for (int i = 0; i != runs; ++i)
       {
-        EXPECT_EQ(true, mem_file.GetReadAccess(100));
-        if (mem_file.HasReadAccess())
+        EXPECT_EQ(true, reader.GetReadAccess(100));
+        if (reader.HasReadAccess())
         {
-          auto read = mem_file.Read((void*)read_buf.data(), read_buf.size(), 0);
+          auto read = reader.Read((void*)read_buf.data(), read_buf.size(), 0);
           EXPECT_EQ(buflen, read);
           std::cout << "consumer 2 read access : " << num_reads2 << " with " << read_buf[0] << std::endl;
-          EXPECT_EQ(true, mem_file.ReleaseReadAccess());
+          EXPECT_EQ(true, reader.ReleaseReadAccess());
           std::this_thread::sleep_for(std::chrono::milliseconds(1));
           //EXPECT_EQ(read_buf[0], num_reads2);
           num_reads2++;
         }
       }
+
+      EXPECT_EQ(true, reader.Destroy(false));
     });
 
   // join threads
@@ -297,3 +311,144 @@ TEST(MemFile, MemfileConcurrency)
   // destroy memory file
   EXPECT_EQ(true, mem_file.Destroy(true));
 }
+
+TEST(MemFile, MemfileSharedReadAccess)
+{
+  eCAL::CMemoryFile mem_file;
+
+  // global parameter
+  const std::string memfile_name = "my_memory_file";
+  const size_t buflen(1024);
+
+  // create memory file and two independent readers
+  EXPECT_EQ(true, mem_file.Create(memfile_name.c_str(), true, buflen));
+
+  eCAL::CMemoryFile reader1;
+  eCAL::CMemoryFile reader2;
+  EXPECT_EQ(true, reader1.Create(memfile_name.c_str(), false));
+  EXPECT_EQ(true, reader2.Create(memfile_name.c_str(), false));
+
+  // both readers can access the file at the same time
+  EXPECT_EQ(true, reader1.GetReadAccess(0));
+  EXPECT_EQ(true, reader2.GetReadAccess(0));
+
+  // the writer has to wait for the readers
+  EXPECT_EQ(false, mem_file.GetWriteAccess(10));
+
+  EXPECT_EQ(true, reader1.ReleaseReadAccess());
+  EXPECT_EQ(false, mem_file.GetWriteAccess(0));
+  EXPECT_EQ(true, reader2.ReleaseReadAccess());
+
+  // the last reader is gone, writer access is exclusive again
+  EXPECT_EQ(true, mem_file.GetWriteAccess(0));
+  EXPECT_EQ(false, reader1.GetReadAccess(0));
+  EXPECT_EQ(true, mem_file.ReleaseWriteAccess());
+  EXPECT_EQ(true, reader1.GetReadAccess(0));
+  EXPECT_EQ(true, reader1.ReleaseReadAccess());
+
+  // destroy memory files
+  EXPECT_EQ(true, reader1.Destroy(false));
+  EXPECT_EQ(true, reader2.Destroy(false));
+  EXPECT_EQ(true, mem_file.Destroy(true));
+}
+
+TEST(MemFile, MemfilePinCount)
+{
+  eCAL::CMemoryFile mem_file;
+
+  const std::string memfile_name = "my_memory_file";
+  const size_t buflen(1024);
+  EXPECT_EQ(true, mem_file.Create(memfile_name.c_str(), true, buflen));
+
+  eCAL::CMemoryFile reader1;
+  eCAL::CMemoryFile reader2;
+  EXPECT_EQ(true, reader1.Create(memfile_name.c_str(), false));
+  EXPECT_EQ(true, reader2.Create(memfile_name.c_str(), false));
+  EXPECT_EQ(0u, mem_file.PinCount());
+
+  // the pins of all readers are visible to the writer
+  EXPECT_EQ(true, reader1.GetReadAccess(0));
+  EXPECT_EQ(true, reader1.AddPin());
+  EXPECT_EQ(true, reader2.GetReadAccess(0));
+  EXPECT_EQ(true, reader2.AddPin());
+  EXPECT_EQ(2u, mem_file.PinCount());
+
+  EXPECT_EQ(true, reader1.RemovePin());
+  EXPECT_EQ(true, reader1.ReleaseReadAccess());
+  EXPECT_EQ(1u, mem_file.PinCount());
+  EXPECT_EQ(true, reader2.RemovePin());
+  EXPECT_EQ(true, reader2.ReleaseReadAccess());
+  EXPECT_EQ(0u, mem_file.PinCount());
+
+  // the counter is not touched by writing
+  EXPECT_EQ(true, mem_file.GetWriteAccess(0));
+  const std::string content(16, 'x');
+  EXPECT_EQ(content.size(), mem_file.WriteBuffer(content.data(), content.size(), 0));
+  EXPECT_EQ(true, mem_file.ReleaseWriteAccess());
+  EXPECT_EQ(0u, mem_file.PinCount());
+
+  EXPECT_EQ(true, reader1.Destroy(false));
+  EXPECT_EQ(true, reader2.Destroy(false));
+  EXPECT_EQ(true, mem_file.Destroy(true));
+}
+
+namespace
+{
+  // counts the full and the modifying write calls
+  class CCountingPayload : public eCAL::CPayloadWriter
+  {
+  public:
+    bool WriteFull(void* buffer_, size_t size_) override
+    {
+      memset(buffer_, 'F', size_);
+      full_writes++;
+      return true;
+    }
+
+    bool WriteModified(void* buffer_, size_t /*size_*/) override
+    {
+      static_cast<char*>(buffer_)[0] = 'M';
+      modified_writes++;
+      return true;
+    }
+
+    size_t GetSize() override { return 16; }
+
+    int full_writes     = 0;
+    int modified_writes = 0;
+  };
+}
+
+TEST(MemFile, MemfileInvalidatePayload)
+{
+  eCAL::CMemoryFile mem_file;
+
+  const std::string memfile_name = "my_memory_file";
+  const size_t buflen(1024);
+  const size_t plen(16);
+  EXPECT_EQ(true, mem_file.Create(memfile_name.c_str(), true, buflen));
+
+  CCountingPayload payload;
+  EXPECT_EQ(true, mem_file.GetWriteAccess(0));
+
+  // first write is complete, the second one only applies the modification
+  EXPECT_EQ(plen, mem_file.WritePayload(payload, plen, 0));
+  EXPECT_EQ(plen, mem_file.WritePayload(payload, plen, 0));
+  EXPECT_EQ(1, payload.full_writes);
+  EXPECT_EQ(1, payload.modified_writes);
+
+  // the payload is overwritten without WritePayload (like a loaned buffer)
+  void* wbuf(nullptr);
+  EXPECT_NE(0u, mem_file.GetWriteAddress(wbuf, plen));
+  memset(wbuf, 'L', plen);
+  mem_file.InvalidatePayload();
+
+  // so the next write has to be complete again
+  EXPECT_EQ(plen, mem_file.WritePayload(payload, plen, 0));
+  EXPECT_EQ(2, payload.full_writes);
+  EXPECT_EQ(1, payload.modified_writes);
+  EXPECT_EQ(std::string(plen, 'F'), std::string(static_cast<const char*>(wbuf), plen));
+
+  EXPECT_EQ(true, mem_file.ReleaseWriteAccess());
+  EXPECT_EQ(true, mem_file.Destroy(true));
+}
@@ -0,0 +1,71 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "io/udp/fragmentation/msg_type.h"
+
+#include <cstdint>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  IO::UDP::SUDPRawSampleHead SampleHead(uint16_t topic_id_size_, uint64_t payload_size_)
+  {
+    IO::UDP::SUDPRawSampleHead sample_head;
+    sample_head.topic_id_size = topic_id_size_;
+    sample_head.payload_size  = payload_size_;
+    return sample_head;
+  }
+}
+
+TEST(UDPRawSample, ValidHead)
+{
+  const size_t hdr_size = sizeof(IO::UDP::SUDPRawSampleHead);
+
+  EXPECT_TRUE(IO::UDP::IsValidRawSampleHead(SampleHead(0, 0),   hdr_size));
+  EXPECT_TRUE(IO::UDP::IsValidRawSampleHead(SampleHead(8, 100), hdr_size + 8 + 100));
+  EXPECT_TRUE(IO::UDP::IsValidRawSampleHead(SampleHead(8, 100), hdr_size + 8 + 200));
+}
+
+TEST(UDPRawSample, DamagedHead)
+{
+  const size_t hdr_size = sizeof(IO::UDP::SUDPRawSampleHead);
+
+  // truncated sample
+  EXPECT_FALSE(IO::UDP::IsValidRawSampleHead(SampleHead(0, 0),   hdr_size - 1));
+  EXPECT_FALSE(IO::UDP::IsValidRawSampleHead(SampleHead(8, 0),   hdr_size + 7));
+  EXPECT_FALSE(IO::UDP::IsValidRawSampleHead(SampleHead(8, 100), hdr_size + 8 + 99));
+
+  // wrong magic
+  auto sample_head = SampleHead(0, 0);
+  sample_head.head[1] = 'X';
+  EXPECT_FALSE(IO::UDP::IsValidRawSampleHead(sample_head, hdr_size));
+
+  // header size smaller than the known header
+  sample_head = SampleHead(0, 0);
+  sample_head.hdr_size = hdr_size - 1;
+  EXPECT_FALSE(IO::UDP::IsValidRawSampleHead(sample_head, hdr_size));
+
+  // payload sizes that wrap around the sum of all sizes
+  const uint64_t max_size = std::numeric_limits<uint64_t>::max();
+  EXPECT_FALSE(IO::UDP::IsValidRawSampleHead(SampleHead(8, max_size),                       hdr_size + 8));
+  EXPECT_FALSE(IO::UDP::IsValidRawSampleHead(SampleHead(8, max_size - hdr_size - 8 + 1),    hdr_size + 8));
+  EXPECT_FALSE(IO::UDP::IsValidRawSampleHead(SampleHead(8, max_size - hdr_size - 8 + 1000), hdr_size + 8 + 100));
+}
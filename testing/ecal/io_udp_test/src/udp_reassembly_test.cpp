@@ -0,0 +1,296 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "io/udp/fragmentation/msg_type.h"
+#include "io/udp/fragmentation/rcv_fragments.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  constexpr size_t payload_size = sizeof(IO::UDP::SUDPMessage::payload);
+
+  class CTestReassembly : public IO::UDP::CMsgReassembly
+  {
+  public:
+    CTestReassembly(size_t max_messages_, const std::chrono::milliseconds& timeout_) : CMsgReassembly(max_messages_, timeout_) {}
+    CTestReassembly(size_t max_messages_, const std::chrono::milliseconds& timeout_, size_t max_message_size_, size_t max_pool_size_) : CMsgReassembly(max_messages_, timeout_, max_message_size_, max_pool_size_) {}
+
+    std::vector<std::string> messages;
+    std::vector<const char*> buffers;
+    std::vector<size_t>      too_large;
+
+  protected:
+    void OnMessageCompleted(const char* buf_, size_t len_) override
+    {
+      messages.emplace_back(buf_, len_);
+      buffers.push_back(buf_);
+    }
+
+    void OnMessageTooLarge(int32_t /*message_id_*/, size_t len_) override
+    {
+      too_large.push_back(len_);
+    }
+  };
+
+  // split a message into its start and data packages
+  std::vector<std::unique_ptr<IO::UDP::SUDPMessage>> Fragment(const std::string& content_, int32_t id_)
+  {
+    std::vector<std::unique_ptr<IO::UDP::SUDPMessage>> packages;
+
+    const int32_t total_num = static_cast<int32_t>((content_.size() + payload_size - 1) / payload_size);
+    packages.emplace_back(new IO::UDP::SUDPMessage);
+    packages.back()->header.type = IO::UDP::msg_type_header;
+    packages.back()->header.id   = id_;
+    packages.back()->header.num  = total_num;
+    packages.back()->header.len  = static_cast<int32_t>(content_.size());
+
+    for (int32_t num = 0; num < total_num; ++num)
+    {
+      const size_t offset = static_cast<size_t>(num) * payload_size;
+      const size_t len    = std::min(content_.size() - offset, static_cast<size_t>(payload_size));
+      packages.emplace_back(new IO::UDP::SUDPMessage);
+      packages.back()->header.type = IO::UDP::msg_type_content;
+      packages.back()->header.id   = id_;
+      packages.back()->header.num  = num;
+      packages.back()->header.len  = static_cast<int32_t>(len);
+      memcpy(packages.back()->payload, content_.data() + offset, len);
+    }
+    return packages;
+  }
+
+  std::string Content(size_t len_, char seed_)
+  {
+    std::string content(len_, '\0');
+    for (size_t idx = 0; idx < len_; ++idx) content[idx] = static_cast<char>(seed_ + idx % 61);
+    return content;
+  }
+}
+
+TEST(UDPReassembly, Interleaved)
+{
+  CTestReassembly reassembly(4, std::chrono::milliseconds(1000));
+
+  const std::string content_a = Content(3 * payload_size + 17, 'a');
+  const std::string content_b = Content(2 * payload_size, 'A');
+  auto packages_a = Fragment(content_a, 1);
+  auto packages_b = Fragment(content_b, 2);
+
+  // packages of both messages arrive interleaved
+  for (size_t idx = 0; idx < std::max(packages_a.size(), packages_b.size()); ++idx)
+  {
+    if (idx < packages_a.size()) reassembly.ApplyMessage(*packages_a[idx]);
+    if (idx < packages_b.size()) reassembly.ApplyMessage(*packages_b[idx]);
+  }
+
+  ASSERT_EQ(2, reassembly.messages.size());
+  EXPECT_EQ(content_b, reassembly.messages[0]);
+  EXPECT_EQ(content_a, reassembly.messages[1]);
+
+  const IO::UDP::SReassemblyCounters counters = reassembly.GetCounters();
+  EXPECT_EQ(0, counters.in_flight);
+  EXPECT_EQ(2, counters.completed);
+  EXPECT_EQ(0, counters.dropped);
+}
+
+TEST(UDPReassembly, BufferRecycling)
+{
+  CTestReassembly reassembly(4, std::chrono::milliseconds(1000));
+
+  // messages of a similar size reuse the same buffer
+  for (int32_t id = 1; id <= 10; ++id)
+  {
+    const std::string content = Content(2 * payload_size + static_cast<size_t>(id), static_cast<char>('a' + id));
+    for (const auto& package : Fragment(content, id)) reassembly.ApplyMessage(*package);
+    ASSERT_EQ(static_cast<size_t>(id), reassembly.messages.size());
+    EXPECT_EQ(content, reassembly.messages.back());
+    EXPECT_EQ(reassembly.buffers.front(), reassembly.buffers.back());
+  }
+}
+
+TEST(UDPReassembly, LostPackage)
+{
+  CTestReassembly reassembly(4, std::chrono::milliseconds(1000));
+
+  // second data package is missing, the message is aborted on the third one
+  auto packages = Fragment(Content(3 * payload_size, 'a'), 1);
+  reassembly.ApplyMessage(*packages[0]);
+  reassembly.ApplyMessage(*packages[1]);
+  EXPECT_EQ(1, reassembly.GetCounters().in_flight);
+  reassembly.ApplyMessage(*packages[3]);
+
+  EXPECT_EQ(0, reassembly.messages.size());
+  EXPECT_EQ(0, reassembly.GetCounters().in_flight);
+  EXPECT_EQ(1, reassembly.GetCounters().dropped);
+}
+
+TEST(UDPReassembly, Timeout)
+{
+  CTestReassembly reassembly(4, std::chrono::milliseconds(10));
+
+  auto packages = Fragment(Content(2 * payload_size, 'a'), 1);
+  reassembly.ApplyMessage(*packages[0]);
+  reassembly.ApplyMessage(*packages[1]);
+
+  reassembly.RemoveTimedOutMessages();
+  EXPECT_EQ(1, reassembly.GetCounters().in_flight);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  reassembly.RemoveTimedOutMessages();
+  EXPECT_EQ(0, reassembly.GetCounters().in_flight);
+  EXPECT_EQ(1, reassembly.GetCounters().timed_out);
+
+  // late package of the removed message is ignored
+  reassembly.ApplyMessage(*packages[2]);
+  EXPECT_EQ(0, reassembly.messages.size());
+}
+
+TEST(UDPReassembly, SlotExhaustion)
+{
+  CTestReassembly reassembly(2, std::chrono::milliseconds(1000));
+
+  std::vector<std::vector<std::unique_ptr<IO::UDP::SUDPMessage>>> messages;
+  for (int32_t id = 1; id <= 3; ++id)
+  {
+    messages.push_back(Fragment(Content(2 * payload_size, static_cast<char>('a' + id)), id));
+    reassembly.ApplyMessage(*messages.back()[0]);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  // the oldest message was aborted to make room for the third one
+  EXPECT_EQ(2, reassembly.GetCounters().in_flight);
+  EXPECT_EQ(1, reassembly.GetCounters().dropped);
+
+  for (const auto& message : messages)
+  {
+    for (size_t idx = 1; idx < message.size(); ++idx) reassembly.ApplyMessage(*message[idx]);
+  }
+  EXPECT_EQ(2, reassembly.messages.size());
+  EXPECT_EQ(2, reassembly.GetCounters().completed);
+}
+
+TEST(UDPReassembly, Discard)
+{
+  CTestReassembly reassembly(4, std::chrono::milliseconds(1000));
+
+  auto packages = Fragment(Content(2 * payload_size, 'a'), 1);
+  reassembly.ApplyMessage(*packages[0]);
+  reassembly.DiscardMessage(1);
+  for (size_t idx = 1; idx < packages.size(); ++idx) reassembly.ApplyMessage(*packages[idx]);
+
+  EXPECT_EQ(0, reassembly.messages.size());
+  EXPECT_EQ(0, reassembly.GetCounters().in_flight);
+  EXPECT_EQ(0, reassembly.GetCounters().dropped);
+}
+
+TEST(UDPReassembly, MessageTooLarge)
+{
+  CTestReassembly reassembly(4, std::chrono::milliseconds(1000), 2 * payload_size, NET_UDP_REASSEMBLY_MAX_POOL_SIZE);
+
+  // the announced length exceeds the maximum, no buffer is taken for it
+  for (const auto& package : Fragment(Content(2 * payload_size + 1, 'a'), 1)) reassembly.ApplyMessage(*package);
+  EXPECT_EQ(0, reassembly.messages.size());
+  EXPECT_EQ(0, reassembly.GetCounters().in_flight);
+  EXPECT_EQ(1, reassembly.GetCounters().dropped);
+  ASSERT_EQ(1, reassembly.too_large.size());
+  EXPECT_EQ(2 * payload_size + 1, reassembly.too_large[0]);
+
+  const std::string content = Content(2 * payload_size, 'b');
+  for (const auto& package : Fragment(content, 2)) reassembly.ApplyMessage(*package);
+  ASSERT_EQ(1, reassembly.messages.size());
+  EXPECT_EQ(content, reassembly.messages[0]);
+}
+
+TEST(UDPReassembly, PoolLimit)
+{
+  auto packages_a = Fragment(Content(2 * payload_size, 'a'), 1);
+  auto packages_b = Fragment(Content(2 * payload_size, 'b'), 2);
+  auto apply_interleaved = [&packages_a, &packages_b](CTestReassembly& reassembly_)
+  {
+    for (size_t idx = 0; idx < packages_a.size(); ++idx)
+    {
+      reassembly_.ApplyMessage(*packages_a[idx]);
+      reassembly_.ApplyMessage(*packages_b[idx]);
+    }
+  };
+
+  // both buffers are kept for reuse
+  CTestReassembly reassembly(4, std::chrono::milliseconds(1000));
+  apply_interleaved(reassembly);
+  ASSERT_EQ(2, reassembly.messages.size());
+  const uint64_t buffer_size = reassembly.GetCounters().pooled / 2;
+  EXPECT_LT(0, buffer_size);
+
+  // the pool holds one buffer only, the other one is freed
+  CTestReassembly limited_reassembly(4, std::chrono::milliseconds(1000), NET_UDP_REASSEMBLY_MAX_MESSAGE_SIZE, static_cast<size_t>(buffer_size));
+  apply_interleaved(limited_reassembly);
+  ASSERT_EQ(2, limited_reassembly.messages.size());
+  EXPECT_EQ(buffer_size, limited_reassembly.GetCounters().pooled);
+}
+
+TEST(UDPReassembly, BufferSize)
+{
+  CTestReassembly reassembly(4, std::chrono::milliseconds(1000));
+
+  // the buffer is not rounded up to the next power of two
+  const size_t len = 1024 * 1024 + 1;
+  for (const auto& package : Fragment(Content(len, 'a'), 1)) reassembly.ApplyMessage(*package);
+  ASSERT_EQ(1, reassembly.messages.size());
+  EXPECT_LE(len, reassembly.GetCounters().pooled);
+  EXPECT_GT(len + len / 8, reassembly.GetCounters().pooled);
+
+  // a smaller message reuses the larger buffer
+  for (const auto& package : Fragment(Content(len / 2, 'b'), 2)) reassembly.ApplyMessage(*package);
+  ASSERT_EQ(2, reassembly.messages.size());
+  EXPECT_EQ(reassembly.buffers[0], reassembly.buffers[1]);
+}
+
+TEST(UDPReassembly, PoolPressure)
+{
+  // the pool holds two of the buffers
+  const size_t len = 4 * payload_size;
+  CTestReassembly reassembly(4, std::chrono::milliseconds(10), NET_UDP_REASSEMBLY_MAX_MESSAGE_SIZE, 2 * len + len / 2);
+
+  std::vector<std::vector<std::unique_ptr<IO::UDP::SUDPMessage>>> packages;
+  for (int32_t id = 1; id <= 3; ++id) packages.push_back(Fragment(Content(len, static_cast<char>('a' + id)), id));
+
+  // three messages in flight, the first recycled buffer is freed to make room for the third one
+  for (size_t idx = 0; idx < packages[0].size(); ++idx)
+  {
+    for (auto& message_packages : packages) reassembly.ApplyMessage(*message_packages[idx]);
+  }
+  ASSERT_EQ(3, reassembly.messages.size());
+  const uint64_t pooled = reassembly.GetCounters().pooled;
+  EXPECT_LE(2 * len, pooled);
+  EXPECT_GE(2 * len + len / 2, pooled);
+
+  // idle buffers are kept, no matter how long they are not used
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  reassembly.RemoveTimedOutMessages();
+  EXPECT_EQ(pooled, reassembly.GetCounters().pooled);
+}
@@ -0,0 +1,213 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#define CMN_REGISTRATION_REFRESH   1000
+#define DATA_FLOW_TIME               50
+
+namespace
+{
+  // all tests of this process serve their memory files from a pool of two observer threads
+  void InitializePool(const char* unit_name_)
+  {
+    std::vector<std::string> args =
+    {
+      "pubsub_pool_test",
+      "--ecal-set-config-key", "experimental/shm_observer_threads:2",
+    };
+    std::vector<char*> argv;
+    for (auto& arg : args) argv.push_back(&arg[0]);
+
+    eCAL::Initialize(static_cast<int>(argv.size()), argv.data(), unit_name_);
+
+    // publish / subscribe match in the same process
+    eCAL::Util::EnableLoopback(true);
+  }
+
+  struct STopic
+  {
+    explicit STopic(const std::string& topic_name_) : sub(topic_name_), pub(topic_name_)
+    {
+      pub.SetLayerMode(eCAL::TLayer::tlayer_all, eCAL::TLayer::smode_off);
+      pub.SetLayerMode(eCAL::TLayer::tlayer_shm, eCAL::TLayer::smode_on);
+      // wait for the subscriber, so no sample is overwritten before it was read
+      pub.ShmSetAcknowledgeTimeout(100);
+
+      sub.AddReceiveCallback([this](const char* /*topic_name_*/, const struct eCAL::SReceiveCallbackData* data_)
+        {
+          const std::lock_guard<std::mutex> lock(mtx);
+          received.emplace_back(static_cast<const char*>(data_->buf), data_->size);
+        });
+    }
+
+    std::vector<std::string> Received()
+    {
+      const std::lock_guard<std::mutex> lock(mtx);
+      return received;
+    }
+
+    eCAL::CSubscriber        sub;
+    eCAL::CPublisher         pub;
+    std::mutex               mtx;
+    std::vector<std::string> received;
+  };
+}
+
+TEST(PubSubPool, ManyTopics)
+{
+  InitializePool("pubsub pool many topics");
+
+  // more topics than observer threads
+  const size_t topic_count(16);
+  std::vector<std::unique_ptr<STopic>> topics;
+  for (size_t idx = 0; idx < topic_count; ++idx)
+  {
+    topics.emplace_back(std::make_unique<STopic>("topic_" + std::to_string(idx)));
+  }
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // every topic receives its own samples in order
+  const int sample_count(20);
+  std::vector<std::string> expected;
+  for (int sample = 0; sample < sample_count; ++sample)
+  {
+    expected.push_back(std::to_string(sample));
+    for (auto& topic : topics)
+    {
+      EXPECT_EQ(expected.back().size(), topic->pub.Send(expected.back()));
+    }
+    eCAL::Process::SleepMS(5);
+  }
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+
+  for (auto& topic : topics)
+  {
+    EXPECT_EQ(expected, topic->Received());
+  }
+
+  topics.clear();
+  eCAL::Finalize();
+}
+
+TEST(PubSubPool, SingleTopic)
+{
+  InitializePool("pubsub pool single topic");
+
+  // only one of many observed memory files is updated
+  const size_t topic_count(16);
+  std::vector<std::unique_ptr<STopic>> topics;
+  for (size_t idx = 0; idx < topic_count; ++idx)
+  {
+    topics.emplace_back(std::make_unique<STopic>("topic_" + std::to_string(idx)));
+  }
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  const int sample_count(200);
+  std::vector<std::string> expected;
+  for (int sample = 0; sample < sample_count; ++sample)
+  {
+    expected.push_back(std::to_string(sample));
+    EXPECT_EQ(expected.back().size(), topics[3]->pub.Send(expected.back()));
+    eCAL::Process::SleepMS(1);
+  }
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+
+  // every sample reaches the subscriber of the updated file, no other subscriber is called
+  for (size_t idx = 0; idx < topic_count; ++idx)
+  {
+    if (idx == 3) EXPECT_EQ(expected, topics[idx]->Received());
+    else          EXPECT_TRUE(topics[idx]->Received().empty());
+  }
+
+  topics.clear();
+  eCAL::Finalize();
+}
+
+TEST(PubSubPool, UpdateDuringCallback)
+{
+  InitializePool("pubsub pool update during callback");
+
+  eCAL::CSubscriber sub("slow_topic");
+  eCAL::CPublisher  pub("slow_topic");
+  pub.SetLayerMode(eCAL::TLayer::tlayer_all, eCAL::TLayer::smode_off);
+  pub.SetLayerMode(eCAL::TLayer::tlayer_shm, eCAL::TLayer::smode_on);
+
+  // the callback of the first sample of a round is slow, the second sample is sent meanwhile
+  std::atomic<bool> slow_entered(false);
+  std::mutex        mtx;
+  std::chrono::steady_clock::time_point slow_left;
+  std::vector<std::chrono::steady_clock::duration> gaps;
+  sub.AddReceiveCallback([&](const char* /*topic_name_*/, const struct eCAL::SReceiveCallbackData* data_)
+    {
+      const std::string sample(static_cast<const char*>(data_->buf), data_->size);
+      if (sample == "slow")
+      {
+        slow_entered = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        const std::lock_guard<std::mutex> lock(mtx);
+        slow_left = std::chrono::steady_clock::now();
+      }
+      else
+      {
+        const std::lock_guard<std::mutex> lock(mtx);
+        gaps.push_back(std::chrono::steady_clock::now() - slow_left);
+      }
+    });
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  const int round_count(10);
+  for (int round = 0; round < round_count; ++round)
+  {
+    slow_entered = false;
+    pub.Send("slow");
+    while (!slow_entered) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    pub.Send("fast");
+    eCAL::Process::SleepMS(100);
+  }
+
+  // the second sample is delivered right after the slow callback returned,
+  // not with the next check of all memory files (every 20 ms)
+  const std::lock_guard<std::mutex> lock(mtx);
+  ASSERT_EQ(static_cast<size_t>(round_count), gaps.size());
+  const auto max_gap = *std::max_element(gaps.begin(), gaps.end());
+  EXPECT_LT(max_gap, std::chrono::milliseconds(10));
+
+  sub.Destroy();
+  pub.Destroy();
+  eCAL::Finalize();
+}
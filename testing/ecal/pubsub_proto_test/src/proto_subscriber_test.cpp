@@ -20,7 +20,10 @@
 // std headers
 #include <atomic>
 #include <chrono>
+#include <mutex>
+#include <string>
 #include <thread>
+#include <vector>
 // used libraries
 #include <gtest/gtest.h>
 // own project
@@ -143,3 +146,53 @@ TEST_F(ProtoSubscriberTest, MoveConstruction)
   ASSERT_EQ(1, received_callbacks);
 
 }
+
+TEST_F(ProtoSubscriberTest, SendArenaMessage)
+{
+  eCAL::protobuf::CSubscriber<pb::People::Person> person_rec("ProtoSubscriberTest");
+  std::mutex received_mtx;
+  std::vector<std::string> received;
+  auto person_callback = [&received_mtx, &received](const char*, const pb::People::Person& person_, long long, long long, long long)
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    received.push_back(person_.SerializeAsString());
+  };
+  person_rec.AddReceiveCallback(person_callback);
+
+  eCAL::protobuf::CPublisher<pb::People::Person> person_pub("ProtoSubscriberTest");
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(2000));
+
+  std::vector<std::string> sent;
+
+  // arena message with nested messages, serialized with the cached sizes of all submessages
+  pb::People::Person* person = person_pub.CreateArenaMessage();
+  ASSERT_NE(nullptr, person);
+  person->set_id(1);
+  person->set_name("Max");
+  person->mutable_dog()->set_name("Brandy");
+  person->mutable_house()->set_rooms(4);
+  person_pub.Send(*person);
+  sent.push_back(person->SerializeAsString());
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  // a changed (grown) message is sized again on the next send
+  person->mutable_dog()->set_colour("brown");
+  person->set_email("max@mail.net");
+  person_pub.Send(*person);
+  sent.push_back(person->SerializeAsString());
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  // messages created after an arena reset can be sent as well
+  person_pub.ResetArena();
+  person = person_pub.CreateArenaMessage();
+  ASSERT_NE(nullptr, person);
+  person->set_id(2);
+  person->set_name("Erika");
+  person_pub.Send(*person);
+  sent.push_back(person->SerializeAsString());
+  std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+
+  const std::lock_guard<std::mutex> lock(received_mtx);
+  ASSERT_EQ(sent, received);
+}
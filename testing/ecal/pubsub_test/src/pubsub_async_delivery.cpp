@@ -0,0 +1,132 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#define CMN_REGISTRATION_REFRESH   1000
+#define DATA_FLOW_TIME               50
+#define QUEUE_DEPTH                   2
+
+namespace
+{
+  std::vector<std::string> SendWithBlockedCallback(eCAL::QOS::eQOSPolicy_Overflow overflow_, size_t& drop_count_)
+  {
+    // initialize eCAL API
+    eCAL::Initialize(0, nullptr, "pubsub_test");
+
+    // publish / subscribe match in the same process
+    eCAL::Util::EnableLoopback(true);
+
+    // create subscriber for topic "A" with a small receive queue
+    eCAL::CSubscriber sub;
+    eCAL::QOS::SReaderQOS qos;
+    qos.history_kind_depth = QUEUE_DEPTH;
+    qos.delivery           = eCAL::QOS::asynchronous_delivery_qos;
+    qos.overflow           = overflow_;
+    EXPECT_EQ(true, sub.SetQOS(qos));
+    EXPECT_EQ(true, sub.Create("A"));
+
+    // create inproc publisher for topic "A", so the samples are queued by the sending thread
+    eCAL::CPublisher pub("A");
+    pub.SetLayerMode(eCAL::TLayer::tlayer_all, eCAL::TLayer::smode_off);
+    pub.SetLayerMode(eCAL::TLayer::tlayer_inproc, eCAL::TLayer::smode_on);
+
+    // the callback of the first sample blocks the dispatcher until it is released
+    std::promise<void> entered;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+
+    std::mutex received_mtx;
+    std::vector<std::string> received;
+    auto lambda = [&](const char* /*topic_name_*/, const struct eCAL::SReceiveCallbackData* data_) {
+      const std::string payload(static_cast<const char*>(data_->buf), static_cast<size_t>(data_->size));
+      if (payload == "1")
+      {
+        entered.set_value();
+        released.wait_for(std::chrono::seconds(5));
+      }
+      const std::lock_guard<std::mutex> lock(received_mtx);
+      received.push_back(payload);
+    };
+    EXPECT_EQ(true, sub.AddReceiveCallback(lambda));
+
+    // let's match them
+    eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+    // block the dispatcher
+    pub.Send("1");
+    EXPECT_EQ(std::future_status::ready, entered.get_future().wait_for(std::chrono::seconds(5)));
+
+    // queue two samples and overflow the queue with two more
+    pub.Send("2");
+    pub.Send("3");
+    pub.Send("4");
+    pub.Send("5");
+    drop_count_ = sub.GetQueueDropCount();
+
+    // release the dispatcher and let it deliver the queued samples
+    release.set_value();
+    eCAL::Process::SleepMS(DATA_FLOW_TIME);
+
+    std::vector<std::string> result;
+    {
+      const std::lock_guard<std::mutex> lock(received_mtx);
+      result = received;
+    }
+
+    // destroy subscriber
+    sub.Destroy();
+
+    // destroy publisher
+    pub.Destroy();
+
+    // finalize eCAL API
+    eCAL::Finalize();
+
+    return result;
+  }
+}
+
+TEST(PubSub, AsyncDeliveryDropOldest)
+{
+  size_t drop_count(0);
+  const std::vector<std::string> received = SendWithBlockedCallback(eCAL::QOS::drop_oldest_overflow_qos, drop_count);
+
+  // the newest samples replaced the oldest queued ones
+  EXPECT_EQ(2, drop_count);
+  EXPECT_EQ(std::vector<std::string>({ "1", "4", "5" }), received);
+}
+
+TEST(PubSub, AsyncDeliveryDropNewest)
+{
+  size_t drop_count(0);
+  const std::vector<std::string> received = SendWithBlockedCallback(eCAL::QOS::drop_newest_overflow_qos, drop_count);
+
+  // the samples received on a full queue were dropped
+  EXPECT_EQ(2, drop_count);
+  EXPECT_EQ(std::vector<std::string>({ "1", "2", "3" }), received);
+}
@@ -0,0 +1,142 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#define CMN_REGISTRATION_REFRESH   1000
+#define DATA_FLOW_TIME               50
+#define PAYLOAD_SIZE_MAX           1024
+
+namespace
+{
+  std::string CreatePayload(int index_)
+  {
+    // vary the length to check that the committed length is used
+    return std::string(static_cast<size_t>(1 + index_ * 64), static_cast<char>('a' + index_ % 26));
+  }
+
+  void LoanAndCommit(size_t buffer_count_, long ring_slots_, bool shm_only_)
+  {
+    // initialize eCAL API
+    eCAL::Initialize(0, nullptr, "pubsub_test");
+
+    // publish / subscribe match in the same process
+    eCAL::Util::EnableLoopback(true);
+
+    // create subscriber for topic "A"
+    eCAL::CSubscriber sub("A");
+
+    // create publisher for topic "A"
+    eCAL::CPublisher pub("A");
+    pub.SetLayerMode(eCAL::TLayer::tlayer_all, eCAL::TLayer::smode_off);
+    pub.SetLayerMode(eCAL::TLayer::tlayer_shm, eCAL::TLayer::smode_on);
+    if (!shm_only_) pub.SetLayerMode(eCAL::TLayer::tlayer_inproc, eCAL::TLayer::smode_on);
+    pub.ShmSetBufferCount(static_cast<long>(buffer_count_));
+    pub.ShmSetRingSlotCount(ring_slots_);
+
+    // store all received samples
+    std::mutex received_mtx;
+    std::vector<std::string> received;
+    auto lambda = [&received_mtx, &received](const char* /*topic_name_*/, const struct eCAL::SReceiveCallbackData* data_) {
+      const std::lock_guard<std::mutex> lock(received_mtx);
+      received.emplace_back(static_cast<const char*>(data_->buf), static_cast<size_t>(data_->size));
+    };
+    EXPECT_EQ(true, sub.AddReceiveCallback(lambda));
+
+    // let's match them
+    eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+    const int iterations(10);
+    for (int i = 0; i < iterations; ++i)
+    {
+      const std::string payload = CreatePayload(i);
+
+      // fill the loaned buffer and commit the actual length
+      void* buf = pub.LoanBuffer(PAYLOAD_SIZE_MAX);
+      ASSERT_NE(nullptr, buf);
+
+      // only one loan at a time
+      EXPECT_EQ(nullptr, pub.LoanBuffer(PAYLOAD_SIZE_MAX));
+
+      memcpy(buf, payload.data(), payload.size());
+      EXPECT_EQ(payload.size(), pub.CommitBuffer(payload.size()));
+      eCAL::Process::SleepMS(DATA_FLOW_TIME);
+    }
+
+    // a discarded buffer is not sent
+    ASSERT_NE(nullptr, pub.LoanBuffer(PAYLOAD_SIZE_MAX));
+    EXPECT_EQ(true, pub.DiscardBuffer());
+    EXPECT_EQ(false, pub.DiscardBuffer());
+
+    // a length larger than the loaned buffer is rejected
+    ASSERT_NE(nullptr, pub.LoanBuffer(PAYLOAD_SIZE_MAX));
+    EXPECT_EQ(0, pub.CommitBuffer(PAYLOAD_SIZE_MAX + 1));
+    eCAL::Process::SleepMS(DATA_FLOW_TIME);
+
+    // check the received samples
+    {
+      const std::lock_guard<std::mutex> lock(received_mtx);
+      ASSERT_EQ(iterations, received.size());
+      for (int i = 0; i < iterations; ++i)
+      {
+        EXPECT_EQ(CreatePayload(i), received[i]);
+      }
+    }
+
+    // destroy subscriber
+    sub.Destroy();
+
+    // destroy publisher
+    pub.Destroy();
+
+    // finalize eCAL API
+    eCAL::Finalize();
+  }
+}
+
+TEST(PubSub, LoanSingleBuffer)
+{
+  // loan directly from the memory file
+  LoanAndCommit(1, 0, true);
+}
+
+TEST(PubSub, LoanMultiBuffer)
+{
+  // loan directly from the next memory file
+  LoanAndCommit(2, 0, true);
+}
+
+TEST(PubSub, LoanRingSlot)
+{
+  // loan directly from the next ring slot
+  LoanAndCommit(1, 4, true);
+}
+
+TEST(PubSub, LoanLocalBuffer)
+{
+  // multiple layers active, the loaned buffer is a publisher internal copy
+  LoanAndCommit(1, 0, false);
+}
@@ -0,0 +1,200 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#define CMN_REGISTRATION_REFRESH   1000
+#define DATA_FLOW_TIME               50
+#define PAYLOAD_SIZE               1024
+#define PUB_MEMFILE_OPEN_TO         200
+
+namespace
+{
+  std::string CreatePayload(int index_)
+  {
+    std::string payload(PAYLOAD_SIZE, static_cast<char>('a' + index_ % 26));
+    payload.replace(0, std::to_string(index_).size(), std::to_string(index_));
+    return payload;
+  }
+
+  std::string ViewContent(const std::shared_ptr<const eCAL::SReceiveViewData>& view_)
+  {
+    return std::string(static_cast<const char*>(view_->buf), view_->size);
+  }
+
+  void SendAndKeepViews(bool zero_copy_, size_t buffer_count_, bool expect_zero_copy_)
+  {
+    // initialize eCAL API
+    eCAL::Initialize(0, nullptr, "pubsub_test");
+
+    // publish / subscribe match in the same process
+    eCAL::Util::EnableLoopback(true);
+
+    // create subscriber for topic "A"
+    eCAL::CSubscriber sub("A");
+
+    // create publisher for topic "A"
+    eCAL::CPublisher pub("A");
+    pub.SetLayerMode(eCAL::TLayer::tlayer_all, eCAL::TLayer::smode_off);
+    pub.SetLayerMode(eCAL::TLayer::tlayer_shm, eCAL::TLayer::smode_on);
+    pub.ShmEnableZeroCopy(zero_copy_);
+    pub.ShmSetBufferCount(buffer_count_);
+
+    // store all received views
+    std::mutex views_mtx;
+    std::vector<std::shared_ptr<const eCAL::SReceiveViewData>> views;
+    auto lambda = [&views_mtx, &views](const char* /*topic_name_*/, const std::shared_ptr<const eCAL::SReceiveViewData>& view_) {
+      const std::lock_guard<std::mutex> lock(views_mtx);
+      views.push_back(view_);
+    };
+    EXPECT_EQ(true, sub.AddReceiveViewCallback(lambda));
+
+    // let's match them
+    eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+    const int iterations(10);
+    for (int i = 0; i < iterations; ++i)
+    {
+      // the held view never holds off the publisher
+      const auto send_start = std::chrono::steady_clock::now();
+      EXPECT_EQ(PAYLOAD_SIZE, pub.Send(CreatePayload(i)));
+      EXPECT_GT(std::chrono::milliseconds(PUB_MEMFILE_OPEN_TO), std::chrono::steady_clock::now() - send_start);
+      eCAL::Process::SleepMS(DATA_FLOW_TIME);
+
+      // the latest view is still referenced while the next sample is written,
+      // all older ones are released
+      const std::lock_guard<std::mutex> lock(views_mtx);
+      ASSERT_EQ(1, views.size());
+      EXPECT_EQ(CreatePayload(i), ViewContent(views.back()));
+      EXPECT_EQ(expect_zero_copy_, views.back()->zero_copy);
+      views.erase(views.begin(), views.end() - 1);
+    }
+
+    // the last view is still valid and unchanged
+    {
+      const std::lock_guard<std::mutex> lock(views_mtx);
+      ASSERT_EQ(1, views.size());
+      EXPECT_EQ(CreatePayload(iterations - 1), ViewContent(views.back()));
+      views.clear();
+    }
+
+    // destroy subscriber
+    sub.Destroy();
+
+    // destroy publisher
+    pub.Destroy();
+
+    // finalize eCAL API
+    eCAL::Finalize();
+  }
+}
+
+TEST(PubSub, ReceiveViewCopy)
+{
+  // no zero copy publisher, views own a copy of the payload
+  SendAndKeepViews(false, 2, false);
+}
+
+#ifdef ECAL_OS_LINUX
+TEST(PubSub, ReceiveViewZeroCopy)
+{
+  // zero copy publisher, views pin the memory file
+  // (windows named mutexes are owned by the locking thread, there the views always copy)
+  SendAndKeepViews(true, 2, true);
+}
+
+
+TEST(PubSub, ReceiveViewZeroCopyKeepAll)
+{
+  // initialize eCAL API
+  eCAL::Initialize(0, nullptr, "pubsub_test");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // create subscriber for topic "A"
+  eCAL::CSubscriber sub("A");
+
+  // create zero copy publisher for topic "A"
+  eCAL::CPublisher pub("A");
+  pub.SetLayerMode(eCAL::TLayer::tlayer_all, eCAL::TLayer::smode_off);
+  pub.SetLayerMode(eCAL::TLayer::tlayer_shm, eCAL::TLayer::smode_on);
+  pub.ShmEnableZeroCopy(true);
+  pub.ShmSetBufferCount(2);
+
+  // keep all received views
+  std::mutex views_mtx;
+  std::vector<std::shared_ptr<const eCAL::SReceiveViewData>> views;
+  auto lambda = [&views_mtx, &views](const char* /*topic_name_*/, const std::shared_ptr<const eCAL::SReceiveViewData>& view_) {
+    const std::lock_guard<std::mutex> lock(views_mtx);
+    views.push_back(view_);
+  };
+  EXPECT_EQ(true, sub.AddReceiveViewCallback(lambda));
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // all memory files get pinned, the publisher adds spare ones (or the views copy)
+  // but it never waits for the pinned files
+  const int iterations(10);
+  for (int i = 0; i < iterations; ++i)
+  {
+    const auto send_start = std::chrono::steady_clock::now();
+    EXPECT_EQ(PAYLOAD_SIZE, pub.Send(CreatePayload(i)));
+    EXPECT_GT(std::chrono::milliseconds(PUB_MEMFILE_OPEN_TO), std::chrono::steady_clock::now() - send_start);
+    eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  }
+
+  // all views are still unchanged
+  {
+    const std::lock_guard<std::mutex> lock(views_mtx);
+    EXPECT_LT(0, views.size());
+    for (const auto& view : views)
+    {
+      const std::string content = ViewContent(view);
+      EXPECT_EQ(CreatePayload(std::stoi(content)), content);
+    }
+    views.clear();
+  }
+
+  // destroy subscriber
+  sub.Destroy();
+
+  // destroy publisher
+  pub.Destroy();
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+#endif
+
+TEST(PubSub, ReceiveViewZeroCopySingleBuffer)
+{
+  // zero copy publisher with a single memory file,
+  // a pinned view would hold off the publisher so the views copy
+  SendAndKeepViews(true, 1, false);
+}
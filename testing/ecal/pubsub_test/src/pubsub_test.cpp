@@ -22,7 +22,9 @@
 #include <ecal/msg/string/subscriber.h>
 
 #include <atomic>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -341,6 +343,153 @@ TEST(PubSub, SimpleMessage2)
   eCAL::Finalize();
 }
 
+TEST(PubSub, ReceiveBatch)
+{
+  // initialize eCAL API
+  eCAL::Initialize(0, nullptr, "pubsub_test");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // create subscriber for topic "A" (keeps the last 4 samples)
+  eCAL::QOS::SReaderQOS qos;
+  qos.history_kind_depth = 4;
+  eCAL::CSubscriber sub;
+  sub.SetQOS(qos);
+  sub.Create("A");
+
+  // create publisher for topic "A"
+  eCAL::CPublisher pub("A");
+  pub.SetLayerMode(eCAL::TLayer::tlayer_all, eCAL::TLayer::smode_off);
+  pub.SetLayerMode(eCAL::TLayer::tlayer_shm, eCAL::TLayer::smode_on);
+  pub.ShmSetAcknowledgeTimeout(10); // Make sure we receive the data
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // all samples since the last call are received in order
+  std::vector<eCAL::SReceivedSample> samples;
+  for (long long timestamp = 1; timestamp <= 3; ++timestamp)
+  {
+    pub.Send(std::to_string(timestamp), timestamp);
+  }
+  EXPECT_EQ(3, sub.ReceiveBatch(samples, DATA_FLOW_TIME));
+  ASSERT_EQ(3, samples.size());
+  for (long long timestamp = 1; timestamp <= 3; ++timestamp)
+  {
+    EXPECT_EQ(std::to_string(timestamp), samples[timestamp - 1].buf);
+    EXPECT_EQ(timestamp, samples[timestamp - 1].time);
+  }
+
+  // nothing new
+  EXPECT_EQ(0, sub.ReceiveBatch(samples, DATA_FLOW_TIME));
+  EXPECT_EQ(0, samples.size());
+
+  // history depth exceeded, the oldest samples are overwritten
+  for (long long timestamp = 1; timestamp <= 6; ++timestamp)
+  {
+    pub.Send(std::to_string(timestamp), timestamp);
+  }
+  EXPECT_EQ(4, sub.ReceiveBatch(samples, DATA_FLOW_TIME));
+  ASSERT_EQ(4, samples.size());
+  EXPECT_EQ("3", samples.front().buf);
+  EXPECT_EQ("6", samples.back().buf);
+
+  // ReceiveBuffer returns the newest sample and discards the others
+  for (long long timestamp = 1; timestamp <= 2; ++timestamp)
+  {
+    pub.Send(std::to_string(timestamp), timestamp);
+  }
+  std::string recv_s;
+  EXPECT_EQ(true, sub.ReceiveBuffer(recv_s, nullptr, DATA_FLOW_TIME));
+  EXPECT_EQ("2", recv_s);
+  EXPECT_EQ(0, sub.ReceiveBatch(samples));
+
+  // destroy publisher
+  pub.Destroy();
+
+  // destroy subscriber
+  sub.Destroy();
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(PubSub, BatchSend)
+{
+  // initialize eCAL API
+  eCAL::Initialize(0, nullptr, "pubsub_test");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // create subscriber for topic "A" (keeps the last 16 samples)
+  eCAL::QOS::SReaderQOS qos;
+  qos.history_kind_depth = 16;
+  eCAL::CSubscriber sub;
+  sub.SetQOS(qos);
+  sub.Create("A");
+
+  // create publisher for topic "A", collect up to 256 bytes without time window
+  eCAL::CPublisher pub("A");
+  pub.SetLayerMode(eCAL::TLayer::tlayer_all, eCAL::TLayer::smode_off);
+  pub.SetLayerMode(eCAL::TLayer::tlayer_shm, eCAL::TLayer::smode_on);
+  pub.ShmSetAcknowledgeTimeout(10); // Make sure we receive the data
+  EXPECT_EQ(true, pub.SetBatching(256, 0));
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // nothing is sent before the frame is flushed
+  std::vector<eCAL::SReceivedSample> samples;
+  for (long long timestamp = 1; timestamp <= 3; ++timestamp)
+  {
+    pub.Send(std::to_string(timestamp), timestamp);
+  }
+  EXPECT_EQ(0, sub.ReceiveBatch(samples, DATA_FLOW_TIME));
+
+  // samples are unbatched with their own time and clock
+  EXPECT_EQ(true, pub.FlushBatch());
+  EXPECT_EQ(3, sub.ReceiveBatch(samples, DATA_FLOW_TIME));
+  ASSERT_EQ(3, samples.size());
+  for (long long timestamp = 1; timestamp <= 3; ++timestamp)
+  {
+    EXPECT_EQ(std::to_string(timestamp), samples[timestamp - 1].buf);
+    EXPECT_EQ(timestamp, samples[timestamp - 1].time);
+  }
+  EXPECT_EQ(samples[0].clock + 1, samples[1].clock);
+  EXPECT_EQ(samples[1].clock + 1, samples[2].clock);
+
+  // empty frame is not sent
+  EXPECT_EQ(false, pub.FlushBatch());
+
+  // frame is sent when full, a sample larger than a frame is sent unbatched (after the pending ones)
+  for (long long timestamp = 1; timestamp <= 8; ++timestamp)
+  {
+    pub.Send(std::string(40, 'a'), timestamp);
+  }
+  pub.Send(std::string(512, 'b'), 9);
+  EXPECT_EQ(9, sub.ReceiveBatch(samples, DATA_FLOW_TIME));
+  ASSERT_EQ(9, samples.size());
+  EXPECT_EQ(std::string(40, 'a'), samples.front().buf);
+  EXPECT_EQ(std::string(512, 'b'), samples.back().buf);
+
+  // time window elapsed
+  EXPECT_EQ(true, pub.SetBatching(256, 1000));
+  pub.Send("window", 1);
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  EXPECT_EQ(1, sub.ReceiveBatch(samples, DATA_FLOW_TIME));
+
+  // destroy publisher
+  pub.Destroy();
+
+  // destroy subscriber
+  sub.Destroy();
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
 TEST(PubSub, SimpleMessageCB)
 { 
   // default send string
@@ -0,0 +1,131 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "util/ecal_recent_hash_set.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <random>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  // reference implementation, the duplicate check CDataReader used before
+  template<size_t Capacity>
+  class CRecentHashDeque
+  {
+  public:
+    bool Contains(uint64_t hash_) const
+    {
+      return std::find(m_queue.begin(), m_queue.end(), hash_) != m_queue.end();
+    }
+
+    bool Insert(uint64_t hash_)
+    {
+      if (Contains(hash_)) return false;
+      m_queue.push_back(hash_);
+      while (m_queue.size() > Capacity) m_queue.pop_front();
+      return true;
+    }
+
+    size_t Size() const { return m_queue.size(); }
+
+  private:
+    std::deque<uint64_t> m_queue;
+  };
+
+  template<size_t Capacity>
+  void CompareWithReference(uint64_t value_range_, unsigned int seed_)
+  {
+    eCAL::Util::CRecentHashSet<Capacity> set;
+    CRecentHashDeque<Capacity>           reference;
+
+    // a small value range produces many duplicates, full clusters
+    // and evictions in the middle of the probe sequences
+    std::mt19937_64 generator(seed_);
+    std::uniform_int_distribution<uint64_t> distribution(0, value_range_ - 1);
+    for (int idx = 0; idx < 100000; ++idx)
+    {
+      const uint64_t hash = distribution(generator);
+      ASSERT_EQ(reference.Insert(hash), set.Insert(hash)) << "insert " << idx;
+      ASSERT_EQ(reference.Size(), set.Size());
+    }
+
+    // every value of the range is reported like the reference does
+    for (uint64_t hash = 0; hash < value_range_; ++hash)
+    {
+      EXPECT_EQ(reference.Contains(hash), set.Contains(hash)) << "hash " << hash;
+    }
+  }
+}
+
+TEST(RecentHashSet, InsertContains)
+{
+  eCAL::Util::CRecentHashSet<4> set;
+  EXPECT_EQ(0, set.Size());
+  EXPECT_FALSE(set.Contains(42));
+
+  EXPECT_TRUE(set.Insert(42));
+  EXPECT_TRUE(set.Contains(42));
+  EXPECT_FALSE(set.Insert(42));
+  EXPECT_EQ(1, set.Size());
+
+  // zero is a valid hash value
+  EXPECT_TRUE(set.Insert(0));
+  EXPECT_TRUE(set.Contains(0));
+  EXPECT_EQ(2, set.Size());
+
+  set.Clear();
+  EXPECT_EQ(0, set.Size());
+  EXPECT_FALSE(set.Contains(42));
+  EXPECT_FALSE(set.Contains(0));
+}
+
+TEST(RecentHashSet, EvictOldest)
+{
+  eCAL::Util::CRecentHashSet<4> set;
+  for (uint64_t hash = 1; hash <= 4; ++hash) EXPECT_TRUE(set.Insert(hash));
+
+  // the fifth value evicts the first one
+  EXPECT_TRUE(set.Insert(5));
+  EXPECT_EQ(4, set.Size());
+  EXPECT_FALSE(set.Contains(1));
+  for (uint64_t hash = 2; hash <= 5; ++hash) EXPECT_TRUE(set.Contains(hash));
+
+  // a rejected duplicate does not change the eviction order
+  EXPECT_FALSE(set.Insert(2));
+  EXPECT_TRUE(set.Insert(6));
+  EXPECT_FALSE(set.Contains(2));
+  EXPECT_TRUE(set.Contains(3));
+}
+
+TEST(RecentHashSet, CompareWithDequeSmall)
+{
+  CompareWithReference<1>(4, 1);
+  CompareWithReference<3>(8, 2);
+  CompareWithReference<8>(24, 3);
+}
+
+TEST(RecentHashSet, CompareWithDeque)
+{
+  CompareWithReference<64>(128, 4);
+  CompareWithReference<64>(1024, 5);
+}
@@ -0,0 +1,304 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+
+#include "ecal_descriptor_store.h"
+#include "ecal_global_accessors.h"
+#include "io/udp/ecal_udp_configurations.h"
+#include "io/udp/ecal_udp_sample_receiver.h"
+#include "registration/ecal_registration_receiver.h"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#define REGISTRATION_REFRESH        100
+#define REGISTRATION_WAIT_TIME     2000
+
+namespace
+{
+  // all tests of this process use delta registrations with interned descriptors
+  void InitializeDelta(const char* unit_name_)
+  {
+    std::vector<std::string> args =
+    {
+      "registration_test",
+      "--ecal-set-config-key", "common/registration_refresh:" + std::to_string(REGISTRATION_REFRESH),
+      "--ecal-set-config-key", "experimental/registration_delta:true",
+      "--ecal-set-config-key", "experimental/registration_desc_interning:true",
+    };
+    std::vector<char*> argv;
+    for (auto& arg : args) argv.push_back(&arg[0]);
+
+    eCAL::Initialize(static_cast<int>(argv.size()), argv.data(), unit_name_);
+  }
+
+  bool WaitFor(const std::function<bool()>& condition_)
+  {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(REGISTRATION_WAIT_TIME);
+    while (!condition_())
+    {
+      if (std::chrono::steady_clock::now() > deadline) return false;
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return true;
+  }
+
+  using SamplePredicateT = std::function<bool(const eCAL::pb::Sample&)>;
+
+  // thread safe list of samples
+  class CSampleList
+  {
+  public:
+    void Add(const eCAL::pb::Sample& sample_)
+    {
+      const std::lock_guard<std::mutex> lock(m_mtx);
+      m_samples.push_back(sample_);
+    }
+
+    std::vector<eCAL::pb::Sample> Get(const SamplePredicateT& predicate_)
+    {
+      std::vector<eCAL::pb::Sample> samples;
+      const std::lock_guard<std::mutex> lock(m_mtx);
+      for (const auto& sample : m_samples)
+      {
+        if (predicate_(sample)) samples.push_back(sample);
+      }
+      return samples;
+    }
+
+    size_t Count(const SamplePredicateT& predicate_)
+    {
+      return Get(predicate_).size();
+    }
+
+    void Clear()
+    {
+      const std::lock_guard<std::mutex> lock(m_mtx);
+      m_samples.clear();
+    }
+
+  private:
+    std::mutex                    m_mtx;
+    std::vector<eCAL::pb::Sample> m_samples;
+  };
+
+  // samples as they are sent on the registration channel
+  class CRegistrationSniffer : public CSampleList
+  {
+  public:
+    CRegistrationSniffer()
+    {
+      IO::UDP::SReceiverAttr attr;
+      attr.address   = eCAL::UDP::GetRegistrationAddress();
+      attr.port      = eCAL::UDP::GetRegistrationPort();
+      attr.broadcast = eCAL::UDP::IsBroadcast();
+      attr.loopback  = true;
+
+      m_receiver = std::make_shared<eCAL::UDP::CSampleReceiver>(attr
+        , [](const std::string& /*sample_name_*/) { return true; }
+        , [this](const eCAL::pb::Sample& sample_, eCAL::pb::eTLayerType /*layer_*/, const char* /*serialized_buf_*/, size_t /*serialized_len_*/) { Add(sample_); });
+    }
+
+  private:
+    std::shared_ptr<eCAL::UDP::CSampleReceiver> m_receiver;
+  };
+
+  // samples as they are passed to the registration callbacks (complete registrations)
+  class CPublisherRegistrations : public CSampleList
+  {
+  public:
+    CPublisherRegistrations()
+    {
+      eCAL::Process::AddRegistrationCallback(reg_event_publisher, [this](const char* sample_, int sample_size_)
+        {
+          eCAL::pb::Sample sample;
+          if (sample.ParseFromArray(sample_, sample_size_)) Add(sample);
+        });
+    }
+
+    ~CPublisherRegistrations()
+    {
+      eCAL::Process::RemRegistrationCallback(reg_event_publisher);
+    }
+  };
+
+  SamplePredicateT IsTopic(eCAL::pb::eCmdType cmd_type_, const std::string& topic_name_)
+  {
+    return [cmd_type_, topic_name_](const eCAL::pb::Sample& sample_)
+      {
+        return (sample_.cmd_type() == cmd_type_) && (sample_.topic().tname() == topic_name_);
+      };
+  }
+
+  SamplePredicateT IsHeartbeat(const std::string& topic_name_)
+  {
+    return [topic_name_](const eCAL::pb::Sample& sample_)
+      {
+        return (sample_.cmd_type() == eCAL::pb::bct_reg_heartbeat) && (sample_.reg_cmd_type() == eCAL::pb::bct_reg_publisher) && (sample_.topic().tname() == topic_name_);
+      };
+  }
+
+  eCAL::pb::Sample CreateRemotePublisherRegistration(const std::string& topic_name_, uint64_t desc_hash_)
+  {
+    eCAL::pb::Sample sample;
+    sample.set_cmd_type(eCAL::pb::bct_reg_publisher);
+    auto* topic = sample.mutable_topic();
+    topic->set_hname("remote_host");
+    topic->set_hgname("remote_host");
+    topic->set_pid(4242);
+    topic->set_tname(topic_name_);
+    topic->set_tid("4711");
+    topic->mutable_tdatatype()->set_name("remote_type");
+    topic->mutable_tdatatype()->set_encoding("remote_encoding");
+    topic->mutable_tdatatype()->set_desc_hash(desc_hash_);
+    return sample;
+  }
+}
+
+TEST(RegistrationDelta, HeartbeatCompletion)
+{
+  InitializeDelta("registration delta heartbeat completion");
+  {
+    CRegistrationSniffer    sniffer;
+    CPublisherRegistrations registrations;
+
+    eCAL::CPublisher pub("delta_topic", { "delta_type", "delta_encoding", "delta_desc" });
+
+    // after the complete registration only heartbeats are sent
+    ASSERT_TRUE(WaitFor([&]() { return sniffer.Count(IsHeartbeat("delta_topic")) >= 3; }));
+    const auto sent_registrations = sniffer.Get(IsTopic(eCAL::pb::bct_reg_publisher, "delta_topic"));
+    ASSERT_GE(sent_registrations.size(), 1U);
+    EXPECT_NE(sent_registrations.front().reg_hash(), 0U);
+    EXPECT_LT(sent_registrations.size(), sniffer.Count(IsHeartbeat("delta_topic")));
+
+    // the interned descriptor is sent by hash
+    EXPECT_TRUE(sent_registrations.front().topic().tdatatype().desc().empty());
+    EXPECT_EQ(sent_registrations.front().topic().tdatatype().desc_hash(), eCAL::CDescriptorStore::GetHash("delta_desc"));
+
+    // every heartbeat is completed with the stored registration and the descriptor
+    ASSERT_TRUE(WaitFor([&]() { return registrations.Count(IsTopic(eCAL::pb::bct_reg_publisher, "delta_topic")) >= 3; }));
+    const auto applied_registrations = registrations.Get(IsTopic(eCAL::pb::bct_reg_publisher, "delta_topic"));
+    for (const auto& registration : applied_registrations)
+    {
+      EXPECT_EQ(registration.topic().tdatatype().name(),     "delta_type");
+      EXPECT_EQ(registration.topic().tdatatype().encoding(), "delta_encoding");
+      EXPECT_EQ(registration.topic().tdatatype().desc(),     "delta_desc");
+    }
+
+    // with the registration clock of the heartbeat
+    EXPECT_GT(applied_registrations.back().topic().rclock(), applied_registrations.front().topic().rclock());
+  }
+  eCAL::Finalize();
+}
+
+TEST(RegistrationDelta, HashChangeRequestsRegistration)
+{
+  InitializeDelta("registration delta hash change");
+  {
+    CRegistrationSniffer sniffer;
+
+    eCAL::CPublisher pub("delta_topic", { "delta_type", "delta_encoding", "delta_desc" });
+    ASSERT_TRUE(WaitFor([&]() { return sniffer.Count(IsHeartbeat("delta_topic")) >= 1; }));
+
+    // a heartbeat that refers to a registration the receiver does not know
+    eCAL::pb::Sample heartbeat = sniffer.Get(IsHeartbeat("delta_topic")).front();
+    const uint64_t   reg_hash  = heartbeat.reg_hash();
+    heartbeat.set_reg_hash(reg_hash + 1);
+    sniffer.Clear();
+    EXPECT_FALSE(eCAL::g_registration_receiver()->ApplySample(heartbeat));
+
+    // the receiver asks the owning process (that's us) for its complete registrations ..
+    ASSERT_TRUE(WaitFor([&]()
+      {
+        return sniffer.Count([](const eCAL::pb::Sample& sample_)
+          {
+            return (sample_.cmd_type() == eCAL::pb::bct_reg_request) && (sample_.process().pid() == eCAL::Process::GetProcessID());
+          }) >= 1;
+      }));
+
+    // .. which are sent completely in the next refresh cycle
+    ASSERT_TRUE(WaitFor([&]() { return sniffer.Count(IsTopic(eCAL::pb::bct_reg_publisher, "delta_topic")) >= 1; }));
+    EXPECT_EQ(sniffer.Get(IsTopic(eCAL::pb::bct_reg_publisher, "delta_topic")).front().reg_hash(), reg_hash);
+  }
+  eCAL::Finalize();
+}
+
+TEST(RegistrationDelta, DescriptorFetch)
+{
+  InitializeDelta("registration delta descriptor fetch");
+  {
+    CRegistrationSniffer    sniffer;
+    CPublisherRegistrations registrations;
+
+    // a registration of another process with a descriptor we do not know, yet
+    const std::string      remote_desc      = "remote_desc";
+    const uint64_t         remote_desc_hash = eCAL::CDescriptorStore::GetHash(remote_desc);
+    const eCAL::pb::Sample remote_sample    = CreateRemotePublisherRegistration("remote_topic", remote_desc_hash);
+    EXPECT_TRUE(eCAL::g_registration_receiver()->ApplySample(remote_sample));
+
+    // is applied without descriptor and the descriptor is requested
+    ASSERT_EQ(registrations.Count(IsTopic(eCAL::pb::bct_reg_publisher, "remote_topic")), 1U);
+    EXPECT_TRUE(registrations.Get(IsTopic(eCAL::pb::bct_reg_publisher, "remote_topic")).front().topic().tdatatype().desc().empty());
+    ASSERT_TRUE(WaitFor([&]()
+      {
+        return sniffer.Count([remote_desc_hash](const eCAL::pb::Sample& sample_)
+          {
+            return (sample_.cmd_type() == eCAL::pb::bct_desc_request) && (sample_.topic().tdatatype().desc_hash() == remote_desc_hash);
+          }) >= 1;
+      }));
+
+    // the requested descriptor completes the following registrations
+    eCAL::pb::Sample response;
+    response.set_cmd_type(eCAL::pb::bct_desc_response);
+    response.mutable_topic()->mutable_tdatatype()->set_desc_hash(remote_desc_hash);
+    response.mutable_topic()->mutable_tdatatype()->set_desc(remote_desc);
+    EXPECT_TRUE(eCAL::g_registration_receiver()->ApplySample(response));
+    EXPECT_TRUE(eCAL::g_registration_receiver()->ApplySample(remote_sample));
+    ASSERT_EQ(registrations.Count(IsTopic(eCAL::pb::bct_reg_publisher, "remote_topic")), 2U);
+    EXPECT_EQ(registrations.Get(IsTopic(eCAL::pb::bct_reg_publisher, "remote_topic")).back().topic().tdatatype().desc(), remote_desc);
+
+    // we answer requests for the descriptors we sent by hash
+    eCAL::CPublisher pub("delta_topic", { "delta_type", "delta_encoding", "delta_desc" });
+    ASSERT_TRUE(WaitFor([&]() { return sniffer.Count(IsTopic(eCAL::pb::bct_reg_publisher, "delta_topic")) >= 1; }));
+
+    const uint64_t   own_desc_hash = eCAL::CDescriptorStore::GetHash("delta_desc");
+    eCAL::pb::Sample request;
+    request.set_cmd_type(eCAL::pb::bct_desc_request);
+    request.mutable_topic()->mutable_tdatatype()->set_desc_hash(own_desc_hash);
+    EXPECT_TRUE(eCAL::g_registration_receiver()->ApplySample(request));
+
+    ASSERT_TRUE(WaitFor([&]()
+      {
+        return sniffer.Count([own_desc_hash](const eCAL::pb::Sample& sample_)
+          {
+            return (sample_.cmd_type() == eCAL::pb::bct_desc_response) && (sample_.topic().tdatatype().desc_hash() == own_desc_hash);
+          }) >= 1;
+      }));
+    EXPECT_EQ(sniffer.Get([](const eCAL::pb::Sample& sample_) { return sample_.cmd_type() == eCAL::pb::bct_desc_response; }).front().topic().tdatatype().desc(), "delta_desc");
+  }
+  eCAL::Finalize();
+}
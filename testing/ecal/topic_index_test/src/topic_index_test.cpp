@@ -0,0 +1,184 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "util/ecal_topic_index.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  struct SEntity
+  {
+    explicit SEntity(int id_) : id(id_) {}
+    int id;
+  };
+  using TopicIndexT = eCAL::Util::CTopicIndex<SEntity>;
+}
+
+TEST(TopicIndex, AddFindRemove)
+{
+  TopicIndexT index;
+  auto a1 = std::make_shared<SEntity>(1);
+  auto a2 = std::make_shared<SEntity>(2);
+  auto b1 = std::make_shared<SEntity>(3);
+
+  EXPECT_EQ(nullptr, index.Find("A"));
+
+  index.Add("A", a1);
+  index.Add("A", a2);
+  index.Add("B", b1);
+
+  auto entities = index.Find("A");
+  ASSERT_NE(nullptr, entities);
+  ASSERT_EQ(2, entities->size());
+  EXPECT_EQ(a1, (*entities)[0]);
+  EXPECT_EQ(a2, (*entities)[1]);
+
+  entities = index.Find("B");
+  ASSERT_NE(nullptr, entities);
+  ASSERT_EQ(1, entities->size());
+  EXPECT_EQ(b1, (*entities)[0]);
+
+  // unknown entity / topic
+  EXPECT_FALSE(index.Remove("A", b1));
+  EXPECT_FALSE(index.Remove("C", a1));
+
+  EXPECT_TRUE(index.Remove("A", a1));
+  EXPECT_FALSE(index.Remove("A", a1));
+  entities = index.Find("A");
+  ASSERT_NE(nullptr, entities);
+  ASSERT_EQ(1, entities->size());
+  EXPECT_EQ(a2, (*entities)[0]);
+
+  // the last entity removes the topic
+  EXPECT_TRUE(index.Remove("A", a2));
+  EXPECT_EQ(nullptr, index.Find("A"));
+  EXPECT_EQ(1, index.GetSnapshot()->size());
+}
+
+TEST(TopicIndex, SnapshotIsImmutable)
+{
+  TopicIndexT index;
+  auto a1 = std::make_shared<SEntity>(1);
+  auto a2 = std::make_shared<SEntity>(2);
+  index.Add("A", a1);
+
+  // a snapshot and an entity list taken before a modification stay unchanged
+  auto snapshot = index.GetSnapshot();
+  auto entities = index.Find("A");
+  index.Add("A", a2);
+  index.Add("B", a2);
+  EXPECT_TRUE(index.Remove("A", a1));
+
+  EXPECT_EQ(1, snapshot->size());
+  ASSERT_EQ(1, entities->size());
+  EXPECT_EQ(a1, (*entities)[0]);
+
+  EXPECT_EQ(2, index.GetSnapshot()->size());
+}
+
+TEST(TopicIndex, CacheInvalidation)
+{
+  TopicIndexT index;
+  TopicIndexT::SLookupCache cache;
+  auto a1 = std::make_shared<SEntity>(1);
+  auto a2 = std::make_shared<SEntity>(2);
+  auto b1 = std::make_shared<SEntity>(3);
+
+  // an empty result is cached as well
+  EXPECT_EQ(nullptr, index.Find("A", cache));
+  const uint64_t empty_version = cache.version;
+  EXPECT_NE(0, empty_version);
+  EXPECT_EQ(nullptr, index.Find("A", cache));
+  EXPECT_EQ(empty_version, cache.version);
+
+  // adding to the topic invalidates the cache
+  index.Add("A", a1);
+  auto entities = index.Find("A", cache);
+  ASSERT_NE(nullptr, entities);
+  EXPECT_EQ(1, entities->size());
+
+  // repeated lookups return the cached list
+  EXPECT_EQ(entities, index.Find("A", cache));
+
+  // any modification (other topics as well) invalidates the cache
+  const uint64_t version = cache.version;
+  index.Add("B", b1);
+  EXPECT_EQ(entities, index.Find("A", cache));
+  EXPECT_NE(version, cache.version);
+
+  index.Add("A", a2);
+  entities = index.Find("A", cache);
+  ASSERT_NE(nullptr, entities);
+  EXPECT_EQ(2, entities->size());
+
+  EXPECT_TRUE(index.Remove("A", a1));
+  EXPECT_TRUE(index.Remove("A", a2));
+  EXPECT_EQ(nullptr, index.Find("A", cache));
+
+  // a failed removal does not publish a new snapshot
+  const uint64_t removed_version = cache.version;
+  EXPECT_FALSE(index.Remove("A", a1));
+  index.Find("A", cache);
+  EXPECT_EQ(removed_version, cache.version);
+}
+
+TEST(TopicIndex, ConcurrentFind)
+{
+  TopicIndexT index;
+  auto a1 = std::make_shared<SEntity>(1);
+  index.Add("A", a1);
+
+  // readers always see "A" with a1 first, while a writer adds and removes a second entity
+  std::atomic<bool> done(false);
+  std::atomic<int>  errors(0);
+  std::vector<std::thread> readers;
+  for (int reader = 0; reader < 2; ++reader)
+  {
+    readers.emplace_back([&index, &done, &errors, &a1]()
+      {
+        TopicIndexT::SLookupCache cache;
+        while (!done)
+        {
+          const auto entities = index.Find("A", cache);
+          if (!entities || entities->empty() || ((*entities)[0] != a1) || (entities->size() > 2)) errors++;
+          std::this_thread::yield();
+        }
+      });
+  }
+
+  for (int idx = 0; idx < 1000; ++idx)
+  {
+    auto entity = std::make_shared<SEntity>(idx + 2);
+    index.Add("A", entity);
+    EXPECT_TRUE(index.Remove("A", entity));
+  }
+  done = true;
+  for (auto& reader : readers) reader.join();
+
+  EXPECT_EQ(0, errors);
+  ASSERT_NE(nullptr, index.Find("A"));
+  EXPECT_EQ(1, index.Find("A")->size());
+}